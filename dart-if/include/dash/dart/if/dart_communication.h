@@ -210,6 +210,37 @@ dart_ret_t dart_alltoall(
   dart_datatype_t  dtype,
   dart_team_t      team) DART_NOTHROW;
 
+/**
+ * DART Equivalent to MPI alltoallv.
+ *
+ * \param sendbuf     The buffer containing the data to be sent by each unit.
+ * \param nsendelem   Array containing the number of values to send to
+ *                    each unit.
+ * \param senddispls  Array containing the displacements of data sent to
+ *                    each unit in \c sendbuf.
+ * \param dtype       The data type of values in \c sendbuf and \c recvbuf.
+ * \param recvbuf     The buffer to hold the received data.
+ * \param nrecvelem   Array containing the number of values to receive from
+ *                    each unit.
+ * \param recvdispls  Array containing the displacements of data received
+ *                    from each unit in \c recvbuf.
+ * \param teamid      The team to participate in the alltoallv.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid) DART_NOTHROW;
+
 /**
  * DART Equivalent to MPI_Reduce.
  *
@@ -426,6 +457,45 @@ dart_ret_t dart_put(
   dart_datatype_t   src_type,
   dart_datatype_t   dst_type) DART_NOTHROW;
 
+/**
+ * Notified variant of dart_put.
+ * Copy data from local memory into memory referenced by a global pointer
+ * and atomically add \c value to the integer flag referenced by
+ * \c flag_gptr once the data is visible at the target.
+ * A unit observing the updated flag value, e.g. using
+ * \ref dart_fetch_and_op, is guaranteed to read the transferred data.
+ *
+ * When this function returns, the data has been completed at the target
+ * and \c src may be reused. Like \ref dart_accumulate, the flag update
+ * is only guaranteed to complete after a subsequent flush of
+ * \c flag_gptr, e.g. using \ref dart_flush.
+ * Data written to units reachable through shared memory is ordered before
+ * the flag update by a memory barrier instead of a flush.
+ * Use \ref dart_put_notify_handle to share flushes among several
+ * notified puts.
+ *
+ * \param gptr      A global pointer determining the target of the put
+ *                  operation.
+ * \param src       The local source buffer to load the data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param dtype     The data type of the values in buffer \c src and at the
+ *                  target.
+ * \param flag_gptr A global pointer to the \c DART_TYPE_INT flag to update.
+ * \param value     The value to add to the flag.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_notify(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t       flag_gptr,
+  int               value) DART_NOTHROW;
+
 
 /**
  * Guarantee completion of all outstanding operations involving a segment on a certain unit
@@ -434,6 +504,7 @@ dart_ret_t dart_put(
  * gets on a certain memory allocation / window / segment for the
  * target unit specified in gptr.
  * Similar to \c MPI_Win_flush().
+ * Returns immediately if no operations are outstanding for the target.
  *
  * \param gptr Global pointer identifying the segment and unit to complete outstanding operations for.
  * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
@@ -495,6 +566,30 @@ dart_ret_t dart_flush_local(
 dart_ret_t dart_flush_local_all(
   dart_gptr_t gptr) DART_NOTHROW;
 
+/**
+ * Set the size of the buffers used to combine small non-blocking puts
+ * and accumulates.
+ *
+ * With write-combining enabled, transfers issued through \ref dart_put
+ * and \ref dart_accumulate that are small compared to the buffer size and
+ * address units not reachable through shared memory are staged in a
+ * buffer per target unit. Adjacent target ranges are coalesced and the
+ * buffer is transferred in a single operation once it is full or on the
+ * next flush, barrier or atomic operation involving the target.
+ * Write-combining is disabled by default, the initial buffer size can
+ * also be set in the environment variable \c DART_WRITE_COMBINING.
+ *
+ * \param nbytes Size of the buffer per target unit in bytes, 0 disables
+ *               write-combining.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_write_combining(
+  size_t nbytes) DART_NOTHROW;
+
 
 /** \} */
 
@@ -569,6 +664,43 @@ dart_ret_t dart_put_handle(
   dart_datatype_t   dst_type,
   dart_handle_t   * handle) DART_NOTHROW;
 
+/**
+ * 'HANDLE' variant of dart_put_notify.
+ * The flag referenced by \c flag_gptr is updated when the handle is
+ * completed using \c dart_wait, \c dart_waitall, \c dart_test or
+ * \c dart_testall. Completing the handles of several notified puts in a
+ * single call of \c dart_waitall flushes every target once before the
+ * flags are updated.
+ *
+ * \param gptr      A global pointer determining the target of the put
+ *                  operation.
+ * \param src       The local source buffer to load the data from.
+ * \param nelem     The number of elements of type \c dtype to transfer.
+ * \param dtype     The data type of the values in buffer \c src and at the
+ *                  target.
+ * \param flag_gptr A global pointer to the \c DART_TYPE_INT flag to update.
+ * \param value     The value to add to the flag.
+ * \param[out] handle Pointer to DART handle to instantiate for later use
+ *                  with \c dart_wait, \c dart_waitall etc.
+ *
+ * \note Local completion using \c dart_wait_local, \c dart_waitall_local,
+ *       \c dart_test_local or \c dart_testall_local does not update the
+ *       flag.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_put_notify_handle(
+  dart_gptr_t       gptr,
+  const void      * src,
+  size_t            nelem,
+  dart_datatype_t   dtype,
+  dart_gptr_t       flag_gptr,
+  int               value,
+  dart_handle_t   * handle) DART_NOTHROW;
+
 /**
  * Wait for the local and remote completion of an operation.
  *
@@ -716,6 +848,109 @@ dart_ret_t dart_handle_free(
 
 /** \} */
 
+/**
+ * \name Non-blocking collective operations
+ * Collective operations involving all units of a given team that return
+ * a handle instead of blocking until completion.
+ * Completion is guaranteed after a successful call to \ref dart_wait or
+ * \ref dart_test (or any of their variants) on the returned handle.
+ * Buffers passed to these operations must not be accessed before the
+ * operation has completed.
+ */
+
+/** \{ */
+
+/**
+ * DART Equivalent to MPI_Ibarrier.
+ *
+ * \param team   The team to perform a barrier on.
+ * \param handle Pointer to a DART handle instance.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibarrier(
+  dart_team_t     team,
+  dart_handle_t * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ibcast.
+ *
+ * \param buf    Buffer that is the source (on \c root) or the destination of
+ *               the broadcast.
+ * \param nelem  The number of values to broadcast/receive.
+ * \param dtype  The data type of values in \c buf.
+ * \param root   The unit that broadcasts data to all other members in \c team
+ * \param team   The team to participate in the broadcast.
+ * \param handle Pointer to a DART handle instance.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         team,
+  dart_handle_t     * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Iallreduce.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf to use in \c op.
+ * \param op      The reduction operation to perform.
+ * \param team    The team to participate in the allreduce.
+ * \param handle  Pointer to a DART handle instance.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_iallreduce(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_operation_t op,
+  dart_team_t      team,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/**
+ * DART Equivalent to MPI_Ialltoall.
+ *
+ * \param sendbuf The buffer containing the data to be sent by each unit.
+ * \param recvbuf The buffer to hold the received data.
+ * \param nelem   Number of elements sent by each process and received from each unit.
+ *                The value of this parameter must not execeed INT_MAX.
+ * \param dtype   The data type of values in \c sendbuf and \c recvbuf.
+ * \param team    The team to participate in the alltoall.
+ * \param handle  Pointer to a DART handle instance.
+ *
+ * \return \c DART_OK on success, any other of \ref dart_ret_t otherwise.
+ *
+ * \threadsafe_data{team}
+ * \ingroup DartCommunication
+ */
+dart_ret_t dart_ialltoall(
+  const void     * sendbuf,
+  void           * recvbuf,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  dart_team_t      team,
+  dart_handle_t  * handle) DART_NOTHROW;
+
+/** \} */
+
 /**
  * \name Blocking single-sided communication operations
  * These operations will block until completion of put and get is guaranteed.
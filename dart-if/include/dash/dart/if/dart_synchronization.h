@@ -38,6 +38,12 @@ typedef struct dart_lock_struct *dart_lock_t;
 /**
  * Collective operation to initialize the \c lock object.
  *
+ * Units of the team on the same node queue for the lock in shared memory
+ * and the lock is handed over between them for at most
+ * \c DART_LOCK_COHORT_BATCH (default: 64) consecutive acquisitions before
+ * it is passed on to another node. A batch size of 0 disables node-local
+ * queueing.
+ *
  * \param teamid Team this lock is used for.
  * \param lock   The lock to initialize.
  *
@@ -101,8 +107,90 @@ dart_ret_t dart_lock_try_acquire(
   int32_t     * result) DART_NOTHROW;
 
 /**
- * Release the lock acquired through \ref dart_lock_acquire or
- * \ref dart_lock_try_acquire.
+ * Try to acquire the lock for at most \c timeout_us microseconds.
+ *
+ * Note that the lock is not recursive, trying to acquire the lock twice
+ * in the same thread is erroneous.
+ *
+ * \param lock       The lock to acquire
+ * \param timeout_us The maximum time in microseconds to wait for the lock.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * result) DART_NOTHROW;
+
+/**
+ * Block until the \c lock was acquired for shared access.
+ *
+ * Any number of units can hold the lock shared at the same time while no
+ * unit holds it exclusively. Units register as readers on their node only,
+ * admission of readers does not involve communication across nodes.
+ * Units waiting for exclusive access take precedence over readers.
+ *
+ * Note that the lock is not recursive, trying to acquire the lock twice
+ * in the same thread is erroneous. Only one thread of a unit can hold the
+ * lock at once, also in shared mode.
+ *
+ * \param lock The lock to acquire
+ * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
+ *
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_acquire_shared(
+  dart_lock_t   lock)   DART_NOTHROW;
+
+/**
+ * Try to acquire the lock for shared access and return immediately.
+ *
+ * \param lock The lock to acquire
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \see dart_lock_acquire_shared
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_shared(
+  dart_lock_t   lock,
+  int32_t     * result) DART_NOTHROW;
+
+/**
+ * Try to acquire the lock for shared access for at most \c timeout_us
+ * microseconds.
+ *
+ * \param lock       The lock to acquire
+ * \param timeout_us The maximum time in microseconds to wait for the lock.
+ * \param[out] result \c True if the lock was successfully acquired,
+ *             false otherwise.
+ *
+ * \return \c DART_OK on success or an error code from \ref dart_ret_t
+ *         otherwise.
+ *
+ * \see dart_lock_acquire_shared
+ * \threadsafe
+ * \ingroup DartSync
+ */
+dart_ret_t dart_lock_try_acquire_shared_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * result) DART_NOTHROW;
+
+/**
+ * Release the lock acquired exclusively or shared through any of the
+ * \c dart_lock_acquire and \c dart_lock_try_acquire variants.
  *
  * \param lock The lock to release.
  * \return \c DART_OK on sucess or an error code from \ref dart_ret_t otherwise.
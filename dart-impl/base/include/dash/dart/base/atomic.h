@@ -152,6 +152,13 @@
                                       (void    *)(oldval), \
                                       (void    *)(newval))
 
+/**
+ * Full memory barrier, orders all loads and stores before the barrier
+ * before all loads and stores after it.
+ */
+#define DART_MEMORY_BARRIER() \
+          __sync_synchronize()
+
 #else
 
 #define DART_MAYBE_UNUSED __attribute__((unused))
@@ -204,6 +211,17 @@ __fetch_and_addptr(char **ptr, int64_t val) {
 
 
 
+#define DART_FETCH64(ptr) \
+          (*(int64_t *)(ptr))
+#define DART_FETCH32(ptr) \
+          (*(int32_t *)(ptr))
+#define DART_FETCH16(ptr) \
+          (*(int16_t *)(ptr))
+#define DART_FETCH8(ptr)  \
+          (*(int8_t  *)(ptr))
+#define DART_FETCHPTR(ptr) \
+          (*(void   **)(ptr))
+
 #define DART_FETCH_AND_ADD64(ptr, val) \
           __fetch_and_add64((ptr), (val))
 #define DART_FETCH_AND_ADD32(ptr, val) \
@@ -368,6 +386,9 @@ __compare_and_swapptr(void **ptr, void *oldval, void *newval) {
                                 (void    *)(oldval),  \
                                 (void    *)(newval))
 
+#define DART_MEMORY_BARRIER() \
+          do { } while (0)
+
 
 #endif /* DART_HAVE_SYNC_BUILTINS */
 #endif /* DASH_DART_BASE_ATOMIC_H_ */
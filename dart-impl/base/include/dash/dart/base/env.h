@@ -0,0 +1,35 @@
+/**
+ * \file dart/base/env.h
+ *
+ * Access to DART configuration parameters set in the environment.
+ */
+#ifndef DART__BASE__ENV_H__
+#define DART__BASE__ENV_H__
+
+#include <stddef.h>
+
+#include <dash/dart/base/macro.h>
+
+/**
+ * Read a size in bytes from the environment variable \c env.
+ * The value may be suffixed by one of the units \c K, \c M, or \c G
+ * (base 1024, case-insensitive, optionally followed by \c B or \c iB).
+ *
+ * \return The parsed size or \c fallback if \c env is not set or does
+ *         not contain a valid size.
+ */
+size_t dart__base__env__size(
+  const char  * env,
+  size_t        fallback) DART_INTERNAL;
+
+/**
+ * Read a non-negative number from the environment variable \c env.
+ *
+ * \return The parsed number or \c fallback if \c env is not set or does
+ *         not contain a valid number.
+ */
+int dart__base__env__number(
+  const char  * env,
+  int           fallback) DART_INTERNAL;
+
+#endif /* DART__BASE__ENV_H__ */
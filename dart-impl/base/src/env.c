@@ -0,0 +1,71 @@
+/**
+ * \file dart/base/env.c
+ *
+ */
+
+#include <dash/dart/base/env.h>
+#include <dash/dart/base/logging.h>
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <strings.h>
+
+
+size_t dart__base__env__size(
+  const char  * env,
+  size_t        fallback)
+{
+  const char * envstr = getenv(env);
+  if (envstr == NULL || *envstr == '\0') {
+    return fallback;
+  }
+
+  char   * endptr;
+  long long value = strtoll(envstr, &endptr, 10);
+  if (endptr == envstr || value < 0) {
+    DART_LOG_WARN("Invalid size in %s: '%s', using default %zu",
+                  env, envstr, fallback);
+    return fallback;
+  }
+
+  size_t factor = 1;
+  switch (toupper((unsigned char)*endptr)) {
+    case 'G': factor <<= 10; /* fall-through */
+    case 'M': factor <<= 10; /* fall-through */
+    case 'K': factor <<= 10;
+              ++endptr;
+              break;
+    default:  break;
+  }
+  if (*endptr != '\0' &&
+      strcasecmp(endptr, "B") != 0 && strcasecmp(endptr, "iB") != 0) {
+    DART_LOG_WARN("Invalid size in %s: '%s', using default %zu",
+                  env, envstr, fallback);
+    return fallback;
+  }
+
+  DART_LOG_TRACE("dart__base__env__size: %s=%s", env, envstr);
+  return (size_t)value * factor;
+}
+
+int dart__base__env__number(
+  const char  * env,
+  int           fallback)
+{
+  const char * envstr = getenv(env);
+  if (envstr == NULL || *envstr == '\0') {
+    return fallback;
+  }
+
+  char * endptr;
+  long   value = strtol(envstr, &endptr, 10);
+  if (endptr == envstr || *endptr != '\0' || value < 0 || value > INT_MAX) {
+    DART_LOG_WARN("Invalid number in %s: '%s', using default %d",
+                  env, envstr, fallback);
+    return fallback;
+  }
+
+  DART_LOG_TRACE("dart__base__env__number: %s=%s", env, envstr);
+  return (int)value;
+}
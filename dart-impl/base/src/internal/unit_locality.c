@@ -51,9 +51,20 @@
  * Private Functions                                                        *
  * ======================================================================== */
 
+/**
+ * Locality information of all units as exchanged in \c DART_TEAM_ALL.
+ * Unit mappings of the team are modified when its domain hierarchy is
+ * created, so sub-teams are initialized from this unmodified copy.
+ */
+static dart_unit_locality_t * dart__base__unit_locality__all_ = NULL;
+
 dart_ret_t dart__base__unit_locality__init(
   dart_unit_locality_t  * loc);
 
+static dart_ret_t dart__base__unit_locality__derive(
+  dart_team_t             team,
+  dart_unit_mapping_t   * mapping);
+
 dart_ret_t dart__base__unit_locality__local_unit_new(
   dart_team_t             team,
   dart_unit_locality_t  * loc);
@@ -70,7 +81,9 @@ dart_ret_t dart__base__unit_locality__local_unit_new(
  * domain tags.
  *
  * \note
- * This is a collective N-to-N (allgather) operation.
+ * This is a collective N-to-N (allgather) operation for \c DART_TEAM_ALL.
+ * Unit mappings of other teams are derived from the locality information
+ * exchanged in \c DART_TEAM_ALL without communication.
  */
 dart_ret_t dart__base__unit_locality__create(
   dart_team_t             team,
@@ -85,6 +98,25 @@ dart_ret_t dart__base__unit_locality__create(
   DART_ASSERT_RETURNS(dart_team_myid(team, &myid),   DART_OK);
   DART_ASSERT_RETURNS(dart_team_size(team, &nunits), DART_OK);
 
+  if (team != DART_TEAM_ALL && dart__base__unit_locality__all_ != NULL) {
+    dart_unit_mapping_t * mapping = malloc(sizeof(dart_unit_mapping_t));
+    mapping->num_units            = nunits;
+    mapping->team                 = team;
+    mapping->unit_localities      = malloc(nunits *
+                                           sizeof(dart_unit_locality_t));
+    ret = dart__base__unit_locality__derive(team, mapping);
+    if (ret != DART_OK) {
+      DART_LOG_ERROR("dart__base__unit_locality__create ! "
+                     "dart__base__unit_locality__derive failed: %d", ret);
+      dart__base__unit_locality__destruct(mapping);
+      return ret;
+    }
+    *unit_mapping = mapping;
+    DART_LOG_DEBUG("dart__base__unit_locality__create > "
+                   "derived from DART_TEAM_ALL");
+    return DART_OK;
+  }
+
   size_t nbytes = sizeof(dart_unit_locality_t);
 
   /* get local unit's locality information: */
@@ -147,6 +179,14 @@ dart_ret_t dart__base__unit_locality__create(
   }
 #endif
 
+  if (team == DART_TEAM_ALL) {
+    free(dart__base__unit_locality__all_);
+    dart__base__unit_locality__all_ = malloc(nunits *
+                                             sizeof(dart_unit_locality_t));
+    memcpy(dart__base__unit_locality__all_, mapping->unit_localities,
+           nunits * sizeof(dart_unit_locality_t));
+  }
+
   *unit_mapping = mapping;
 
   DART_LOG_DEBUG("dart__base__unit_locality__create >");
@@ -156,10 +196,13 @@ dart_ret_t dart__base__unit_locality__create(
 dart_ret_t dart__base__unit_locality__destruct(
   dart_unit_mapping_t   * unit_mapping)
 {
-  DART_LOG_DEBUG("dart__base__unit_locality__destruct() team: %d",
-                 unit_mapping->team);
+  DART_LOG_DEBUG("dart__base__unit_locality__destruct()");
 
   if (NULL != unit_mapping) {
+    if (unit_mapping->team == DART_TEAM_ALL) {
+      free(dart__base__unit_locality__all_);
+      dart__base__unit_locality__all_ = NULL;
+    }
     if (NULL != unit_mapping->unit_localities) {
       free(unit_mapping->unit_localities);
       unit_mapping->unit_localities = NULL;
@@ -198,6 +241,30 @@ dart_ret_t dart__base__unit_locality__at(
  * Private Functions                                                        *
  * ======================================================================== */
 
+/**
+ * Initialize the locality information of all units in the specified team
+ * from the locality information exchanged in \c DART_TEAM_ALL.
+ */
+static dart_ret_t dart__base__unit_locality__derive(
+  dart_team_t             team,
+  dart_unit_mapping_t   * mapping)
+{
+  for (size_t u = 0; u < mapping->num_units; ++u) {
+    dart_team_unit_t   luid = { (dart_unit_t)u };
+    dart_global_unit_t guid;
+    dart_ret_t ret = dart_team_unit_l2g(team, luid, &guid);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    dart_unit_locality_t * uloc = &mapping->unit_localities[u];
+    *uloc                       = dart__base__unit_locality__all_[guid.id];
+    uloc->unit                  = luid;
+    uloc->team                  = team;
+    uloc->domain_tag[0]         = '\0';
+  }
+  return DART_OK;
+}
+
 /**
  * Initialize unit locality information from HW locality.
  */
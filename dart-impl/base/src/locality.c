@@ -33,21 +33,48 @@
  * Private Data                                                           *
  * ====================================================================== */
 
-#define DART__BASE__LOCALITY__MAX_TEAM_DOMAINS 32
+#define DART__BASE__LOCALITY__TEAM_HASH_SIZE 64
 
-static dart_host_topology_t *
-dart__base__locality__host_topology_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
-
-static dart_unit_mapping_t *
-dart__base__locality__unit_mapping_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
+/**
+ * Locality information of a team, entries are chained in buckets of a
+ * hash table over team IDs so the number of teams is not limited.
+ */
+typedef struct dart__base__locality__team_s {
+  struct dart__base__locality__team_s * next;
+  dart_team_t                           team;
+  dart_host_topology_t                * host_topology;
+  dart_unit_mapping_t                 * unit_mapping;
+  dart_domain_locality_t              * global_domain;
+} dart__base__locality__team_t;
 
-static dart_domain_locality_t *
-dart__base__locality__global_domain_[DART__BASE__LOCALITY__MAX_TEAM_DOMAINS];
+static dart__base__locality__team_t *
+dart__base__locality__teams_[DART__BASE__LOCALITY__TEAM_HASH_SIZE];
 
 /* ====================================================================== *
  * Private Functions                                                      *
  * ====================================================================== */
 
+static inline dart__base__locality__team_t ** dart__base__locality__bucket_(
+  dart_team_t team)
+{
+  return &dart__base__locality__teams_[
+            (unsigned)team % DART__BASE__LOCALITY__TEAM_HASH_SIZE];
+}
+
+/**
+ * The locality information of the specified team, \c NULL if it has not
+ * been created.
+ */
+static dart__base__locality__team_t * dart__base__locality__team_(
+  dart_team_t team)
+{
+  dart__base__locality__team_t * entry = *dart__base__locality__bucket_(team);
+  while (entry != NULL && entry->team != team) {
+    entry = entry->next;
+  }
+  return entry;
+}
+
 static int cmpstr_(const void * p1, const void * p2)
 {
   return strcmp(* (char * const *) p1, * (char * const *) p2);
@@ -71,18 +98,18 @@ dart_ret_t dart__base__locality__group_subdomains(
 
 dart_ret_t dart__base__locality__init()
 {
-  for (int td = 0; td < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++td) {
-    dart__base__locality__global_domain_[td] = NULL;
-    dart__base__locality__host_topology_[td] = NULL;
-    dart__base__locality__unit_mapping_[td]  = NULL;
+  for (int b = 0; b < DART__BASE__LOCALITY__TEAM_HASH_SIZE; ++b) {
+    dart__base__locality__teams_[b] = NULL;
   }
   return dart__base__locality__create(DART_TEAM_ALL);
 }
 
 dart_ret_t dart__base__locality__finalize()
 {
-  for (dart_team_t t = 0; t < DART__BASE__LOCALITY__MAX_TEAM_DOMAINS; ++t) {
-    dart__base__locality__delete(t);
+  for (int b = 0; b < DART__BASE__LOCALITY__TEAM_HASH_SIZE; ++b) {
+    while (dart__base__locality__teams_[b] != NULL) {
+      dart__base__locality__delete(dart__base__locality__teams_[b]->team);
+    }
   }
 
   dart_barrier(DART_TEAM_ALL);
@@ -97,9 +124,8 @@ dart_ret_t dart__base__locality__finalize()
  * Exchange and collect locality information of all units in the specified
  * team.
  *
- * The team's unit locality information is stored in private array
- * \c dart__base__locality__unit_mapping_[team] with a capacity for
- * \c DART__BASE__LOCALITY__MAX_TEAM_DOMAINS teams.
+ * The team's unit locality information is stored in the private hash
+ * table \c dart__base__locality__teams_.
  *
  * Outline of the locality initialization procedure:
  *
@@ -126,16 +152,21 @@ dart_ret_t dart__base__locality__create(
    *       assertion.
    */
   DART_ASSERT_MSG(
-    (NULL == dart__base__locality__unit_mapping_[team]  &&
-     NULL == dart__base__locality__global_domain_[team] &&
-     NULL == dart__base__locality__host_topology_[team]),
+    NULL == dart__base__locality__team_(team),
     "dash__base__locality__create(): "
     "locality data of team is already initialized");
 
+  dart__base__locality__team_t * team_loc =
+    calloc(1, sizeof(dart__base__locality__team_t));
+  dart__base__locality__team_t ** bucket =
+    dart__base__locality__bucket_(team);
+  team_loc->team = team;
+  team_loc->next = *bucket;
+  *bucket        = team_loc;
+
   dart_domain_locality_t * team_global_domain =
     malloc(sizeof(dart_domain_locality_t));
-  dart__base__locality__global_domain_[team] =
-    team_global_domain;
+  team_loc->global_domain = team_global_domain;
 
   /* Initialize the global domain as the root entry in the locality
    * hierarchy:
@@ -170,7 +201,7 @@ dart_ret_t dart__base__locality__create(
   DART_ASSERT_RETURNS(
     dart__base__unit_locality__create(team, &unit_mapping),
     DART_OK);
-  dart__base__locality__unit_mapping_[team] = unit_mapping;
+  team_loc->unit_mapping = unit_mapping;
 
   /* Resolve host topology from the unit's host names:
    */
@@ -178,7 +209,7 @@ dart_ret_t dart__base__locality__create(
   DART_ASSERT_RETURNS(
     dart__base__host_topology__create(unit_mapping, &topo),
     DART_OK);
-  dart__base__locality__host_topology_[team] = topo;
+  team_loc->host_topology = topo;
   size_t num_nodes = topo->num_nodes;
   DART_LOG_TRACE("dart__base__locality__create: nodes: %ld", num_nodes);
 
@@ -207,9 +238,9 @@ dart_ret_t dart__base__locality__create(
    */
   DART_ASSERT_RETURNS(
     dart__base__locality__domain__create_subdomains(
-      dart__base__locality__global_domain_[team],
-      dart__base__locality__host_topology_[team],
-      dart__base__locality__unit_mapping_[team]),
+      team_loc->global_domain,
+      team_loc->host_topology,
+      team_loc->unit_mapping),
     DART_OK);
 
   DART_LOG_DEBUG("dart__base__locality__create >");
@@ -223,47 +254,55 @@ dart_ret_t dart__base__locality__delete(
 
   DART_LOG_DEBUG("dart__base__locality__delete() team(%d)", team);
 
-  if (NULL != dart__base__locality__global_domain_[team]) {
-    ret = dart__base__locality__domain__destruct(
-            dart__base__locality__global_domain_[team]);
+  dart__base__locality__team_t ** prev = dart__base__locality__bucket_(team);
+  while (*prev != NULL && (*prev)->team != team) {
+    prev = &(*prev)->next;
+  }
+  dart__base__locality__team_t * team_loc = *prev;
+  if (NULL == team_loc) {
+    DART_LOG_DEBUG("dart__base__locality__delete > team(%d) not found", team);
+    return DART_OK;
+  }
+  *prev = team_loc->next;
+
+  if (NULL != team_loc->global_domain) {
+    ret = dart__base__locality__domain__destruct(team_loc->global_domain);
     if (ret != DART_OK) {
       DART_LOG_ERROR("dart__base__locality__delete ! "
                      "dart__base__locality__domain_delete failed: %d", ret);
       return ret;
     }
     DART_LOG_DEBUG("dart__base__locality__delete: "
-                   "free(dart__base__locality__global_domain_[%d])", team);
-    free(dart__base__locality__global_domain_[team]);
-    dart__base__locality__global_domain_[team] = NULL;
+                   "free(global_domain) of team %d", team);
+    free(team_loc->global_domain);
+    team_loc->global_domain = NULL;
   }
 
-  if (NULL != dart__base__locality__host_topology_[team]) {
-    ret = dart__base__host_topology__destruct(
-            dart__base__locality__host_topology_[team]);
+  if (NULL != team_loc->host_topology) {
+    ret = dart__base__host_topology__destruct(team_loc->host_topology);
     if (ret != DART_OK) {
       DART_LOG_ERROR("dart__base__locality__delete ! "
                      "dart__base__host_topology__destruct failed: %d", ret);
       return ret;
     }
     DART_LOG_DEBUG("dart__base__locality__delete: "
-                   "free(dart__base__locality__host_topology_[%d])", team);
-    free(dart__base__locality__host_topology_[team]);
-    dart__base__locality__host_topology_[team] = NULL;
+                   "free(host_topology) of team %d", team);
+    free(team_loc->host_topology);
+    team_loc->host_topology = NULL;
   }
 
-  if (NULL != dart__base__locality__unit_mapping_[team]) {
-    ret = dart__base__unit_locality__destruct(
-            dart__base__locality__unit_mapping_[team]);
+  if (NULL != team_loc->unit_mapping) {
+    ret = dart__base__unit_locality__destruct(team_loc->unit_mapping);
     if (ret != DART_OK) {
       DART_LOG_ERROR("dart__base__locality__delete ! "
                      "dart__base__unit_locality__destruct failed: %d", ret);
       return ret;
     }
-    DART_LOG_DEBUG("dart__base__locality__delete: "
-                   "free(dart__base__locality__unit_mapping_[%d])", team);
-    dart__base__locality__unit_mapping_[team] = NULL;
+    team_loc->unit_mapping = NULL;
   }
 
+  free(team_loc);
+
   DART_LOG_DEBUG("dart__base__locality__delete > team(%d)", team);
   return DART_OK;
 }
@@ -280,10 +319,15 @@ dart_ret_t dart__base__locality__team_domain(
   dart_ret_t ret = DART_ERR_NOTFOUND;
 
   *domain_out = NULL;
-  dart_domain_locality_t * domain =
-    dart__base__locality__global_domain_[team];
+  dart__base__locality__team_t * team_loc = dart__base__locality__team_(team);
+  if (NULL == team_loc) {
+    DART_LOG_ERROR("dart__base__locality__team_domain ! "
+                   "no locality information for team %d", team);
+    return DART_ERR_NOTFOUND;
+  }
 
-  ret = dart__base__locality__domain(domain, ".", domain_out);
+  ret = dart__base__locality__domain(
+          team_loc->global_domain, ".", domain_out);
 
   DART_LOG_DEBUG("dart__base__locality__team_domain > "
                  "team(%d) -> domain(%p)", team, (void *)(*domain_out));
@@ -830,10 +874,16 @@ dart_ret_t dart__base__locality__unit(
                  team, unit.id);
   *locality = NULL;
 
+  dart__base__locality__team_t * team_loc = dart__base__locality__team_(team);
+  if (NULL == team_loc) {
+    DART_LOG_ERROR("dart_unit_locality: "
+                   "no locality information for team %d", team);
+    return DART_ERR_NOTFOUND;
+  }
+
   dart_unit_locality_t * uloc;
   dart_ret_t ret = dart__base__unit_locality__at(
-                     dart__base__locality__unit_mapping_[team], unit,
-                     &uloc);
+                     team_loc->unit_mapping, unit, &uloc);
   if (ret != DART_OK) {
     DART_LOG_ERROR("dart_unit_locality: "
                    "dart__base__locality__unit(team:%d unit:%d) "
@@ -12,6 +12,7 @@
 #include <dash/dart/base/macro.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/atomic.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -118,6 +119,8 @@ typedef struct dart_datatype_struct {
       int            * offsets;
       /// the number of blocks
       int              num_blocks;
+      /// the distance in elements between consecutive instances of the type
+      size_t           extent;
     } indexed;
   };
 } dart_datatype_struct_t;
@@ -246,6 +249,20 @@ dart__mpi__datatype_convert_mpi(
 
 char* dart__mpi__datatype_name(dart_datatype_t dart_type) DART_INTERNAL;
 
+/**
+ * Copy \c nelem elements between the memory at \c src laid out according
+ * to \c src_type and the memory at \c dst laid out according to
+ * \c dst_type, executing strided and indexed types without MPI.
+ * Used for transfers between units sharing memory.
+ */
+void
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem) DART_INTERNAL;
+
 /**
  * Helper macro that checks whether the given type is a basic type
  * and errors out in case of an error.
@@ -304,5 +321,138 @@ DART_INLINE MPI_Datatype dart__mpi__op_type(
 }
 
 
+/* -- Write-combining of small puts and accumulates -- */
+
+/**
+ * Name of the environment variable setting the initial size in bytes of
+ * the write-combining buffers, see \ref dart_write_combining.
+ */
+#define DART_WRITE_COMBINING_ENVSTR "DART_WRITE_COMBINING"
+
+/// The capacity in bytes of every write-combining buffer, 0 if disabled.
+/// Modified while holding the write-combining mutex.
+extern size_t dart__mpi__wc_capacity DART_INTERNAL;
+
+/**
+ * Whether write-combining is enabled. Only a hint for skipping the
+ * write-combining paths, staging checks the capacity again while holding
+ * the write-combining mutex.
+ */
+DART_INLINE
+bool dart__mpi__wc_enabled() {
+  return (DART_FETCH64(&dart__mpi__wc_capacity) > 0);
+}
+
+dart_ret_t
+dart__mpi__wc_init() DART_INTERNAL;
+
+dart_ret_t
+dart__mpi__wc_fini() DART_INTERNAL;
+
+/**
+ * Stage a put of \c nbytes bytes at byte displacement \c disp in the
+ * window \c win of unit \c target.
+ *
+ * \return \c true if the put has been staged, \c false if it is too large
+ *         and has to be issued directly.
+ */
+bool
+dart__mpi__wc_put(
+  MPI_Win          win,
+  int              target,
+  MPI_Aint         disp,
+  const void     * src,
+  size_t           nbytes) DART_INTERNAL;
+
+/**
+ * Stage an accumulate of \c nelem elements of basic type \c dtype at byte
+ * displacement \c disp in the window \c win of unit \c target.
+ *
+ * \return \c true if the accumulate has been staged, \c false if it is
+ *         too large and has to be issued directly.
+ */
+bool
+dart__mpi__wc_accumulate(
+  MPI_Win          win,
+  int              target,
+  MPI_Aint         disp,
+  const void     * values,
+  size_t           nelem,
+  dart_datatype_t  dtype,
+  MPI_Op           op) DART_INTERNAL;
+
+/**
+ * Ship all staged transfers to unit \c target in window \c win.
+ * \c MPI_WIN_NULL and negative targets match any window and target.
+ */
+void
+dart__mpi__wc_ship(
+  MPI_Win          win,
+  int              target) DART_INTERNAL;
+
+/**
+ * Ship staged transfers in window \c win and release their buffers,
+ * required before the window is freed.
+ */
+void
+dart__mpi__wc_release(
+  MPI_Win          win) DART_INTERNAL;
+
+
+/* -- Tracking of outstanding operations for flushes -- */
+
+/**
+ * Counters of RMA operations issued on a window, used to skip flushes of
+ * targets without outstanding operations.
+ * Counters only increase: a target is clean if the number of operations
+ * issued to it equals the number recorded at its last completion.
+ */
+typedef struct dart_flush_tracker {
+  /// number of operations issued to every target
+  uint64_t * issued;
+  /// number of operations issued to every target at its last flush
+  uint64_t * completed;
+  /// number of operations issued to every target at its last local flush
+  uint64_t * completed_local;
+  /// number of operations issued to any target
+  uint64_t   num_issued;
+  /// number of operations issued to any target at the last flush of all
+  /// targets
+  uint64_t   num_completed;
+  /// number of operations issued to any target at the last local flush of
+  /// all targets
+  uint64_t   num_completed_local;
+  /// number of targets
+  int        size;
+} dart_flush_tracker_t;
+
+/**
+ * Create a tracker for a window spanning \c size units.
+ */
+dart_flush_tracker_t *
+dart__mpi__flush_tracker_create(
+  int                     size) DART_INTERNAL;
+
+void
+dart__mpi__flush_tracker_destroy(
+  dart_flush_tracker_t ** tracker) DART_INTERNAL;
+
+/**
+ * Record an operation issued to unit \c target that requires a flush to
+ * complete. Operations on untracked windows (\c tracker is \c NULL) are
+ * always flushed.
+ */
+DART_INLINE
+void dart__mpi__flush_tracker_issue(
+  dart_flush_tracker_t  * tracker,
+  int                     target)
+{
+  if (tracker != NULL) {
+    DART_FETCH_AND_INC64(&tracker->issued[target]);
+    DART_FETCH_AND_INC64(&tracker->num_issued);
+  }
+}
+
+
 
 #endif /* DART_ADAPT_COMMUNICATION_PRIV_H_INCLUDED */
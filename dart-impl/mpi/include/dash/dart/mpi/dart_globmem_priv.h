@@ -2,11 +2,37 @@
 #define DART__MPI__DART_GLOBMEM_PRIV_H__
 
 #include <dash/dart/base/macro.h>
+#include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_segment.h>
 #include <mpi.h>
 
 /* Global object for one-sided communication on memory region allocated with 'local allocation'. */
 extern MPI_Win dart_win_local_alloc DART_INTERNAL;
 
+/**
+ * Default size of the memory pool reserved for non-collective allocations
+ * in \c dart_memalloc, can be overridden by setting the environment
+ * variable \c DART_LOCAL_ALLOC_SIZE.
+ */
+#define DART_LOCAL_ALLOC_SIZE (1024UL*1024*16)
+
+#define DART_LOCAL_ALLOC_SIZE_ENVSTR "DART_LOCAL_ALLOC_SIZE"
+
+/**
+ * Register the segment used for memory chunks chained to the local
+ * allocation pool once it is exhausted. Chunks of at least \c chunk_size
+ * bytes are attached to the dynamic window of \c DART_TEAM_ALL on demand.
+ */
+dart_ret_t dart__mpi__localalloc_ext_init(
+  dart_team_data_t * team_data,
+  size_t             chunk_size) DART_INTERNAL;
+
+/**
+ * Detach and release all memory chunks chained to the local allocation pool.
+ */
+dart_ret_t dart__mpi__localalloc_ext_fini(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
 /**
  * Check that the window support MPI_WIN_UNIFIED, print warning otherwise.
  * Store the result in \c segment->sync_needed.
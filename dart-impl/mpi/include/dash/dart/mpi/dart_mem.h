@@ -38,6 +38,18 @@ dart_buddy_new(size_t size) DART_INTERNAL;
  */
 void dart_buddy_delete(struct dart_buddy *) DART_INTERNAL;
 
+/**
+ * Enable per-thread caches of small size classes in front of the buddy
+ * tree of the given allocator instance.
+ *
+ * Free objects are linked in the managed memory starting at \c base.
+ * The front end can only be enabled for a single allocator instance at
+ * a time.
+ *
+ * \return 0 if the front end has been enabled, -1 otherwise.
+ */
+int dart_buddy_enable_cache(struct dart_buddy *, char * base) DART_INTERNAL;
+
 /**
  * Allocate memory from the external memory pool.
  *
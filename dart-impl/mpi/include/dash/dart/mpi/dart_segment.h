@@ -15,7 +15,11 @@
 
 typedef int16_t dart_segid_t;
 
-#define DART_SEGMENT_HASH_SIZE 256
+/**
+ * Initial number of entries in the segment tables of a team, tables grow
+ * by doubling their capacity.
+ */
+#define DART_SEGMENT_TABLE_INIT_SIZE 64
 
 typedef struct
 {
@@ -29,16 +33,28 @@ typedef struct
   dart_segid_t segid;       /* ID of the segment, globally unique in a team */
   bool         is_dynamic;  /* whether this is a shared memory segment */
   bool         sync_needed; /* whether a call to MPI_WIN_SYNC is needed */
+  /* outstanding operations on win, NULL if flushes are not skipped */
+  struct dart_flush_tracker * tracker;
 } dart_segment_info_t;
 
 // forward declaration to make the compiler happy
-typedef struct dart_seghash_elem dart_seghash_elem_t;
+typedef struct dart_segment_elem dart_segment_elem_t;
 
 typedef struct {
-  dart_seghash_elem_t * hashtab[DART_SEGMENT_HASH_SIZE];
+  /**
+   * Segments indexed by their ID, allocated segments (including the local
+   * allocation segment \c DART_SEGMENT_LOCAL) in \c mem_segs and
+   * registered segments in \c reg_segs at index \c -segid.
+   */
+  dart_segment_elem_t ** mem_segs;
+  dart_segment_elem_t ** reg_segs;
+  int                    mem_capacity;
+  int                    reg_capacity;
+  /// the segment of chained local allocation chunks, if any
+  dart_segment_elem_t  * local_ext_seg;
   dart_team_t           team_id;
-  dart_seghash_elem_t * mem_freelist;
-  dart_seghash_elem_t * reg_freelist;
+  dart_segment_elem_t * mem_freelist;
+  dart_segment_elem_t * reg_freelist;
 
   /**
    * For DART collective allocation/free: offset in the returned gptr
@@ -55,13 +71,24 @@ typedef struct {
 
 typedef enum {
   DART_SEGMENT_LOCAL_ALLOC,
+  DART_SEGMENT_LOCAL_ALLOC_EXT,
   DART_SEGMENT_ALLOC,
   DART_SEGMENT_REGISTER
 } dart_segment_type;
 
+/**
+ * Segment ID of the memory chunks chained to the local allocation pool
+ * once it is exhausted. The offset of global pointers into this segment is
+ * the absolute address of the allocation in the dynamic window of
+ * \c DART_TEAM_ALL.
+ * Registered segment IDs are allocated downwards from -1 and never reach
+ * this value.
+ */
+#define DART_SEGMENT_LOCAL_EXT ((dart_segid_t)INT16_MIN)
+
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data tables.
  */
 dart_ret_t dart_segment_init(
   dart_segmentdata_t *segdata,
@@ -85,12 +112,27 @@ dart_segment_register(
   dart_segmentdata_t  *segdata,
   dart_segment_info_t *seg) DART_INTERNAL;
 
+/**
+ * Resolves the segment with ID \c segid in the segment tables.
+ * Use \c dart_segment_get_info instead.
+ */
+dart_segment_info_t * dart_segment_lookup(
+  dart_segmentdata_t *segdata,
+  dart_segid_t        segid) DART_INTERNAL;
+
 /**
  * Returns the segment info for the segment with ID \c segid.
+ *
+ * Segments are resolved in constant time, independent of the number of
+ * segments allocated in the team.
  */
+static inline
 dart_segment_info_t * dart_segment_get_info(
   dart_segmentdata_t *segdata,
-  dart_segid_t        segid) DART_INTERNAL;
+  dart_segid_t        segid)
+{
+  return dart_segment_lookup(segdata, segid);
+}
 
 /**
  * Returns the segment's displacement at unit \c team_unit_id.
@@ -179,7 +221,7 @@ dart_ret_t dart_segment_free(
 
 
 /**
- * Clear the segment data hash table.
+ * Clear the segment data tables.
  */
 dart_ret_t dart_segment_fini(dart_segmentdata_t *segdata) DART_INTERNAL;
 
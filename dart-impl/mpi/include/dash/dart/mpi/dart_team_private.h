@@ -139,6 +139,7 @@
 #define DART_ADAPT_TEAM_PRIVATE_H_INCLUDED
 
 #include <mpi.h>
+#include <stdbool.h>
 #include <dash/dart/base/logging.h>
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/mpi/dart_segment.h>
@@ -149,8 +150,6 @@ extern dart_team_t dart_next_availteamid DART_INTERNAL;
 extern MPI_Comm dart_comm_world DART_INTERNAL;
 #define DART_COMM_WORLD dart_comm_world
 
-#define DART_MAX_TEAM_NUMBER (256)
-
 typedef struct dart_team_data {
 
   struct dart_team_data *next;
@@ -161,21 +160,30 @@ typedef struct dart_team_data {
   MPI_Comm comm;
 
   /**
-   * @brief MPI dynamic window object corresponding this team.
+   * @brief MPI dynamic window object corresponding this team, created on
+   * the first collective allocation or registration in the team.
+   * MPI_WIN_NULL until then.
    */
   MPI_Win window;
 
+  /**
+   * @brief Outstanding operations on the dynamic window.
+   */
+  struct dart_flush_tracker *tracker;
+
   dart_segmentdata_t segdata;
 
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /**
    * @brief Store the sub-communicator with regard to certain node, where the units can
    * communicate via shared memory.
+   * Created on the first collective allocation in the team.
    */
   MPI_Comm sharedmem_comm;
 
   /**
    * @brief Hash table to determine the units who are located in the same node.
+   * NULL until \c sharedmem_comm has been created.
    */
   dart_team_unit_t *sharedmem_tab;
 
@@ -196,28 +204,26 @@ typedef struct dart_team_data {
 
 } dart_team_data_t;
 
-/* @brief Initiate the free-team-list and allocated-team-list.
+/* @brief Initiate the team list.
  *
- * This call will be invoked within dart_init(), and the free teamlist consist of
- * 256 nodes with index ranging from 0 to 255. The allocated teamlist array is set to
- * be empty.
+ * This call will be invoked within dart_init(). Team data is kept in a hash
+ * table with chained entries, the number of teams is not limited.
  */
 dart_ret_t dart_adapt_teamlist_init() DART_INTERNAL;
 
-/* @brief Destroy the free-team-list and allocated-team-list.
+/* @brief Destroy the team list.
  *
- * This call will be invoked within dart_eixt(), and the free teamlist is freed,
- * the allocated teamlist array is reset back to be empty.
+ * This call will be invoked within dart_exit(), the team data of all teams
+ * and the communicators of destroyed teams kept for reuse are freed.
  */
 dart_ret_t dart_adapt_teamlist_destroy() DART_INTERNAL;
 
-/* @brief Allocate the first available index from the free-team-list.
+/* @brief Allocate the team data of a newly created team.
  *
  * This call will be invoked when a team with teamid is created, and only
  * the units belonging to the given teamid can enter this call.
  *
  * @param[in]  teamid  The newly created team ID.
- * @param[out] index   The unique ID related to the newly created team.
  */
 dart_ret_t dart_adapt_teamlist_alloc(dart_team_t teamid) DART_INTERNAL;
 
@@ -233,14 +239,51 @@ dart_adapt_teamlist_dealloc(dart_team_t teamid) DART_INTERNAL;
 dart_team_data_t *
 dart_adapt_teamlist_get(dart_team_t teamid) DART_INTERNAL;
 
+/*
+ * Collectively create the dynamic window of the given \c team_data unless
+ * it already exists.
+ * Teams only pay for the window once they allocate or register global
+ * memory.
+ */
+dart_ret_t dart_allocate_team_window(
+  dart_team_data_t *team_data) DART_INTERNAL;
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 /*
- * Allocate shared memory communicator for the given \c team_data.
- * Shared between \c dart_initialize and \c dart_team_create.
+ * Collectively allocate the shared memory communicator for the given
+ * \c team_data unless it already exists.
+ * Shared between \c dart_initialize and the collective allocation.
  */
 dart_ret_t dart_allocate_shared_comm(
   dart_team_data_t *team_data) DART_INTERNAL;
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/*
+ * Whether the communicator of a destroyed team with units identical to
+ * \c group (in the same order) is available for reuse.
+ */
+bool dart_team_comm_cache_contains(
+  MPI_Group group) DART_INTERNAL;
+
+/*
+ * Move the communicator of a destroyed team with units identical to
+ * \c group and its shared memory communicator to \c team_data.
+ *
+ * \return \c true if a communicator has been found.
+ */
+bool dart_team_comm_cache_take(
+  MPI_Group          group,
+  dart_team_data_t * team_data) DART_INTERNAL;
+
+/*
+ * Keep the communicators of the destroyed team \c team_data for reuse by
+ * teams created later with the same units, or release them if the cache
+ * of any unit in the team is full.
+ * Collective on the team. Cached communicators are released in
+ * \c dart_adapt_teamlist_destroy.
+ */
+void dart_team_comm_cache_put(
+  dart_team_data_t * team_data) DART_INTERNAL;
+
 #endif /*DART_ADAPT_TEAMNODE_H_INCLUDED*/
 
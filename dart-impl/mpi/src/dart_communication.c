@@ -94,7 +94,7 @@
     free(__ptr);                     \
   } while (0)
 
-/** DART handle type for non-blocking one-sided operations. */
+/** DART handle type for non-blocking one-sided and collective operations. */
 struct dart_handle_struct
 {
   MPI_Request reqs[2];   // a large transfer might consist of two operations
@@ -102,6 +102,10 @@ struct dart_handle_struct
   dart_unit_t dest;
   uint8_t     num_reqs;
   bool        needs_flush;
+  dart_flush_tracker_t * tracker; // tracker of the segment written to
+  bool        notify;        // whether the flag below is notified
+  int         notify_value;  // value to add to the flag on completion
+  dart_gptr_t notify_gptr;   // flag to notify on completion
 };
 
 /**
@@ -126,7 +130,8 @@ static dart_ret_t get_shared_mem(
     uint64_t                    offset,
     dart_team_unit_t            unitid,
     size_t                      nelem,
-    dart_datatype_t             dtype)
+    dart_datatype_t             src_type,
+    dart_datatype_t             dst_type)
 {
   DART_LOG_DEBUG("dart_get: using shared memory window in segment %d enabled",
       seginfo->segid);
@@ -134,9 +139,15 @@ static dart_ret_t get_shared_mem(
   char *           baseptr = seginfo->baseptr[luid.id];
 
   baseptr += offset;
-  DART_LOG_DEBUG(
-      "dart_get: memcpy %zu bytes", nelem * dart__mpi__datatype_sizeof(dtype));
-  memcpy(dest, baseptr, nelem * dart__mpi__datatype_sizeof(dtype));
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    DART_LOG_DEBUG("dart_get: memcpy %zu bytes",
+        nelem * dart__mpi__datatype_sizeof(src_type));
+    memcpy(dest, baseptr, nelem * dart__mpi__datatype_sizeof(src_type));
+  } else {
+    DART_LOG_DEBUG("dart_get: shared memory copy of %zu elements", nelem);
+    dart__mpi__datatype_copy(dest, dst_type, baseptr, src_type, nelem);
+  }
   return DART_OK;
 }
 
@@ -147,21 +158,67 @@ static dart_ret_t put_shared_mem(
     uint64_t                    offset,
     dart_team_unit_t            unitid,
     size_t                      nelem,
-    dart_datatype_t             dtype)
+    dart_datatype_t             src_type,
+    dart_datatype_t             dst_type)
 {
-  DART_LOG_DEBUG("dart_get: using shared memory window in segment %d enabled",
+  DART_LOG_DEBUG("dart_put: using shared memory window in segment %d enabled",
       seginfo->segid);
   dart_team_unit_t luid    = team_data->sharedmem_tab[unitid.id];
   char *           baseptr = seginfo->baseptr[luid.id];
 
   baseptr += offset;
-  DART_LOG_DEBUG(
-      "dart_get: memcpy %zu bytes", nelem * dart__mpi__datatype_sizeof(dtype));
-  memcpy(baseptr, src, nelem * dart__mpi__datatype_sizeof(dtype));
+  if (dart__mpi__datatype_iscontiguous(src_type) &&
+      dart__mpi__datatype_iscontiguous(dst_type)) {
+    DART_LOG_DEBUG("dart_put: memcpy %zu bytes",
+        nelem * dart__mpi__datatype_sizeof(src_type));
+    memcpy(baseptr, src, nelem * dart__mpi__datatype_sizeof(src_type));
+  } else {
+    DART_LOG_DEBUG("dart_put: shared memory copy of %zu elements", nelem);
+    dart__mpi__datatype_copy(baseptr, dst_type, src, src_type, nelem);
+  }
   return DART_OK;
 }
 #endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 
+/**
+ * Whether puts and gets to the given unit and segment are issued as MPI
+ * RMA operations, i.e. the target is neither the calling unit nor
+ * reachable through shared memory.
+ */
+static inline
+  bool
+dart__mpi__is_rma_target(
+    const dart_team_data_t    * team_data,
+    dart_team_unit_t            team_unit_id,
+    const dart_segment_info_t * seginfo)
+{
+  if (team_data->unitid == team_unit_id.id) {
+    return false;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 &&
+      team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    return false;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  return true;
+}
+
+/**
+ * Whether transfers to the given unit and segment may be staged in a
+ * write-combining buffer.
+ */
+static inline
+  bool
+dart__mpi__wc_stageable(
+    const dart_team_data_t    * team_data,
+    dart_team_unit_t            team_unit_id,
+    const dart_segment_info_t * seginfo)
+{
+  return dart__mpi__wc_enabled() &&
+         dart__mpi__is_rma_target(team_data, team_unit_id, seginfo);
+}
+
 /**
  * Internal implementations of put/get with and without handles for
  * basic data types and complex data types.
@@ -234,7 +291,7 @@ dart__mpi__get_basic(
   DART_LOG_DEBUG("dart_get: shared windows enabled");
   if (seginfo->segid >= 0 && team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
     return get_shared_mem(team_data, seginfo, dest, offset,
-        team_unit_id, nelem, dtype);
+        team_unit_id, nelem, dtype, dtype);
   }
 #else
   DART_LOG_DEBUG("dart_get: shared windows disabled");
@@ -287,6 +344,7 @@ dart__mpi__get_basic(
 static inline
   dart_ret_t
 dart__mpi__get_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     void                      * dest,
@@ -299,6 +357,23 @@ dart__mpi__get_complex(
 {
   if (num_reqs != NULL) *num_reqs = 0;
 
+  if (team_data->unitid == team_unit_id.id) {
+    // copy directly if we are on the same unit
+    dart__mpi__datatype_copy(dest, dst_type,
+        seginfo->selfbaseptr + offset, src_type, nelem);
+    DART_LOG_DEBUG("dart_get: local copy nelem:%zu "
+        "source (coll.): offset:%lu -> dest: %p",
+        nelem, offset, dest);
+    return DART_OK;
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 && team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    return get_shared_mem(team_data, seginfo, dest, offset,
+        team_unit_id, nelem, src_type, dst_type);
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
   MPI_Win win     = seginfo->win;
   char * dest_ptr = (char*) dest;
   offset         += dart_segment_disp(seginfo, team_unit_id);
@@ -368,7 +443,7 @@ dart__mpi__put_basic(
   if (seginfo->segid >= 0 && team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
     if (flush_required_ptr) *flush_required_ptr = false;
     return put_shared_mem(team_data, seginfo, src, offset,
-        team_unit_id, nelem, dtype);
+        team_unit_id, nelem, dtype, dtype);
   }
 #else
   DART_LOG_DEBUG("dart_put: shared windows disabled");
@@ -425,6 +500,7 @@ dart__mpi__put_basic(
 static inline
   dart_ret_t
 dart__mpi__put_complex(
+    const dart_team_data_t    * team_data,
     dart_team_unit_t            team_unit_id,
     const dart_segment_info_t * seginfo,
     const void                * src,
@@ -436,9 +512,28 @@ dart__mpi__put_complex(
     uint8_t                   * num_reqs,
     bool                      * flush_required_ptr)
 {
-  if (flush_required_ptr) *flush_required_ptr = true;
   if (num_reqs) *num_reqs = 0;
 
+  /* copy data directly if we are on the same unit */
+  if (team_unit_id.id == team_data->unitid) {
+    if (flush_required_ptr) *flush_required_ptr = false;
+    dart__mpi__datatype_copy(seginfo->selfbaseptr + offset, dst_type,
+        src, src_type, nelem);
+    DART_LOG_DEBUG("dart_put: local copy nelem:%zu (from global allocation)"
+        "offset: %"PRIu64"", nelem, offset);
+    return DART_OK;
+  }
+
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (seginfo->segid >= 0 && team_data->sharedmem_tab[team_unit_id.id].id >= 0) {
+    if (flush_required_ptr) *flush_required_ptr = false;
+    return put_shared_mem(team_data, seginfo, src, offset,
+        team_unit_id, nelem, src_type, dst_type);
+  }
+#endif /* !defined(DART_MPI_DISABLE_SHARED_WINDOWS) */
+
+  if (flush_required_ptr) *flush_required_ptr = true;
+
   MPI_Win win            = seginfo->win;
   const char * src_ptr   = (const char*) src;
   offset                += dart_segment_disp(seginfo, team_unit_id);
@@ -527,10 +622,15 @@ dart_ret_t dart_get(
         offset, nelem, src_type, NULL, NULL);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type, NULL, NULL);
   }
 
+  if (ret == DART_OK &&
+      dart__mpi__is_rma_target(team_data, team_unit_id, seginfo)) {
+    dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+  }
+
   DART_LOG_DEBUG("dart_get > finished");
   return ret;
 }
@@ -566,20 +666,105 @@ dart_ret_t dart_put(
   }
 
   dart_ret_t ret = DART_OK;
+  bool needs_flush = false;
 
   if (dart__mpi__datatype_iscontiguous(src_type) &&
       dart__mpi__datatype_iscontiguous(dst_type)) {
+    if (dart__mpi__wc_stageable(team_data, team_unit_id, seginfo) &&
+        dart__mpi__wc_put(
+          seginfo->win, team_unit_id.id,
+          offset + dart_segment_disp(seginfo, team_unit_id), src,
+          nelem * dart__mpi__datatype_sizeof(src_type))) {
+      DART_LOG_TRACE("dart_put: staged %zu elements for unit %d",
+                     nelem, team_unit_id.id);
+      dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+      return DART_OK;
+    }
     // fast path for basic data types
     ret = dart__mpi__put_basic(team_data, team_unit_id, seginfo, src,
         offset, nelem, src_type,
-        NULL, NULL, NULL);
+        NULL, NULL, &needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
         offset, nelem, src_type, dst_type,
-        NULL, NULL, NULL);
+        NULL, NULL, &needs_flush);
+  }
+
+  if (ret == DART_OK && needs_flush) {
+    dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+  }
+
+  return ret;
+}
+
+dart_ret_t dart_put_notify(
+    dart_gptr_t       gptr,
+    const void      * src,
+    size_t            nelem,
+    dart_datatype_t   dtype,
+    dart_gptr_t       flag_gptr,
+    int               value)
+{
+  DART_LOG_DEBUG("dart_put_notify() nelem:%zu dtype:%ld unit:%d "
+                 "flag unit:%d", nelem, dtype, gptr.unitid, flag_gptr.unitid);
+
+  dart_ret_t ret = dart_put(gptr, src, nelem, dtype, dtype);
+  if (ret != DART_OK) {
+    return ret;
   }
 
+  // Accumulates are only ordered with respect to accumulates on the same
+  // target location, so the data has to be completed before the flag is
+  // updated. This is a no-op for targets reachable through shared memory.
+  ret = dart_flush(gptr);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  // order stores to shared memory before the flag update
+  DART_MEMORY_BARRIER();
+
+  // the flag update is completed by the caller's flush, like any
+  // accumulate operation
+  ret = dart_accumulate(flag_gptr, &value, 1, DART_TYPE_INT, DART_OP_SUM);
+
+  DART_LOG_DEBUG("dart_put_notify > finished");
+  return ret;
+}
+
+dart_ret_t dart_put_notify_handle(
+    dart_gptr_t       gptr,
+    const void      * src,
+    size_t            nelem,
+    dart_datatype_t   dtype,
+    dart_gptr_t       flag_gptr,
+    int               value,
+    dart_handle_t   * handleptr)
+{
+  DART_LOG_DEBUG("dart_put_notify_handle() nelem:%zu dtype:%ld unit:%d "
+                 "flag unit:%d", nelem, dtype, gptr.unitid, flag_gptr.unitid);
+
+  dart_ret_t ret = dart_put_handle(gptr, src, nelem, dtype, dtype,
+                                   handleptr);
+  if (ret != DART_OK) {
+    return ret;
+  }
+  if (*handleptr == DART_HANDLE_NULL) {
+    // the data has been written to shared memory already
+    DART_MEMORY_BARRIER();
+    ret = dart_accumulate(flag_gptr, &value, 1, DART_TYPE_INT, DART_OP_SUM);
+    if (ret != DART_OK) {
+      return ret;
+    }
+    ret = dart_flush(flag_gptr);
+  } else {
+    (*handleptr)->notify       = true;
+    (*handleptr)->notify_value = value;
+    (*handleptr)->notify_gptr  = flag_gptr;
+  }
+
+  DART_LOG_DEBUG("dart_put_notify_handle > handle(%p)",
+                 (void*)(*handleptr));
   return ret;
 }
 
@@ -625,6 +810,18 @@ dart_ret_t dart_accumulate(
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
+  if (dart__mpi__wc_stageable(team_data, team_unit_id, seginfo)) {
+    if (dart__mpi__wc_accumulate(win, team_unit_id.id, offset,
+                                 values, nelem, dtype, mpi_op)) {
+      DART_LOG_TRACE("dart_accumulate: staged %zu elements for unit %d",
+                     nelem, team_unit_id.id);
+      dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+      return DART_OK;
+    }
+    // preserve the order of accumulates to the target
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
   // chunk up the put
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -668,6 +865,8 @@ dart_ret_t dart_accumulate(
         "MPI_Accumulate");
   }
 
+  dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+
   DART_LOG_DEBUG("dart_accumulate > finished");
   return DART_OK;
 }
@@ -716,6 +915,11 @@ dart_ret_t dart_accumulate_blocking_local(
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
+  if (dart__mpi__wc_enabled()) {
+    // preserve the order of accumulates to the target
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
   // chunk up the put
   const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
   const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
@@ -766,6 +970,9 @@ dart_ret_t dart_accumulate_blocking_local(
 
   MPI_Waitall(num_reqs, reqs, MPI_STATUSES_IGNORE);
 
+  // remote completion still requires a flush
+  dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+
   DART_LOG_DEBUG("dart_accumulate > finished");
   return DART_OK;
 }
@@ -818,6 +1025,11 @@ dart_ret_t dart_fetch_and_op(
   MPI_Win win = seginfo->win;
   offset     += dart_segment_disp(seginfo, team_unit_id);
 
+  if (dart__mpi__wc_enabled()) {
+    // preserve the order of accumulates to the target
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
   CHECK_MPI_RET(
       MPI_Fetch_and_op(
         value,             // Origin address
@@ -830,6 +1042,8 @@ dart_ret_t dart_fetch_and_op(
         win),
       "MPI_Fetch_and_op");
 
+  dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+
   DART_LOG_DEBUG("dart_fetch_and_op > finished");
   return DART_OK;
 }
@@ -876,6 +1090,11 @@ dart_ret_t dart_compare_and_swap(
   MPI_Win win  = seginfo->win;
   offset      += dart_segment_disp(seginfo, team_unit_id);
 
+  if (dart__mpi__wc_enabled()) {
+    // preserve the order of accumulates to the target
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
   CHECK_MPI_RET(
       MPI_Compare_and_swap(
         value,
@@ -886,6 +1105,9 @@ dart_ret_t dart_compare_and_swap(
         offset,
         win),
       "MPI_Compare_and_swap");
+
+  dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+
   DART_LOG_DEBUG("dart_compare_and_swap > finished");
   return DART_OK;
 }
@@ -948,7 +1170,7 @@ dart_ret_t dart_get_handle(
         handle->reqs, &handle->num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
         offset, nelem, src_type, dst_type,
         handle->reqs, &handle->num_reqs);
   }
@@ -1005,6 +1227,7 @@ dart_ret_t dart_put_handle(
   handle->dest           = team_unit_id.id;
   handle->win            = win;
   handle->needs_flush    = true;
+  handle->tracker        = seginfo->tracker;
 
   dart_ret_t ret = DART_OK;
 
@@ -1018,13 +1241,18 @@ dart_ret_t dart_put_handle(
                                &handle->needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  handle->reqs,
                                  &handle->num_reqs,
                                  &handle->needs_flush);
   }
 
+  if (ret == DART_OK && handle->needs_flush) {
+    // remote completion through dart_flush instead of dart_wait
+    dart__mpi__flush_tracker_issue(seginfo->tracker, team_unit_id.id);
+  }
+
   if (handle->num_reqs == 0) {
     free(handle);
     handle = DART_HANDLE_NULL;
@@ -1089,7 +1317,7 @@ dart_ret_t dart_put_blocking(
                                NULL, NULL, &needs_flush);
   } else {
     // slow path for complex data types
-    ret = dart__mpi__put_complex(team_unit_id, seginfo, src,
+    ret = dart__mpi__put_complex(team_data, team_unit_id, seginfo, src,
                                  offset, nelem, src_type, dst_type,
                                  NULL, NULL, &needs_flush);
   }
@@ -1155,7 +1383,7 @@ dart_ret_t dart_get_blocking(
                                reqs, &num_reqs);
   } else {
     // slow path for derived types
-    ret = dart__mpi__get_complex(team_unit_id, seginfo, dest,
+    ret = dart__mpi__get_complex(team_data, team_unit_id, seginfo, dest,
                                  offset, nelem, src_type, dst_type,
                                  reqs, &num_reqs);
   }
@@ -1171,6 +1399,206 @@ dart_ret_t dart_get_blocking(
 
 /* -- Dart RMA Synchronization Operations -- */
 
+/**
+ * The maximum number of targets flushed individually by \c dart_flush_all
+ * and \c dart_flush_local_all, windows with more targets with outstanding
+ * operations are flushed entirely.
+ */
+#define DART_FLUSH_MAX_TARGETS 16
+
+dart_flush_tracker_t *
+dart__mpi__flush_tracker_create(
+  int size)
+{
+  dart_flush_tracker_t * tracker = malloc(sizeof(dart_flush_tracker_t));
+  tracker->issued          = calloc(size, sizeof(uint64_t));
+  tracker->completed       = calloc(size, sizeof(uint64_t));
+  tracker->completed_local = calloc(size, sizeof(uint64_t));
+  tracker->num_issued          = 0;
+  tracker->num_completed       = 0;
+  tracker->num_completed_local = 0;
+  tracker->size            = size;
+  return tracker;
+}
+
+void
+dart__mpi__flush_tracker_destroy(
+  dart_flush_tracker_t ** tracker)
+{
+  if (*tracker != NULL) {
+    free((*tracker)->issued);
+    free((*tracker)->completed);
+    free((*tracker)->completed_local);
+    free(*tracker);
+    *tracker = NULL;
+  }
+}
+
+/**
+ * Advances the completion counter \c completed to \c issued unless a
+ * concurrent flush has already advanced it further.
+ */
+static inline
+  void
+dart__mpi__flush_tracker_advance(
+  uint64_t * completed,
+  uint64_t   issued)
+{
+  uint64_t current = DART_FETCH64(completed);
+  while (current < issued) {
+    uint64_t prev = DART_COMPARE_AND_SWAP64(completed, current, issued);
+    if (prev == current) {
+      break;
+    }
+    current = prev;
+  }
+}
+
+/**
+ * Whether operations issued to \c target are outstanding. Stores the
+ * number of operations issued to \c target in \c issued, the caller has
+ * to flush the target and then call \c dart__mpi__flush_target_end.
+ */
+static inline
+  bool
+dart__mpi__flush_target_begin(
+  dart_flush_tracker_t * tracker,
+  int                    target,
+  bool                   local,
+  uint64_t             * issued)
+{
+  if (tracker == NULL) {
+    return true;
+  }
+  uint64_t * completed = (local) ? tracker->completed_local
+                                 : tracker->completed;
+  *issued = DART_FETCH64(&tracker->issued[target]);
+  return (*issued != DART_FETCH64(&completed[target]));
+}
+
+/**
+ * Marks the operations counted in \c issued by
+ * \c dart__mpi__flush_target_begin as completed after the flush of
+ * \c target.
+ */
+static inline
+  void
+dart__mpi__flush_target_end(
+  dart_flush_tracker_t * tracker,
+  int                    target,
+  bool                   local,
+  uint64_t               issued)
+{
+  if (tracker == NULL) {
+    return;
+  }
+  if (!local) {
+    dart__mpi__flush_tracker_advance(&tracker->completed[target], issued);
+  }
+  // remote completion implies local completion
+  dart__mpi__flush_tracker_advance(&tracker->completed_local[target],
+                                   issued);
+}
+
+/**
+ * Snapshot of the operations issued to a window, taken before a flush
+ * of all targets.
+ */
+typedef struct {
+  /// number of operations issued to any target
+  uint64_t   num_issued;
+  /// targets with outstanding operations
+  int        targets[DART_FLUSH_MAX_TARGETS];
+  /// number of operations issued to every target in \c targets
+  uint64_t   issued[DART_FLUSH_MAX_TARGETS];
+  /// number of operations issued to every target of the window if the
+  /// entire window is flushed, NULL otherwise
+  uint64_t * issued_all;
+} dart_flush_snapshot_t;
+
+/**
+ * Collects the targets with outstanding operations and the number of
+ * operations issued to them in \c snapshot, the caller has to flush them
+ * and then call \c dart__mpi__flush_all_end.
+ *
+ * \return The number of targets with outstanding operations or -1 if
+ *         the entire window has to be flushed.
+ */
+static
+  int
+dart__mpi__flush_all_begin(
+  dart_flush_tracker_t  * tracker,
+  bool                    local,
+  dart_flush_snapshot_t * snapshot)
+{
+  snapshot->issued_all = NULL;
+  if (tracker == NULL) {
+    return -1;
+  }
+  uint64_t * num_completed = (local) ? &tracker->num_completed_local
+                                     : &tracker->num_completed;
+  snapshot->num_issued = DART_FETCH64(&tracker->num_issued);
+  if (snapshot->num_issued == DART_FETCH64(num_completed)) {
+    return 0;
+  }
+  uint64_t * completed = (local) ? tracker->completed_local
+                                 : tracker->completed;
+  int num_targets = 0;
+  for (int target = 0; target < tracker->size; ++target) {
+    uint64_t issued = DART_FETCH64(&tracker->issued[target]);
+    if (issued != DART_FETCH64(&completed[target])) {
+      if (num_targets < DART_FLUSH_MAX_TARGETS) {
+        snapshot->targets[num_targets] = target;
+        snapshot->issued[num_targets]  = issued;
+      }
+      ++num_targets;
+    }
+  }
+  if (num_targets <= DART_FLUSH_MAX_TARGETS) {
+    return num_targets;
+  }
+  snapshot->issued_all = malloc(tracker->size * sizeof(uint64_t));
+  for (int target = 0; target < tracker->size; ++target) {
+    snapshot->issued_all[target] = DART_FETCH64(&tracker->issued[target]);
+  }
+  return -1;
+}
+
+/**
+ * Marks the operations recorded in \c snapshot by
+ * \c dart__mpi__flush_all_begin as completed after the flush.
+ */
+static
+  void
+dart__mpi__flush_all_end(
+  dart_flush_tracker_t  * tracker,
+  bool                    local,
+  int                     num_targets,
+  dart_flush_snapshot_t * snapshot)
+{
+  if (tracker == NULL) {
+    return;
+  }
+  if (num_targets < 0) {
+    for (int target = 0; target < tracker->size; ++target) {
+      dart__mpi__flush_target_end(
+        tracker, target, local, snapshot->issued_all[target]);
+    }
+    free(snapshot->issued_all);
+    snapshot->issued_all = NULL;
+  }
+  for (int i = 0; i < num_targets; ++i) {
+    dart__mpi__flush_target_end(
+      tracker, snapshot->targets[i], local, snapshot->issued[i]);
+  }
+  if (!local) {
+    dart__mpi__flush_tracker_advance(&tracker->num_completed,
+                                     snapshot->num_issued);
+  }
+  dart__mpi__flush_tracker_advance(&tracker->num_completed_local,
+                                   snapshot->num_issued);
+}
+
 dart_ret_t dart_flush(
   dart_gptr_t gptr)
 {
@@ -1201,9 +1629,20 @@ dart_ret_t dart_flush(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
-  DART_LOG_TRACE("dart_flush: MPI_Win_flush");
-  CHECK_MPI_RET(
-    MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+  if (dart__mpi__wc_enabled()) {
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
+  uint64_t issued  = 0;
+  bool     pending = dart__mpi__flush_target_begin(
+                       seginfo->tracker, team_unit_id.id, false, &issued);
+  if (pending) {
+    DART_LOG_TRACE("dart_flush: MPI_Win_flush");
+    CHECK_MPI_RET(
+      MPI_Win_flush(team_unit_id.id, win), "MPI_Win_flush");
+    dart__mpi__flush_target_end(
+      seginfo->tracker, team_unit_id.id, false, issued);
+  }
 
   if (seginfo->sync_needed) {
     DART_LOG_TRACE("dart_flush: MPI_Win_sync");
@@ -1211,6 +1650,11 @@ dart_ret_t dart_flush(
       MPI_Win_sync(win), "MPI_Win_sync");
   }
 
+  if (!pending) {
+    DART_LOG_DEBUG("dart_flush > no outstanding operations");
+    return DART_OK;
+  }
+
   // trigger progress
   int flag;
   CHECK_MPI_RET(
@@ -1249,9 +1693,28 @@ dart_ret_t dart_flush_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
-  DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
-  CHECK_MPI_RET(
-    MPI_Win_flush_all(win), "MPI_Win_flush");
+  if (dart__mpi__wc_enabled()) {
+    dart__mpi__wc_ship(win, -1);
+  }
+
+  dart_flush_snapshot_t snapshot;
+  int num_targets = dart__mpi__flush_all_begin(
+                      seginfo->tracker, false, &snapshot);
+  if (num_targets < 0) {
+    DART_LOG_TRACE("dart_flush_all: MPI_Win_flush_all");
+    if (MPI_Win_flush_all(win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_flush_all ! MPI_Win_flush_all failed");
+      free(snapshot.issued_all);
+      return DART_ERR_INVAL;
+    }
+  }
+  for (int i = 0; i < num_targets; ++i) {
+    DART_LOG_TRACE("dart_flush_all: MPI_Win_flush(%d)",
+                   snapshot.targets[i]);
+    CHECK_MPI_RET(
+      MPI_Win_flush(snapshot.targets[i], win), "MPI_Win_flush");
+  }
+  dart__mpi__flush_all_end(seginfo->tracker, false, num_targets, &snapshot);
 
   if (seginfo->sync_needed) {
     DART_LOG_TRACE("dart_flush_all: MPI_Win_sync");
@@ -1259,6 +1722,11 @@ dart_ret_t dart_flush_all(
       MPI_Win_sync(win), "MPI_Win_sync");
   }
 
+  if (num_targets == 0) {
+    DART_LOG_DEBUG("dart_flush_all > no outstanding operations");
+    return DART_OK;
+  }
+
   // trigger progress
   int flag;
   CHECK_MPI_RET(
@@ -1299,10 +1767,23 @@ dart_ret_t dart_flush_local(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
+  if (dart__mpi__wc_enabled()) {
+    dart__mpi__wc_ship(win, team_unit_id.id);
+  }
+
+  uint64_t issued = 0;
+  if (!dart__mpi__flush_target_begin(
+         seginfo->tracker, team_unit_id.id, true, &issued)) {
+    DART_LOG_DEBUG("dart_flush_local > no outstanding operations");
+    return DART_OK;
+  }
+
   DART_LOG_TRACE("dart_flush_local: MPI_Win_flush_local");
   CHECK_MPI_RET(
     MPI_Win_flush_local(team_unit_id.id, win),
     "MPI_Win_flush_local");
+  dart__mpi__flush_target_end(
+    seginfo->tracker, team_unit_id.id, true, issued);
 
   // trigger progress
   int flag;
@@ -1341,9 +1822,31 @@ dart_ret_t dart_flush_local_all(
   MPI_Comm comm = team_data->comm;
   MPI_Win  win  = seginfo->win;
 
-  CHECK_MPI_RET(
-    MPI_Win_flush_local_all(win),
-    "MPI_Win_flush_local_all");
+  if (dart__mpi__wc_enabled()) {
+    dart__mpi__wc_ship(win, -1);
+  }
+
+  dart_flush_snapshot_t snapshot;
+  int num_targets = dart__mpi__flush_all_begin(
+                      seginfo->tracker, true, &snapshot);
+  if (num_targets == 0) {
+    DART_LOG_DEBUG("dart_flush_local_all > no outstanding operations");
+    return DART_OK;
+  }
+  if (num_targets < 0) {
+    if (MPI_Win_flush_local_all(win) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_flush_local_all ! "
+                     "MPI_Win_flush_local_all failed");
+      free(snapshot.issued_all);
+      return DART_ERR_INVAL;
+    }
+  }
+  for (int i = 0; i < num_targets; ++i) {
+    CHECK_MPI_RET(
+      MPI_Win_flush_local(snapshot.targets[i], win),
+      "MPI_Win_flush_local");
+  }
+  dart__mpi__flush_all_end(seginfo->tracker, true, num_targets, &snapshot);
 
   // trigger progress
   int flag;
@@ -1384,6 +1887,67 @@ dart_ret_t dart_wait_local(
   return DART_OK;
 }
 
+/**
+ * Notifies the flags of remotely completed handles created by
+ * \c dart_put_notify_handle and completes the flag updates. Repeated
+ * flushes of the same flag target are skipped by the flush tracker.
+ */
+static
+dart_ret_t notify_completion(
+  dart_handle_t *handles,
+  size_t         n
+)
+{
+  bool notify = false;
+  for (size_t i = 0; i < n; i++) {
+    if (handles[i] != DART_HANDLE_NULL && handles[i]->notify) {
+      if (!notify) {
+        // order stores to shared memory before the flag updates
+        DART_MEMORY_BARRIER();
+        notify = true;
+      }
+      dart_ret_t ret = dart_accumulate(
+                         handles[i]->notify_gptr, &handles[i]->notify_value,
+                         1, DART_TYPE_INT, DART_OP_SUM);
+      if (ret != DART_OK) {
+        return ret;
+      }
+    }
+  }
+  for (size_t i = 0; notify && i < n; i++) {
+    if (handles[i] != DART_HANDLE_NULL && handles[i]->notify) {
+      dart_ret_t ret = dart_flush(handles[i]->notify_gptr);
+      if (ret != DART_OK) {
+        return ret;
+      }
+    }
+  }
+  return DART_OK;
+}
+
+/**
+ * Completes the operations of \c handle at the target unless a flush of
+ * the target has completed them already.
+ *
+ * \return The result of \c MPI_Win_flush or \c MPI_SUCCESS if the flush
+ *         is skipped.
+ */
+static
+int flush_handle_target(
+  dart_handle_t handle)
+{
+  uint64_t issued = 0;
+  if (dart__mpi__flush_target_begin(
+        handle->tracker, handle->dest, false, &issued)) {
+    int ret = MPI_Win_flush(handle->dest, handle->win);
+    if (ret != MPI_SUCCESS) {
+      return ret;
+    }
+    dart__mpi__flush_target_end(handle->tracker, handle->dest, false, issued);
+  }
+  return MPI_SUCCESS;
+}
+
 dart_ret_t dart_wait(
   dart_handle_t * handleptr)
 {
@@ -1404,12 +1968,15 @@ dart_ret_t dart_wait(
 
       if (handle->needs_flush) {
         DART_LOG_DEBUG("dart_wait:   -- MPI_Win_flush");
-        CHECK_MPI_RET(MPI_Win_flush(handle->dest, handle->win),
-                      "MPI_Win_flush");
+        CHECK_MPI_RET(flush_handle_target(handle), "MPI_Win_flush");
       }
     } else {
       DART_LOG_TRACE("dart_wait:     handle->num_reqs == 0");
     }
+    dart_ret_t ret = notify_completion(handleptr, 1);
+    if (ret != DART_OK) {
+      return ret;
+    }
     /* Free handle resource */
     free(handle);
     *handleptr = DART_HANDLE_NULL;
@@ -1496,12 +2063,23 @@ dart_ret_t wait_remote_completion(
 {
   for (size_t i = 0; i < n; i++) {
     if (handles[i] != DART_HANDLE_NULL && handles[i]->needs_flush) {
+      // a single flush completes all operations on the same target
+      bool flushed = false;
+      for (size_t j = 0; j < i && !flushed; j++) {
+        flushed = (handles[j] != DART_HANDLE_NULL &&
+                   handles[j]->needs_flush &&
+                   handles[j]->dest == handles[i]->dest &&
+                   handles[j]->win  == handles[i]->win);
+      }
+      if (flushed) {
+        continue;
+      }
       DART_LOG_DEBUG("dart_waitall: -- MPI_Win_flush(handle[%zu]: %p, dest: %d))",
                       i, (void*)handles[i], handles[i]->dest);
       /*
         * MPI_Win_flush to wait for remote completion if required:
         */
-      if (MPI_Win_flush(handles[i]->dest, handles[i]->win) != MPI_SUCCESS) {
+      if (flush_handle_target(handles[i]) != MPI_SUCCESS) {
         return DART_ERR_INVAL;
       }
     }
@@ -1586,6 +2164,11 @@ dart_ret_t dart_waitall(
       FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
       return DART_ERR_OTHER;
     }
+    if (DART_OK != notify_completion(handles, n)) {
+      DART_LOG_ERROR("dart_waitall: notification failed");
+      FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
+      return DART_ERR_OTHER;
+    }
 
     /*
      * free memory:
@@ -1694,10 +2277,11 @@ dart_ret_t dart_test(
 
   if (flag) {
     if (handle->needs_flush) {
-      CHECK_MPI_RET(
-        MPI_Win_flush(handle->dest, handle->win),
-        "MPI_Win_flush"
-      );
+      CHECK_MPI_RET(flush_handle_target(handle), "MPI_Win_flush");
+    }
+    dart_ret_t ret = notify_completion(handleptr, 1);
+    if (ret != DART_OK) {
+      return ret;
     }
     // deallocate handle
     free(handle);
@@ -1804,6 +2388,11 @@ dart_ret_t dart_testall(
         FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
         return DART_ERR_OTHER;
       }
+      if (DART_OK != notify_completion(handles, n)) {
+        DART_LOG_ERROR("dart_testall: notification failed");
+        FREE_TMP(2 * n * sizeof(MPI_Request), mpi_req);
+        return DART_ERR_OTHER;
+      }
 
       for (size_t i = 0; i < n; i++) {
         if (handles[i] != DART_HANDLE_NULL) {
@@ -1853,6 +2442,11 @@ dart_ret_t dart_barrier(
     return DART_ERR_INVAL;
   }
 
+  if (dart__mpi__wc_enabled()) {
+    // staged transfers are issued before other units may wait for them
+    dart__mpi__wc_ship(MPI_WIN_NULL, -1);
+  }
+
   /* Fetch proper communicator from teams. */
   CHECK_MPI_RET(
     MPI_Barrier(team_data->comm), "MPI_Barrier");
@@ -2261,6 +2855,74 @@ dart_ret_t dart_alltoall(
   return DART_OK;
 }
 
+dart_ret_t dart_alltoallv(
+  const void      * sendbuf,
+  const size_t    * nsendelem,
+  const size_t    * senddispls,
+  dart_datatype_t   dtype,
+  void            * recvbuf,
+  const size_t    * nrecvelem,
+  const size_t    * recvdispls,
+  dart_team_t       teamid)
+{
+  DART_LOG_TRACE("dart_alltoallv() team:%d", teamid);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_alltoallv ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+  MPI_Comm comm      = team_data->comm;
+  int      comm_size = team_data->size;
+
+  /*
+   * MPI uses offset type int, convert counts and displacements and do not
+   * copy more than INT_MAX elements:
+   */
+  int *insendcounts = malloc(sizeof(int) * comm_size * 4);
+  int *isenddispls  = insendcounts + comm_size;
+  int *inrecvcounts = isenddispls  + comm_size;
+  int *irecvdispls  = inrecvcounts + comm_size;
+  for (int i = 0; i < comm_size; i++) {
+    if (nsendelem[i]  > MAX_CONTIG_ELEMENTS ||
+        senddispls[i] > MAX_CONTIG_ELEMENTS ||
+        nrecvelem[i]  > MAX_CONTIG_ELEMENTS ||
+        recvdispls[i] > MAX_CONTIG_ELEMENTS)
+    {
+      DART_LOG_ERROR(
+        "dart_alltoallv ! failed: counts or displacements for unit %i "
+        "exceed INT_MAX", i);
+      free(insendcounts);
+      return DART_ERR_INVAL;
+    }
+    insendcounts[i] = nsendelem[i];
+    isenddispls[i]  = senddispls[i];
+    inrecvcounts[i] = nrecvelem[i];
+    irecvdispls[i]  = recvdispls[i];
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+  if (MPI_Alltoallv(
+           sendbuf,
+           insendcounts,
+           isenddispls,
+           mpi_dtype,
+           recvbuf,
+           inrecvcounts,
+           irecvdispls,
+           mpi_dtype,
+           comm) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_alltoallv ! team:%d failed", teamid);
+    free(insendcounts);
+    return DART_ERR_INVAL;
+  }
+  free(insendcounts);
+  DART_LOG_TRACE("dart_alltoallv > team:%d", teamid);
+  return DART_OK;
+}
+
 dart_ret_t dart_reduce(
   const void        * sendbuf,
   void              * recvbuf,
@@ -2304,6 +2966,236 @@ dart_ret_t dart_reduce(
   return DART_OK;
 }
 
+/* -- Dart non-blocking collective operations -- */
+
+static inline
+dart_handle_t dart__mpi__collective_handle(void)
+{
+  dart_handle_t handle = calloc(1, sizeof(struct dart_handle_struct));
+  handle->dest         = DART_UNDEFINED_UNIT_ID;
+  handle->win          = MPI_WIN_NULL;
+  handle->needs_flush  = false;
+  handle->num_reqs     = 0;
+  return handle;
+}
+
+dart_ret_t dart_ibarrier(
+  dart_team_t     teamid,
+  dart_handle_t * handleptr)
+{
+  DART_LOG_DEBUG("dart_ibarrier() team:%d", teamid);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibarrier ! failed: Unknown team: %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (MPI_Ibarrier(team_data->comm, &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ibarrier ! MPI_Ibarrier failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_DEBUG("dart_ibarrier > handle:%p", (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ibcast(
+  void              * buf,
+  size_t              nelem,
+  dart_datatype_t     dtype,
+  dart_team_unit_t    root,
+  dart_team_t         teamid,
+  dart_handle_t     * handleptr)
+{
+  DART_LOG_TRACE("dart_ibcast() root:%d team:%d nelem:%"PRIu64"",
+                 root.id, teamid, nelem);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ibcast ! failed: unknown team %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  CHECK_UNITID_RANGE(root, team_data);
+
+  MPI_Comm comm = team_data->comm;
+
+  // chunk up the bcast if necessary, at most two requests are needed
+  const size_t nchunks   = nelem / MAX_CONTIG_ELEMENTS;
+  const size_t remainder = nelem % MAX_CONTIG_ELEMENTS;
+        char * src_ptr   = (char*) buf;
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+
+  if (nchunks > 0) {
+    if (MPI_Ibcast(src_ptr, nchunks,
+                   dart__mpi__datatype_maxtype(dtype),
+                   root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+    src_ptr += nchunks * MAX_CONTIG_ELEMENTS;
+  }
+
+  if (remainder > 0) {
+    MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+    if (MPI_Ibcast(src_ptr, remainder, mpi_dtype, root.id, comm,
+                   &handle->reqs[handle->num_reqs]) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_ibcast ! MPI_Ibcast failed");
+      // the first chunk has been started already and has to complete
+      MPI_Waitall(handle->num_reqs, handle->reqs, MPI_STATUSES_IGNORE);
+      free(handle);
+      return DART_ERR_INVAL;
+    }
+    handle->num_reqs++;
+  }
+
+  if (handle->num_reqs == 0) {
+    free(handle);
+    handle = DART_HANDLE_NULL;
+  }
+  *handleptr = handle;
+
+  DART_LOG_TRACE("dart_ibcast > root:%d team:%d nelem:%zu handle:%p",
+                 root.id, teamid, nelem, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_iallreduce(
+  const void       * sendbuf,
+  void             * recvbuf,
+  size_t             nelem,
+  dart_datatype_t    dtype,
+  dart_operation_t   op,
+  dart_team_t        team,
+  dart_handle_t    * handleptr)
+{
+  DART_LOG_TRACE("dart_iallreduce() team:%d nelem:%"PRIu64"", team, nelem);
+
+  CHECK_IS_CONTIGUOUSTYPE(dtype);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  MPI_Op       mpi_op    = dart__mpi__op(op, dtype);
+  MPI_Datatype mpi_dtype = dart__mpi__op_type(op, dtype);
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_iallreduce ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(team);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_iallreduce ! unknown teamid %d", team);
+    return DART_ERR_INVAL;
+  }
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (MPI_Iallreduce(
+          sendbuf,   // send buffer
+          recvbuf,   // receive buffer
+          nelem,     // buffer size
+          mpi_dtype, // datatype
+          mpi_op,    // reduce operation
+          team_data->comm,
+          &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_iallreduce ! MPI_Iallreduce failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_iallreduce > team:%d handle:%p", team, (void*)handle);
+  return DART_OK;
+}
+
+dart_ret_t dart_ialltoall(
+    const void *    sendbuf,
+    void *          recvbuf,
+    size_t          nelem,
+    dart_datatype_t dtype,
+    dart_team_t     teamid,
+    dart_handle_t * handleptr)
+{
+  DART_LOG_TRACE("dart_ialltoall() team:%d nelem:%" PRIu64 "", teamid, nelem);
+
+  CHECK_IS_BASICTYPE(dtype);
+
+  if (dart__unlikely(handleptr == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: handle pointer may not be NULL");
+    return DART_ERR_INVAL;
+  }
+  *handleptr = DART_HANDLE_NULL;
+
+  /*
+   * MPI uses offset type int, do not copy more than INT_MAX elements:
+   */
+  if (dart__unlikely(nelem > MAX_CONTIG_ELEMENTS)) {
+    DART_LOG_ERROR("dart_ialltoall ! failed: nelem (%zu) > INT_MAX", nelem);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(teamid);
+  if (dart__unlikely(team_data == NULL)) {
+    DART_LOG_ERROR("dart_ialltoall ! unknown teamid %d", teamid);
+    return DART_ERR_INVAL;
+  }
+
+  if (sendbuf == recvbuf || NULL == sendbuf) {
+    sendbuf = MPI_IN_PLACE;
+  }
+
+  MPI_Datatype mpi_dtype = dart__mpi__datatype_struct(dtype)->contiguous.mpi_type;
+
+  dart_handle_t handle = dart__mpi__collective_handle();
+  if (MPI_Ialltoall(
+          sendbuf,
+          nelem,
+          mpi_dtype,
+          recvbuf,
+          nelem,
+          mpi_dtype,
+          team_data->comm,
+          &handle->reqs[0]) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_ialltoall ! MPI_Ialltoall failed");
+    free(handle);
+    return DART_ERR_INVAL;
+  }
+  handle->num_reqs = 1;
+  *handleptr       = handle;
+
+  DART_LOG_TRACE("dart_ialltoall > team:%d handle:%p", teamid, (void*)handle);
+  return DART_OK;
+}
+
 dart_ret_t dart_send(
   const void         * sendbuf,
   size_t               nelem,
@@ -10,6 +10,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/atomic.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/mutex.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -122,6 +123,146 @@ dart_ret_t dart_gptr_setflags(dart_gptr_t *gptr, uint16_t flags)
 }
 
 
+/**
+ * Memory chunk chained to the local allocation pool.
+ * Chunks are attached to the dynamic window of DART_TEAM_ALL so that
+ * allocations from them are addressed by their absolute address.
+ */
+typedef struct dart_localalloc_chunk {
+  struct dart_localalloc_chunk * next;
+  struct dart_buddy            * pool;
+  char                         * base;
+  MPI_Aint                       disp;
+  size_t                         size;
+} dart_localalloc_chunk_t;
+
+static dart_localalloc_chunk_t * localalloc_chunks     = NULL;
+static size_t                    localalloc_chunk_size = 0;
+static MPI_Win                   localalloc_chunk_win  = MPI_WIN_NULL;
+static dart_mutex_t              localalloc_chunk_mtx  = DART_MUTEX_INITIALIZER;
+
+static inline size_t next_pow2(size_t size)
+{
+  size_t res = 1;
+  while (res < size) {
+    res <<= 1;
+  }
+  return res;
+}
+
+dart_ret_t dart__mpi__localalloc_ext_init(
+  dart_team_data_t * team_data,
+  size_t             chunk_size)
+{
+  dart_segment_info_t *segment = dart_segment_alloc(
+                                &team_data->segdata,
+                                DART_SEGMENT_LOCAL_ALLOC_EXT);
+  if (segment == NULL) {
+    return DART_ERR_OTHER;
+  }
+  localalloc_chunk_size = chunk_size;
+  localalloc_chunk_win  = team_data->window;
+
+  // offsets are absolute addresses in the dynamic window
+  segment->flags       = 0;
+  segment->size        = 0;
+  segment->baseptr     = NULL;
+  segment->selfbaseptr = NULL;
+  segment->disp        = NULL;
+  segment->win         = team_data->window;
+  segment->tracker     = team_data->tracker;
+  segment->shmwin      = MPI_WIN_NULL;
+  segment->is_dynamic  = true;
+
+  dart__mpi__check_memory_model(segment);
+
+  return DART_OK;
+}
+
+dart_ret_t dart__mpi__localalloc_ext_fini(
+  dart_team_data_t * team_data)
+{
+  dart_localalloc_chunk_t *chunk = localalloc_chunks;
+  while (chunk != NULL) {
+    dart_localalloc_chunk_t *next = chunk->next;
+    MPI_Win_detach(team_data->window, chunk->base);
+    MPI_Free_mem(chunk->base);
+    dart_buddy_delete(chunk->pool);
+    free(chunk);
+    chunk = next;
+  }
+  localalloc_chunks    = NULL;
+  localalloc_chunk_win = MPI_WIN_NULL;
+  return DART_OK;
+}
+
+/**
+ * Allocate \c nbytes from the chunks chained to the local allocation pool,
+ * chaining a new chunk if none of them has sufficient free space.
+ *
+ * \return The absolute address of the allocation in the dynamic window or
+ *         -1 if no memory could be allocated.
+ */
+static uint64_t localalloc_ext_alloc(size_t nbytes)
+{
+  uint64_t res = (uint64_t)(-1);
+  dart__base__mutex_lock(&localalloc_chunk_mtx);
+  for (dart_localalloc_chunk_t *chunk = localalloc_chunks;
+       chunk != NULL; chunk = chunk->next) {
+    ssize_t offset = dart_buddy_alloc(chunk->pool, nbytes);
+    if (offset >= 0) {
+      res = chunk->disp + offset;
+      break;
+    }
+  }
+
+  if (res == (uint64_t)(-1)) {
+    size_t size = next_pow2(nbytes);
+    if (size < localalloc_chunk_size) size = localalloc_chunk_size;
+    DART_LOG_DEBUG("dart_memalloc: chaining chunk of %zu bytes to the "
+                   "local allocation pool", size);
+    dart_localalloc_chunk_t *chunk = malloc(sizeof(*chunk));
+    chunk->size = size;
+    chunk->pool = dart_buddy_new(size);
+    if (chunk->pool == NULL ||
+        MPI_Alloc_mem(size, MPI_INFO_NULL, &chunk->base) != MPI_SUCCESS) {
+      DART_LOG_ERROR("dart_memalloc: failed to allocate chunk of %zu bytes",
+                     size);
+      if (chunk->pool != NULL) dart_buddy_delete(chunk->pool);
+      free(chunk);
+    } else {
+      MPI_Win_attach(localalloc_chunk_win, chunk->base, size);
+      MPI_Get_address(chunk->base, &chunk->disp);
+      chunk->next       = localalloc_chunks;
+      localalloc_chunks = chunk;
+      ssize_t offset    = dart_buddy_alloc(chunk->pool, nbytes);
+      if (offset >= 0) {
+        res = chunk->disp + offset;
+      }
+    }
+  }
+  dart__base__mutex_unlock(&localalloc_chunk_mtx);
+  return res;
+}
+
+static dart_ret_t localalloc_ext_free(uint64_t addr)
+{
+  dart_ret_t ret = DART_ERR_INVAL;
+  dart__base__mutex_lock(&localalloc_chunk_mtx);
+  for (dart_localalloc_chunk_t *chunk = localalloc_chunks;
+       chunk != NULL; chunk = chunk->next) {
+    if (addr >= (uint64_t)chunk->disp &&
+        addr <  (uint64_t)chunk->disp + chunk->size) {
+      if (dart_buddy_free(chunk->pool, addr - chunk->disp) != -1) {
+        ret = DART_OK;
+      }
+      break;
+    }
+  }
+  dart__base__mutex_unlock(&localalloc_chunk_mtx);
+  return ret;
+}
+
 dart_ret_t dart_memalloc(
   size_t            nelem,
   dart_datatype_t   dtype,
@@ -135,6 +276,11 @@ dart_ret_t dart_memalloc(
   gptr->segid   = DART_SEGMENT_LOCAL; /* For local allocation, the segid is marked as '0'. */
   gptr->teamid  = DART_TEAM_ALL;      /* Locally allocated gptr belong to the global team. */
   gptr->addr_or_offs.offset = dart_buddy_alloc(dart_localpool, nbytes);
+  if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
+    /* The local allocation pool is exhausted, fall back to chained chunks */
+    gptr->segid = DART_SEGMENT_LOCAL_EXT;
+    gptr->addr_or_offs.offset = localalloc_ext_alloc(nbytes);
+  }
   if (gptr->addr_or_offs.offset == (uint64_t)(-1)) {
     DART_LOG_ERROR("dart_memalloc: Out of bounds "
                    "(dart_buddy_alloc %zu bytes): global memory exhausted",
@@ -142,20 +288,30 @@ dart_ret_t dart_memalloc(
     *gptr = DART_GPTR_NULL;
     return DART_ERR_OTHER;
   }
-  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu offset:%"PRIu64"",
-                 nbytes, gptr->addr_or_offs.offset);
+  DART_LOG_DEBUG("dart_memalloc: local alloc nbytes:%lu segid:%d "
+                 "offset:%"PRIu64"",
+                 nbytes, gptr->segid, gptr->addr_or_offs.offset);
   return DART_OK;
 }
 
 dart_ret_t dart_memfree (dart_gptr_t gptr)
 {
-  if (gptr.segid != DART_SEGMENT_LOCAL || gptr.teamid != DART_TEAM_ALL) {
+  if ((gptr.segid != DART_SEGMENT_LOCAL &&
+       gptr.segid != DART_SEGMENT_LOCAL_EXT) ||
+      gptr.teamid != DART_TEAM_ALL) {
     DART_LOG_ERROR("dart_memfree: invalid segment id:%d or team id:%d",
                    gptr.segid, gptr.teamid);
     return DART_ERR_INVAL;
   }
 
-  if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
+  if (gptr.segid == DART_SEGMENT_LOCAL_EXT) {
+    if (localalloc_ext_free(gptr.addr_or_offs.offset) != DART_OK) {
+      DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
+                     "invalid address: %"PRIu64"",
+                     gptr.addr_or_offs.offset);
+      return DART_ERR_INVAL;
+    }
+  } else if (dart_buddy_free(dart_localpool, gptr.addr_or_offs.offset) == -1) {
     DART_LOG_ERROR("dart_memfree: invalid local global pointer: "
                    "invalid offset: %"PRIu64"",
                    gptr.addr_or_offs.offset);
@@ -226,6 +382,15 @@ dart_team_memalloc_aligned_dynamic(
     return DART_ERR_INVAL;
   }
 
+  if (dart_allocate_team_window(team_data) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (dart_allocate_shared_comm(team_data) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
   MPI_Comm  comm = team_data->comm;
 
   dart_segment_info_t *segment = dart_segment_alloc(
@@ -381,6 +546,7 @@ dart_team_memalloc_aligned_dynamic(
   segment->flags   = 0;
   segment->shmwin  = sharedmem_win;
   segment->win     = team_data->window;
+  segment->tracker = team_data->tracker;
   segment->selfbaseptr = sub_mem;
   segment->is_dynamic  = true;
   /**
@@ -468,6 +634,7 @@ dart_team_memalloc_aligned_full(
   segment->size        = nbytes;
   segment->shmwin      = MPI_WIN_NULL;
   segment->win         = win;
+  segment->tracker     = dart__mpi__flush_tracker_create(team_data->size);
   segment->is_dynamic  = false;
 
   dart__mpi__check_memory_model(segment);
@@ -523,6 +690,9 @@ dart_ret_t dart_team_memfree(
     return DART_ERR_INVAL;
   }
 
+  // complete transfers staged for the window
+  dart__mpi__wc_release(seginfo->win);
+
   if (seginfo->is_dynamic) {
     MPI_Win win = team_data->window;
     if (dart_segment_get_selfbaseptr(
@@ -564,6 +734,7 @@ dart_ret_t dart_team_memfree(
       DART_LOG_ERROR("dart_team_memfree: MPI_Win_free failed");
       return DART_ERR_OTHER;
     }
+    dart__mpi__flush_tracker_destroy(&seginfo->tracker);
   }
 
 
@@ -608,6 +779,10 @@ dart_team_memregister_aligned(
     return DART_ERR_INVAL;
   }
 
+  if (dart_allocate_team_window(team_data) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
   dart_segment_info_t *segment = dart_segment_alloc(
                                 &team_data->segdata, DART_SEGMENT_REGISTER);
   if (segment == NULL) {
@@ -631,6 +806,7 @@ dart_team_memregister_aligned(
   segment->size    = nbytes;
   segment->shmwin  = MPI_WIN_NULL;
   segment->win     = team_data->window;
+  segment->tracker = team_data->tracker;
   segment->selfbaseptr = (char *)addr;
   segment->flags   = 0;
 
@@ -682,6 +858,10 @@ dart_team_memregister(
     return DART_ERR_INVAL;
   }
 
+  if (dart_allocate_team_window(team_data) != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
   dart_segment_info_t *segment = dart_segment_alloc(
                                 &team_data->segdata, DART_SEGMENT_REGISTER);
   if (segment == NULL) {
@@ -705,6 +885,7 @@ dart_team_memregister(
   segment->size   = nbytes;
   segment->shmwin = MPI_WIN_NULL;
   segment->win    = team_data->window;
+  segment->tracker = team_data->tracker;
   segment->selfbaseptr = (char *)addr;
   segment->flags = 0;
 
@@ -755,6 +936,8 @@ dart_team_memderegister(
     return DART_ERR_INVAL;
   }
 
+  // complete transfers staged for the window
+  dart__mpi__wc_release(win);
   MPI_Win_detach(win, sub_mem);
   if (dart_segment_free(&team_data->segdata, segid) != DART_OK) {
     return DART_ERR_INVAL;
@@ -20,16 +20,42 @@
 #include <dash/dart/mpi/dart_locality_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
-#define DART_LOCAL_ALLOC_SIZE (1024UL*1024*16)
+#include <dash/dart/base/env.h>
 
 /* Point to the base address of memory region for local allocation. */
 static int _init_by_dart = 0;
 static int _dart_initialized = 0;
 
+/* Size of the memory pool reserved for local allocation in bytes. */
+static size_t _local_alloc_size = DART_LOCAL_ALLOC_SIZE;
+
+/**
+ * Determine the size of the local allocation pool from the environment.
+ * The size is rounded up to the next power of two as required by the buddy
+ * allocator and is the same on all units.
+ */
+static
+size_t local_alloc_size()
+{
+  unsigned long size = dart__base__env__size(
+                         DART_LOCAL_ALLOC_SIZE_ENVSTR, DART_LOCAL_ALLOC_SIZE);
+  unsigned long pow2 = 1024;
+  while (pow2 < size) {
+    pow2 <<= 1;
+  }
+  unsigned long max_size;
+  MPI_Allreduce(&pow2, &max_size, 1, MPI_UNSIGNED_LONG, MPI_MAX,
+                DART_COMM_WORLD);
+  DART_LOG_DEBUG("dart_init: local allocation pool size: %lu bytes",
+                 max_size);
+  return max_size;
+}
+
 static
 dart_ret_t create_local_alloc(dart_team_data_t *team_data)
 {
-  dart_localpool = dart_buddy_new(DART_LOCAL_ALLOC_SIZE);
+  _local_alloc_size = local_alloc_size();
+  dart_localpool = dart_buddy_new(_local_alloc_size);
   MPI_Win dart_sharedmem_win_local_alloc = MPI_WIN_NULL;
   char* *dart_sharedmem_local_baseptr_set = NULL;
   MPI_Info win_info;
@@ -44,13 +70,13 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
   MPI_Comm sharedmem_comm = team_data->sharedmem_comm;
 
   if (sharedmem_comm != MPI_COMM_NULL) {
-    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%d)",
-                   DART_LOCAL_ALLOC_SIZE);
+    DART_LOG_DEBUG("dart_init: MPI_Win_allocate_shared(nbytes:%zu)",
+                   _local_alloc_size);
     MPI_Info_set(win_info, "alloc_shared_noncontig", "true");
     /* Reserve a free shared memory block for non-collective
      * global memory allocation. */
     int ret = MPI_Win_allocate_shared(
-                DART_LOCAL_ALLOC_SIZE,
+                _local_alloc_size,
                 sizeof(char),
                 win_info,
                 sharedmem_comm,
@@ -97,14 +123,14 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    * Return in dart_win_local_alloc. */
   MPI_Win_create(
     dart_mempool_localalloc,
-    DART_LOCAL_ALLOC_SIZE,
+    _local_alloc_size,
     sizeof(char),
     win_info,
     DART_COMM_WORLD,
     &dart_win_local_alloc);
 #else
   MPI_Win_allocate(
-    DART_LOCAL_ALLOC_SIZE, sizeof(char),
+    _local_alloc_size, sizeof(char),
     win_info, DART_COMM_WORLD,
     &dart_mempool_localalloc,
     &dart_win_local_alloc);
@@ -122,15 +148,19 @@ dart_ret_t create_local_alloc(dart_team_data_t *team_data)
    */
   MPI_Win_lock_all(MPI_MODE_NOCHECK, dart_win_local_alloc);
 
+  /* Serve small allocations from per-thread size-class caches */
+  dart_buddy_enable_cache(dart_localpool, dart_mempool_localalloc);
+
 
   /* put the localalloc in the segment table */
   dart_segment_info_t *segment = dart_segment_alloc(
                                 &team_data->segdata, DART_SEGMENT_LOCAL_ALLOC);
   segment->flags       = 1;
   segment->segid       = 0;
-  segment->size        = DART_LOCAL_ALLOC_SIZE;
+  segment->size        = _local_alloc_size;
   segment->baseptr     = dart_sharedmem_local_baseptr_set;
   segment->win         = dart_win_local_alloc;
+  segment->tracker     = dart__mpi__flush_tracker_create(team_data->size);
   segment->shmwin      = dart_sharedmem_win_local_alloc;
   segment->selfbaseptr = dart_mempool_localalloc;
   // addressing in this window is relative, no need to exchange displacements
@@ -169,6 +199,10 @@ dart_ret_t do_init()
     return DART_ERR_OTHER;
   }
 
+  if (dart__mpi__wc_init() != DART_OK) {
+    return DART_ERR_OTHER;
+  }
+
   dart_team_data_t *team_data = dart_adapt_teamlist_get(DART_TEAM_ALL);
 
   /* Create a global translation table for all
@@ -188,20 +222,20 @@ dart_ret_t do_init()
   }
 
   /* Create a dynamic win object for all the dart collective
-   * allocation based on MPI_COMM_WORLD. Return in win. */
-  MPI_Win win;
-  MPI_Win_create_dynamic(
-    MPI_INFO_NULL, DART_COMM_WORLD, &win);
-  team_data->window = win;
-
-  /* Start an access epoch on win, and later on all the units
-   * can access the attached memory region allocated by the
-   * collective allocation function through win.
-   *
-   * NOTE: We use MPI_MODE_NOCHECK since there will be no
-   * conflicting locks at all
-   */
-  MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+   * allocation based on MPI_COMM_WORLD. Unlike in other teams, it is
+   * created eagerly as it also holds the chunks chained to the local
+   * allocation pool. */
+  ret = dart_allocate_team_window(team_data);
+  if (ret != DART_OK) {
+    return ret;
+  }
+
+  /* Memory chunks chained to the local allocation pool on demand are
+   * attached to the dynamic window. */
+  ret = dart__mpi__localalloc_ext_init(team_data, _local_alloc_size);
+  if (ret != DART_OK) {
+    return ret;
+  }
 
   DART_LOG_DEBUG("dart_init: communication backend initialization finished");
 
@@ -308,6 +342,10 @@ dart_ret_t dart_exit()
 
   dart_segment_info_t *seginfo = dart_segment_get_info(&team_data->segdata, 0);
 
+  dart__mpi__wc_fini();
+
+  dart__mpi__localalloc_ext_fini(team_data);
+
   if (MPI_Win_unlock_all(team_data->window) != MPI_SUCCESS) {
     DART_LOG_ERROR("%2d: dart_exit: MPI_Win_unlock_all failed", unitid.id);
     return DART_ERR_OTHER;
@@ -320,12 +358,14 @@ dart_ret_t dart_exit()
 
   /* -- Free up all the resources for dart programme -- */
   MPI_Win_free(&seginfo->win);
+  dart__mpi__flush_tracker_destroy(&seginfo->tracker);
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   /* Has MPI shared windows: */
   MPI_Win_free(&seginfo->shmwin);
   MPI_Comm_free(&(team_data->sharedmem_comm));
 #endif
   MPI_Win_free(&team_data->window);
+  dart__mpi__flush_tracker_destroy(&team_data->tracker);
 
   dart_segment_fini(&team_data->segdata);
   dart_buddy_delete(dart_localpool);
@@ -13,6 +13,7 @@
 #include <dash/dart/mpi/dart_mem.h>
 #include <dash/dart/base/mutex.h>
 #include <dash/dart/base/assert.h>
+#include <dash/dart/base/atomic.h>
 
 /* For PRIu64, uint64_t in printf */
 #define __STDC_FORMAT_MACROS
@@ -22,6 +23,34 @@
 #define DART_MEM_ALIGN_BITS 3
 #define DART_MEM_ALIGN_BYTES (1<<DART_MEM_ALIGN_BITS)
 
+/*
+ * Size-class front end:
+ *
+ * Allocations of up to DART_MEM_CACHE_MAX_BYTES are served from
+ * power-of-two size classes. Objects of a size class are carved from
+ * slabs of DART_MEM_SLAB_BYTES allocated in the buddy tree. Every thread
+ * caches up to DART_MEM_CACHE_DEPTH free objects per size class, surplus
+ * objects are exchanged in batches through a lock-free stack per size
+ * class. Only large allocations, slab refills and slab reclaims take the
+ * allocator mutex. A slab is returned to the buddy tree once all of its
+ * objects are in the shared stack.
+ */
+// size classes 8 B, 16 B, ..., 4 KiB
+#define DART_MEM_CACHE_CLASSES    10
+#define DART_MEM_CACHE_MAX_BYTES  \
+  (DART_MEM_ALIGN_BYTES << (DART_MEM_CACHE_CLASSES - 1))
+#define DART_MEM_CACHE_DEPTH      32
+#define DART_MEM_SLAB_BITS        16
+#define DART_MEM_SLAB_BYTES       ((size_t)1 << DART_MEM_SLAB_BITS)
+// pools with less slabs are not worth the fragmentation
+#define DART_MEM_CACHE_MIN_SLABS  16
+
+#ifdef DART_HAVE_PTHREADS
+#define DART_MEM_THREAD_LOCAL __thread
+#else
+#define DART_MEM_THREAD_LOCAL
+#endif
+
 enum {
  NODE_UNUSED = 0,
  NODE_USED   = 1,
@@ -32,9 +61,36 @@ enum {
 struct dart_buddy {
   dart_mutex_t mutex;
   int level;
+  /* Base address of the managed memory if the size-class front end
+   * is enabled, NULL otherwise. Free objects are linked in place. */
+  char     * cache_base;
+  /* Unique id of this instance, used to validate thread caches */
+  uint64_t   cache_id;
+  /* Size class + 1 of every slab, 0 for memory in the buddy tree */
+  uint8_t  * slab_class;
+  /* Number of objects of every slab that are not in the shared stack */
+  int32_t  * slab_live;
+  size_t     num_slabs;
+  /* Heads of the free-object stacks: ABA tag in the upper 32 bits,
+   * index + 1 of the first object in 8-byte units in the lower bits */
+  uint64_t   free_head[DART_MEM_CACHE_CLASSES];
   uint8_t tree[1];
 };
 
+/* Free objects cached by the calling thread */
+typedef struct {
+  struct dart_buddy * owner;
+  uint64_t            owner_id;
+  int                 count[DART_MEM_CACHE_CLASSES];
+  uint32_t            slots[DART_MEM_CACHE_CLASSES][DART_MEM_CACHE_DEPTH];
+} dart_buddy_tcache_t;
+
+static DART_MEM_THREAD_LOCAL dart_buddy_tcache_t dart__buddy__tcache;
+
+/* Id of the only instance with enabled front end, 0 if none */
+static uint64_t dart__buddy__cache_active_id = 0;
+static uint64_t dart__buddy__cache_next_id   = 0;
+
 /* Help to do memory management work for local allocation/free */
 char* dart_mempool_localalloc;
 struct dart_buddy  *  dart_localpool;
@@ -79,6 +135,12 @@ dart_buddy_new(size_t size)
 	struct dart_buddy * self =
     malloc(sizeof(struct dart_buddy) + sizeof(uint8_t) * (lsize * 2 - 2));
 	self->level = level;
+  self->cache_base = NULL;
+  self->cache_id   = 0;
+  self->slab_class = NULL;
+  self->slab_live  = NULL;
+  self->num_slabs  = 0;
+  memset(self->free_head, 0, sizeof(self->free_head));
 	memset(self->tree, NODE_UNUSED, lsize * 2 - 1);
 	dart__base__mutex_init(&self->mutex);
 	return self;
@@ -86,6 +148,12 @@ dart_buddy_new(size_t size)
 
 void
 dart_buddy_delete(struct dart_buddy * self) {
+  if (self->cache_base != NULL) {
+    DART_COMPARE_AND_SWAP64(
+      &dart__buddy__cache_active_id, self->cache_id, 0);
+    free(self->slab_class);
+    free(self->slab_live);
+  }
   dart__base__mutex_destroy(&self->mutex);
 	free(self);
 }
@@ -128,20 +196,13 @@ _mark_parent(struct dart_buddy * self, int index) {
   }
 }
 
-ssize_t
-dart_buddy_alloc(struct dart_buddy * self, size_t s) {
-  // honor the alignment
-  size_t size = (s >> DART_MEM_ALIGN_BITS);
-  if ((size<<DART_MEM_ALIGN_BITS) < s) ++size;
-  size = (int)next_pow_of_2(size);
+/*
+ * Allocates a block of \c size 8-byte units, a power of two, in the
+ * buddy tree.
+ */
+static ssize_t
+_tree_alloc(struct dart_buddy * self, size_t size) {
   size_t length = 1 << self->level;
-
-  if (size > length) {
-    DART_LOG_ERROR("Allocation size larger than total allocator size (%zu > %zu)",
-                   s, length<<DART_MEM_ALIGN_BITS);
-    return -1;
-  }
-
   int index = 0;
   int level = 0;
 
@@ -195,8 +256,6 @@ dart_buddy_alloc(struct dart_buddy * self, size_t s) {
   }
 
   dart__base__mutex_unlock(&self->mutex);
-  DART_LOG_ERROR(
-    "Allocation larger than remaining available allocator memory (%zu)", s);
   return -1;
 }
 
@@ -216,7 +275,8 @@ _combine(struct dart_buddy * self, int index) {
 	}
 }
 
-int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
+static int
+_tree_free(struct dart_buddy * self, uint64_t offset)
 {
 	int      length = 1 << self->level;
 	uint64_t left   = 0;
@@ -268,6 +328,369 @@ int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
   return -1;
 }
 
+/* -- Size-class front end -- */
+
+static inline uint32_t *
+_cache_link(struct dart_buddy * self, uint32_t slot) {
+  return (uint32_t *)(self->cache_base +
+                      ((size_t)slot << DART_MEM_ALIGN_BITS));
+}
+
+static inline size_t
+_cache_slab(uint32_t slot) {
+  return slot >> (DART_MEM_SLAB_BITS - DART_MEM_ALIGN_BITS);
+}
+
+/*
+ * Pushes the linked objects from slot \c first to slot \c last onto the
+ * free-object stack of size class \c cls in a single atomic operation.
+ */
+static void
+_cache_push_chain(
+  struct dart_buddy * self, int cls, uint32_t first, uint32_t last) {
+  uint64_t * head = &self->free_head[cls];
+  for (;;) {
+    uint64_t old_head = (uint64_t)DART_FETCH64(head);
+    *_cache_link(self, last) = (uint32_t)old_head;
+    uint64_t new_head = (((old_head >> 32) + 1) << 32) | (first + 1);
+    if ((uint64_t)DART_COMPARE_AND_SWAP64(head, old_head, new_head)
+        == old_head) {
+      return;
+    }
+  }
+}
+
+/*
+ * Returns the slab \c slab of size class \c cls to the buddy tree if all
+ * of its objects are in the shared stack.
+ *
+ * The stack is detached while its objects are sorted out so that no
+ * other thread can pop objects of the slab in the meantime. If objects
+ * of the slab are missing, they were popped after the live count of
+ * the slab dropped to zero and the slab is kept.
+ */
+static void
+_slab_reclaim(struct dart_buddy * self, int cls, size_t slab) {
+  uint32_t   nobj = (uint32_t)(DART_MEM_SLAB_BYTES >>
+                                 (cls + DART_MEM_ALIGN_BITS));
+  uint64_t * head = &self->free_head[cls];
+
+  dart__base__mutex_lock(&self->mutex);
+  if (self->slab_class[slab] != cls + 1 ||
+      DART_FETCH32(&self->slab_live[slab]) != 0) {
+    dart__base__mutex_unlock(&self->mutex);
+    return;
+  }
+  uint64_t old_head;
+  do {
+    old_head = (uint64_t)DART_FETCH64(head);
+  } while ((uint64_t)DART_COMPARE_AND_SWAP64(
+             head, old_head, ((old_head >> 32) + 1) << 32) != old_head);
+
+  uint32_t first = (uint32_t)old_head, last = 0, found = 0;
+  for (uint32_t next = first; next != 0; next = *_cache_link(self, last - 1)) {
+    if (_cache_slab(next - 1) == slab) {
+      ++found;
+    }
+    last = next;
+  }
+  bool reclaim = (found == nobj);
+  if (reclaim) {
+    // unlink the objects of the slab, keep the others in their order
+    uint32_t next = first;
+    first = 0;
+    last  = 0;
+    for (; next != 0; next = *_cache_link(self, next - 1)) {
+      if (_cache_slab(next - 1) == slab) {
+        continue;
+      }
+      if (first == 0) {
+        first = next;
+      } else {
+        *_cache_link(self, last - 1) = next;
+      }
+      last = next;
+    }
+  }
+  if (first != 0) {
+    _cache_push_chain(self, cls, first - 1, last - 1);
+  }
+  if (reclaim) {
+    self->slab_class[slab] = 0;
+  }
+  dart__base__mutex_unlock(&self->mutex);
+
+  if (reclaim) {
+    DART_LOG_TRACE("dart_buddy: returning slab at offset %zu",
+                   slab << DART_MEM_SLAB_BITS);
+    _tree_free(self, (uint64_t)slab << DART_MEM_SLAB_BITS);
+  }
+}
+
+/*
+ * Pushes the objects at the given slots onto the free-object stack of
+ * size class \c cls in a single atomic operation and reclaims slabs of
+ * which no object remains outside of the stack.
+ */
+static void
+_cache_push(struct dart_buddy * self, int cls, uint32_t * slots, int n) {
+  if (n == 0) {
+    return;
+  }
+  for (int i = 0; i < n - 1; ++i) {
+    *_cache_link(self, slots[i]) = slots[i + 1] + 1;
+  }
+  _cache_push_chain(self, cls, slots[0], slots[n - 1]);
+  // live counts drop after the push so that a reclaim triggered by a
+  // count of zero finds all objects of the slab in the stack
+  for (int i = 0; i < n; ) {
+    size_t  slab = _cache_slab(slots[i]);
+    int32_t run  = 0;
+    for (; i < n && _cache_slab(slots[i]) == slab; ++i) {
+      ++run;
+    }
+    if (DART_SUB_AND_FETCH32(&self->slab_live[slab], run) == 0) {
+      _slab_reclaim(self, cls, slab);
+    }
+  }
+}
+
+/*
+ * Pops up to \c max objects from the free-object stack of size class
+ * \c cls in a single atomic operation.
+ *
+ * \return The number of objects written to \c slots.
+ */
+static int
+_cache_pop(struct dart_buddy * self, int cls, uint32_t * slots, int max) {
+  uint64_t * head = &self->free_head[cls];
+  for (;;) {
+    uint64_t old_head = (uint64_t)DART_FETCH64(head);
+    uint32_t next     = (uint32_t)old_head;
+    int      n        = 0;
+    // links read here may be stale if another thread popped the objects
+    // concurrently, the tag in the head then lets the swap below fail
+    while (next != 0 && n < max) {
+      if ((uint64_t)(next - 1) >=
+            ((uint64_t)self->num_slabs << (DART_MEM_SLAB_BITS -
+                                            DART_MEM_ALIGN_BITS))) {
+        break;
+      }
+      slots[n++] = next - 1;
+      next       = *_cache_link(self, next - 1);
+    }
+    if (n == 0) {
+      return 0;
+    }
+    uint64_t new_head = (((old_head >> 32) + 1) << 32) | next;
+    if ((uint64_t)DART_COMPARE_AND_SWAP64(head, old_head, new_head)
+        == old_head) {
+      for (int i = 0; i < n; ) {
+        size_t  slab = _cache_slab(slots[i]);
+        int32_t run  = 0;
+        for (; i < n && _cache_slab(slots[i]) == slab; ++i) {
+          ++run;
+        }
+        DART_FETCH_AND_ADD32(&self->slab_live[slab], run);
+      }
+      return n;
+    }
+  }
+}
+
+#ifdef DART_HAVE_PTHREADS
+static pthread_key_t  dart__buddy__tcache_key;
+static pthread_once_t dart__buddy__tcache_once = PTHREAD_ONCE_INIT;
+
+/*
+ * Returns the objects cached by an exiting thread to the shared stacks.
+ */
+static void
+_tcache_release(void * arg) {
+  dart_buddy_tcache_t * tc = (dart_buddy_tcache_t *)arg;
+  if (tc->owner_id != 0 &&
+      tc->owner_id == (uint64_t)DART_FETCH64(&dart__buddy__cache_active_id)) {
+    for (int cls = 0; cls < DART_MEM_CACHE_CLASSES; ++cls) {
+      _cache_push(tc->owner, cls, tc->slots[cls], tc->count[cls]);
+      tc->count[cls] = 0;
+    }
+  }
+  tc->owner_id = 0;
+}
+
+static void
+_tcache_key_create(void) {
+  pthread_key_create(&dart__buddy__tcache_key, &_tcache_release);
+}
+#endif
+
+static inline dart_buddy_tcache_t *
+_tcache(struct dart_buddy * self) {
+  dart_buddy_tcache_t * tc = &dart__buddy__tcache;
+  if (tc->owner_id != self->cache_id) {
+    // objects still cached belong to a deleted allocator instance
+    memset(tc->count, 0, sizeof(tc->count));
+    tc->owner    = self;
+    tc->owner_id = self->cache_id;
+#ifdef DART_HAVE_PTHREADS
+    pthread_once(&dart__buddy__tcache_once, &_tcache_key_create);
+    pthread_setspecific(dart__buddy__tcache_key, tc);
+#endif
+  }
+  return tc;
+}
+
+/*
+ * Carves a new slab into objects of size class \c cls, fills the thread
+ * cache and publishes the remaining objects in the shared stack.
+ */
+static int
+_cache_refill(struct dart_buddy * self, int cls, dart_buddy_tcache_t * tc) {
+  ssize_t slab = _tree_alloc(
+                   self, DART_MEM_SLAB_BYTES >> DART_MEM_ALIGN_BITS);
+  if (slab < 0) {
+    return -1;
+  }
+  uint32_t first = (uint32_t)(slab >> DART_MEM_ALIGN_BITS);
+  uint32_t step  = (uint32_t)1 << cls;
+  int      nobj  = (int)(DART_MEM_SLAB_BYTES >> (cls + DART_MEM_ALIGN_BITS));
+  // all objects are live until the surplus is pushed below
+  self->slab_live[slab >> DART_MEM_SLAB_BITS] = nobj;
+  self->slab_class[slab >> DART_MEM_SLAB_BITS] = (uint8_t)(cls + 1);
+
+  int      nlocal = (nobj < DART_MEM_CACHE_DEPTH / 2)
+                    ? nobj : DART_MEM_CACHE_DEPTH / 2;
+  for (int i = 0; i < nlocal; ++i) {
+    tc->slots[cls][i] = first + (nlocal - 1 - i) * step;
+  }
+  tc->count[cls] = nlocal;
+
+  if (nobj > nlocal) {
+    uint32_t * rest = malloc(sizeof(uint32_t) * (nobj - nlocal));
+    for (int i = nlocal; i < nobj; ++i) {
+      rest[i - nlocal] = first + i * step;
+    }
+    _cache_push(self, cls, rest, nobj - nlocal);
+    free(rest);
+  }
+  DART_LOG_TRACE("dart_buddy: new slab at offset %zd for %zu byte objects",
+                 slab, (size_t)DART_MEM_ALIGN_BYTES << cls);
+  return 0;
+}
+
+static ssize_t
+_cache_alloc(struct dart_buddy * self, int cls) {
+  dart_buddy_tcache_t * tc = _tcache(self);
+  if (tc->count[cls] == 0) {
+    tc->count[cls] = _cache_pop(self, cls, tc->slots[cls],
+                                DART_MEM_CACHE_DEPTH / 2);
+    if (tc->count[cls] == 0 && _cache_refill(self, cls, tc) != 0) {
+      return -1;
+    }
+  }
+  return (ssize_t)tc->slots[cls][--tc->count[cls]] << DART_MEM_ALIGN_BITS;
+}
+
+static int
+_cache_free(struct dart_buddy * self, int cls, uint64_t offset) {
+  if (offset & ((DART_MEM_ALIGN_BYTES << cls) - 1)) {
+    DART_LOG_ERROR("Invalid offset %" PRIu64 " in dart_buddy_free"
+                   "(alloc:%p)!", offset, self);
+    return -1;
+  }
+  dart_buddy_tcache_t * tc = _tcache(self);
+#ifdef DART_ENABLE_ASSERTIONS
+  for (int i = 0; i < tc->count[cls]; ++i) {
+    DART_ASSERT_MSG(tc->slots[cls][i] != (offset >> DART_MEM_ALIGN_BITS),
+                    "double free in dart_buddy_free");
+  }
+#endif
+  if (tc->count[cls] == DART_MEM_CACHE_DEPTH) {
+    // keep the most recently freed half, publish the others
+    _cache_push(self, cls, tc->slots[cls], DART_MEM_CACHE_DEPTH / 2);
+    memmove(tc->slots[cls], tc->slots[cls] + DART_MEM_CACHE_DEPTH / 2,
+            sizeof(uint32_t) * (DART_MEM_CACHE_DEPTH / 2));
+    tc->count[cls] = DART_MEM_CACHE_DEPTH / 2;
+  }
+  tc->slots[cls][tc->count[cls]++] =
+    (uint32_t)(offset >> DART_MEM_ALIGN_BITS);
+  return 0;
+}
+
+int
+dart_buddy_enable_cache(struct dart_buddy * self, char * base) {
+  size_t num_slabs = ((size_t)1 << (self->level + DART_MEM_ALIGN_BITS))
+                     >> DART_MEM_SLAB_BITS;
+  // object indices in the free-object stacks are 32 bit wide
+  if (base == NULL || self->level > 31 ||
+      num_slabs < DART_MEM_CACHE_MIN_SLABS) {
+    DART_LOG_DEBUG("dart_buddy_enable_cache: size-class front end not "
+                   "applicable to pool of %zu bytes",
+                   (size_t)1 << (self->level + DART_MEM_ALIGN_BITS));
+    return -1;
+  }
+  uint64_t id = (uint64_t)DART_FETCH_AND_INC64(&dart__buddy__cache_next_id)
+                + 1;
+  if (DART_COMPARE_AND_SWAP64(&dart__buddy__cache_active_id, 0, id) != 0) {
+    DART_LOG_WARN("dart_buddy_enable_cache: front end already enabled for "
+                  "another allocator");
+    return -1;
+  }
+  self->cache_id   = id;
+  self->num_slabs  = num_slabs;
+  self->slab_class = calloc(num_slabs, sizeof(uint8_t));
+  self->slab_live  = calloc(num_slabs, sizeof(int32_t));
+  self->cache_base = base;
+  DART_LOG_DEBUG("dart_buddy_enable_cache: %zu slabs, objects up to %d bytes",
+                 num_slabs, DART_MEM_CACHE_MAX_BYTES);
+  return 0;
+}
+
+ssize_t
+dart_buddy_alloc(struct dart_buddy * self, size_t s) {
+  // honor the alignment
+  size_t size = (s >> DART_MEM_ALIGN_BITS);
+  if ((size<<DART_MEM_ALIGN_BITS) < s) ++size;
+  size = (int)next_pow_of_2(size);
+  size_t length = 1 << self->level;
+
+  if (size > length) {
+    DART_LOG_ERROR("Allocation size larger than total allocator size (%zu > %zu)",
+                   s, length<<DART_MEM_ALIGN_BITS);
+    return -1;
+  }
+
+  ssize_t offset = -1;
+  if (self->cache_base != NULL && size > 0 &&
+      size <= (DART_MEM_CACHE_MAX_BYTES >> DART_MEM_ALIGN_BITS)) {
+    int cls = 0;
+    while (((size_t)1 << cls) < size) {
+      ++cls;
+    }
+    offset = _cache_alloc(self, cls);
+  }
+  if (offset < 0) {
+    offset = _tree_alloc(self, size);
+  }
+  if (offset < 0) {
+    DART_LOG_ERROR(
+      "Allocation larger than remaining available allocator memory (%zu)", s);
+  }
+  return offset;
+}
+
+int dart_buddy_free(struct dart_buddy * self, uint64_t offset)
+{
+  if (self->cache_base != NULL &&
+      (offset >> DART_MEM_SLAB_BITS) < self->num_slabs) {
+    uint8_t cls = self->slab_class[offset >> DART_MEM_SLAB_BITS];
+    if (cls > 0) {
+      return _cache_free(self, cls - 1, offset);
+    }
+  }
+  return _tree_free(self, offset);
+}
+
 int buddy_size(struct dart_buddy * self, uint64_t offset)
 {
 	uint64_t left   = 0;
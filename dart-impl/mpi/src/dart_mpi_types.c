@@ -4,6 +4,9 @@
  * Provide functionality for creating derived data types in DART.
  *
  * Currently implemented: strided types based on basic types.
+ *
+ * Also provides the copy engine executing derived data types directly
+ * on shared memory.
  */
 
 #include <dash/dart/if/dart_types.h>
@@ -12,6 +15,8 @@
 #include <dash/dart/mpi/dart_communication_priv.h>
 
 #include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
 #include <limits.h>
 #include <mpi.h>
 #include <string.h>
@@ -234,6 +239,8 @@ dart_type_create_indexed(
   int *mpi_disps    = malloc(sizeof(int) * count);
 
   size_t num_elem = 0;
+  size_t disp_min = (count > 0) ? offset[0] : 0;
+  size_t disp_max = 0;
   for (size_t i = 0; i < count; ++i) {
     if (blocklen[i] > INT_MAX) {
       DART_LOG_ERROR("dart_type_create_indexed: blocklen[%zu] > INT_MAX", i);
@@ -250,6 +257,8 @@ dart_type_create_indexed(
     mpi_blocklen[i] = blocklen[i];
     mpi_disps[i]    = offset[i];
     num_elem       += blocklen[i];
+    if (offset[i] < disp_min) disp_min = offset[i];
+    if (offset[i] + blocklen[i] > disp_max) disp_max = offset[i] + blocklen[i];
   }
 
   MPI_Datatype mpi_base_type = basetype_struct->contiguous.mpi_type;
@@ -273,6 +282,8 @@ dart_type_create_indexed(
   new_struct->indexed.blocklens  = mpi_blocklen;
   new_struct->indexed.offsets    = mpi_disps;
   new_struct->indexed.num_blocks = count;
+  // consecutive instances are placed at multiples of the MPI type extent
+  new_struct->indexed.extent     = disp_max - disp_min;
 
   *newtype = (dart_datatype_t)new_struct;
 
@@ -354,6 +365,153 @@ dart_type_destroy(dart_datatype_t *dart_type_ptr)
   return DART_OK;
 }
 
+/* -- Shared-memory copy engine for derived data types -- */
+
+/*
+ * Cursor over the contiguous blocks of elements described by a data type.
+ */
+typedef struct {
+  const dart_datatype_struct_t * dts;
+  /// the index of the next block
+  size_t                         block;
+  /// the element offset of the current position
+  size_t                         offset;
+  /// the number of elements left in the current block
+  size_t                         len;
+} dart_type_cursor_t;
+
+static inline void
+type_cursor_next(dart_type_cursor_t * cursor, size_t remaining)
+{
+  const dart_datatype_struct_t * dts = cursor->dts;
+  do {
+    switch (dts->kind) {
+      case DART_KIND_STRIDED:
+        cursor->offset = cursor->block * dts->strided.stride;
+        cursor->len    = dts->num_elem;
+        break;
+      case DART_KIND_INDEXED: {
+        size_t rep     = cursor->block / dts->indexed.num_blocks;
+        size_t blk     = cursor->block % dts->indexed.num_blocks;
+        cursor->offset = rep * dts->indexed.extent + dts->indexed.offsets[blk];
+        cursor->len    = dts->indexed.blocklens[blk];
+        break;
+      }
+      default:
+        cursor->offset = 0;
+        cursor->len    = remaining;
+    }
+    ++cursor->block;
+  } while (cursor->len == 0);
+}
+
+static inline size_t
+type_elem_size(const dart_datatype_struct_t * dts)
+{
+  return (dts->kind == DART_KIND_BASIC || dts->kind == DART_KIND_CUSTOM)
+         ? dts->contiguous.size
+         : dart__mpi__datatype_struct(dts->base_type)->contiguous.size;
+}
+
+/*
+ * Element-wise gather/scatter between strided and contiguous memory.
+ * Loops over fixed-size elements are left to the compiler to vectorize.
+ */
+#define DART_TYPE_STRIDED_COPY(_type, _dst, _dst_stride, _src, _src_stride,  \
+                               _n)                                           \
+  do {                                                                       \
+    _type       * __restrict__ __d = (_type *)(_dst);                        \
+    const _type * __restrict__ __s = (const _type *)(_src);                  \
+    for (size_t __i = 0; __i < (_n); ++__i) {                                \
+      __d[__i * (_dst_stride)] = __s[__i * (_src_stride)];                   \
+    }                                                                        \
+  } while (0)
+
+static void
+strided_copy(
+  char       * dst,
+  size_t       dst_stride,
+  const char * src,
+  size_t       src_stride,
+  size_t       nelem,
+  size_t       elem_size)
+{
+  switch (elem_size) {
+    case 1:
+      DART_TYPE_STRIDED_COPY(uint8_t, dst, dst_stride, src, src_stride, nelem);
+      break;
+    case 2:
+      DART_TYPE_STRIDED_COPY(uint16_t, dst, dst_stride, src, src_stride, nelem);
+      break;
+    case 4:
+      DART_TYPE_STRIDED_COPY(uint32_t, dst, dst_stride, src, src_stride, nelem);
+      break;
+    case 8:
+      DART_TYPE_STRIDED_COPY(uint64_t, dst, dst_stride, src, src_stride, nelem);
+      break;
+    default:
+      for (size_t i = 0; i < nelem; ++i) {
+        memcpy(dst + i * dst_stride * elem_size,
+               src + i * src_stride * elem_size, elem_size);
+      }
+  }
+}
+
+void
+dart__mpi__datatype_copy(
+  void            * dst,
+  dart_datatype_t   dst_type,
+  const void      * src,
+  dart_datatype_t   src_type,
+  size_t            nelem)
+{
+  const dart_datatype_struct_t *src_dts = dart__mpi__datatype_struct(src_type);
+  const dart_datatype_struct_t *dst_dts = dart__mpi__datatype_struct(dst_type);
+  size_t elem_size = type_elem_size(src_dts);
+  char       * dst_ptr = (char *)dst;
+  const char * src_ptr = (const char *)src;
+
+  DART_LOG_TRACE("dart__mpi__datatype_copy: %zu elements of %zu bytes",
+                 nelem, elem_size);
+
+  // single elements with constant stride, e.g. matrix columns
+  bool src_contig = dart__mpi__datatype_iscontiguous(src_type);
+  bool dst_contig = dart__mpi__datatype_iscontiguous(dst_type);
+  if (src_dts->kind == DART_KIND_STRIDED && src_dts->num_elem == 1 &&
+      (dst_contig || (dst_dts->kind == DART_KIND_STRIDED &&
+                      dst_dts->num_elem == 1))) {
+    strided_copy(dst_ptr, dst_contig ? 1 : (size_t)dst_dts->strided.stride,
+                 src_ptr, src_dts->strided.stride, nelem, elem_size);
+    return;
+  }
+  if (dst_dts->kind == DART_KIND_STRIDED && dst_dts->num_elem == 1 &&
+      src_contig) {
+    strided_copy(dst_ptr, dst_dts->strided.stride,
+                 src_ptr, 1, nelem, elem_size);
+    return;
+  }
+
+  // general case: copy the overlapping parts of source and target blocks
+  dart_type_cursor_t src_cursor = { src_dts, 0, 0, 0 };
+  dart_type_cursor_t dst_cursor = { dst_dts, 0, 0, 0 };
+  size_t remaining = nelem;
+  while (remaining > 0) {
+    if (src_cursor.len == 0) type_cursor_next(&src_cursor, remaining);
+    if (dst_cursor.len == 0) type_cursor_next(&dst_cursor, remaining);
+    size_t n = (src_cursor.len < dst_cursor.len) ? src_cursor.len
+                                                 : dst_cursor.len;
+    if (n > remaining) n = remaining;
+    memcpy(dst_ptr + dst_cursor.offset * elem_size,
+           src_ptr + src_cursor.offset * elem_size,
+           n * elem_size);
+    src_cursor.offset += n;
+    src_cursor.len    -= n;
+    dst_cursor.offset += n;
+    dst_cursor.len    -= n;
+    remaining         -= n;
+  }
+}
+
 static void destroy_basic_type(dart_datatype_t dart_type_id)
 {
   dart_datatype_struct_t *dart_type = dart__mpi__datatype_struct(dart_type_id);
@@ -10,56 +10,90 @@
 #include <dash/dart/mpi/dart_segment.h>
 #include <dash/dart/mpi/dart_team_private.h>
 
-struct dart_seghash_elem {
-  dart_seghash_elem_t *next;
+struct dart_segment_elem {
+  dart_segment_elem_t *next;
   dart_segment_info_t  data;
 };
 
 
-static inline int hash_segid(dart_segid_t segid)
+/**
+ * Returns the table slot of the segment with ID \c segid, growing the
+ * tables if \c grow is set. Returns \c NULL if the segment ID is out of
+ * the range of the tables or the tables cannot be grown.
+ */
+static dart_segment_elem_t ** segment_slot(
+    dart_segmentdata_t *segdata,
+    dart_segid_t        segid,
+    bool                grow)
 {
-  /* Simply use the lower bits of the segment ID.
-   * Since segment IDs are allocated continuously, this is likely to cause
-   * collisions starting at (segment number == DART_SEGMENT_HASH_SIZE)
-   * TODO: come up with a random distribution to account for random free'd
-   * segments?
-   * */
-  return (abs(segid) % DART_SEGMENT_HASH_SIZE);
+  if (segid == DART_SEGMENT_LOCAL_EXT) {
+    return &segdata->local_ext_seg;
+  }
+
+  dart_segment_elem_t ***table    = &segdata->mem_segs;
+  int                   *capacity = &segdata->mem_capacity;
+  int                    idx      = segid;
+  if (segid < 0) {
+    table    = &segdata->reg_segs;
+    capacity = &segdata->reg_capacity;
+    idx      = -segid;
+  }
+
+  if (idx >= *capacity) {
+    if (!grow) {
+      return NULL;
+    }
+    int new_capacity = (*capacity > 0) ? *capacity
+                                       : DART_SEGMENT_TABLE_INIT_SIZE;
+    while (new_capacity <= idx) {
+      new_capacity *= 2;
+    }
+    dart_segment_elem_t **new_table =
+      realloc(*table, sizeof(dart_segment_elem_t*) * new_capacity);
+    if (new_table == NULL) {
+      DART_LOG_ERROR("dart_segment: failed to grow the segment table "
+                     "to %i entries on team %i",
+                     new_capacity, segdata->team_id);
+      return NULL;
+    }
+    *table = new_table;
+    memset(*table + *capacity, 0,
+           sizeof(dart_segment_elem_t*) * (new_capacity - *capacity));
+    *capacity = new_capacity;
+  }
+
+  return &(*table)[idx];
 }
 
-static inline void
-register_segment(dart_segmentdata_t *segdata, dart_seghash_elem_t *elem)
+static inline bool
+register_segment(dart_segmentdata_t *segdata, dart_segment_elem_t *elem)
 {
-  int slot = hash_segid(elem->data.segid);
-  elem->next = segdata->hashtab[slot];
-  segdata->hashtab[slot] = elem;
+  dart_segment_elem_t **slot = segment_slot(segdata, elem->data.segid, true);
+  if (slot == NULL) {
+    return false;
+  }
+  elem->next = NULL;
+  *slot      = elem;
+  return true;
 }
 
 static dart_segment_info_t * get_segment(
     dart_segmentdata_t *segdata,
     dart_segid_t        segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  while (elem != NULL) {
-    if (elem->data.segid == segid) {
-      break;
-    }
-    elem = elem->next;
-  }
+  dart_segment_elem_t **slot = segment_slot(segdata, segid, false);
 
-  if (elem == NULL) {
+  if (slot == NULL || *slot == NULL) {
     DART_LOG_ERROR("dart_segment__get_segment : "
                    "Invalid segment ID %i on team %i",
                    segid, segdata->team_id);
     return NULL;
   }
 
-  return &(elem->data);
+  return &((*slot)->data);
 }
 
-dart_segment_info_t * dart_segment_get_info(
+dart_segment_info_t * dart_segment_lookup(
   dart_segmentdata_t *segdata,
   dart_segid_t        segid)
 {
@@ -67,12 +101,15 @@ dart_segment_info_t * dart_segment_get_info(
 }
 
 /**
- * Initialize the segment data hash table.
+ * Initialize the segment data tables.
  */
 dart_ret_t dart_segment_init(dart_segmentdata_t *segdata, dart_team_t teamid)
 {
-  memset(segdata->hashtab, 0,
-    sizeof(dart_seghash_elem_t*) * DART_SEGMENT_HASH_SIZE);
+  segdata->mem_segs      = NULL;
+  segdata->reg_segs      = NULL;
+  segdata->mem_capacity  = 0;
+  segdata->reg_capacity  = 0;
+  segdata->local_ext_seg = NULL;
 
   segdata->team_id = teamid;
   segdata->mem_freelist = NULL;
@@ -95,11 +132,15 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
                  segdata->team_id);
 
   int16_t segid = INT16_MAX;
-  dart_seghash_elem_t *elem = NULL;
+  dart_segment_elem_t *elem = NULL;
   if (type == DART_SEGMENT_LOCAL_ALLOC) {
     // no need to check for overflow
     segid = DART_SEGMENT_LOCAL;
-    elem = calloc(1, sizeof(dart_seghash_elem_t));
+    elem = calloc(1, sizeof(dart_segment_elem_t));
+    elem->data.segid = segid;
+  } else if (type == DART_SEGMENT_LOCAL_ALLOC_EXT) {
+    segid = DART_SEGMENT_LOCAL_EXT;
+    elem = calloc(1, sizeof(dart_segment_elem_t));
     elem->data.segid = segid;
   } else if (type == DART_SEGMENT_ALLOC) {
     if (segdata->mem_freelist != NULL) {
@@ -114,7 +155,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->memid++;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else if (type == DART_SEGMENT_REGISTER) {
@@ -131,7 +172,7 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
         return NULL;
       }
       segid = segdata->registermemid--;
-      elem = calloc(1, sizeof(dart_seghash_elem_t));
+      elem = calloc(1, sizeof(dart_segment_elem_t));
       elem->data.segid = segid;
     }
   } else {
@@ -139,7 +180,10 @@ dart_segment_alloc(dart_segmentdata_t *segdata, dart_segment_type type)
     DART_ASSERT(type != DART_SEGMENT_REGISTER && type != DART_SEGMENT_ALLOC);
   }
 
-  register_segment(segdata, elem);
+  if (!register_segment(segdata, elem)) {
+    free(elem);
+    return NULL;
+  }
 
   DART_LOG_DEBUG("dart_segment_alloc > segid:%d team_id:%d",
                  segid, segdata->team_id);
@@ -297,50 +341,37 @@ dart_ret_t dart_segment_free(
   dart_segmentdata_t  * segdata,
   dart_segid_t          segid)
 {
-  int slot = hash_segid(segid);
-  dart_seghash_elem_t *pred = NULL;
-  dart_seghash_elem_t *elem = segdata->hashtab[slot];
-
-  // find the correct entry in this bucket
-  pred = NULL;
-  while (elem != NULL) {
-
-    if (elem->data.segid == segid) {
-      if (pred != NULL) {
-        pred->next = elem->next;
-      } else {
-        segdata->hashtab[slot] = elem->next;
-      }
-      // no need for locking since operations on the same segmentdata
-      // are not thread-safe
-      if (segid > 0) {
-        elem->next            = segdata->mem_freelist;
-        segdata->mem_freelist = elem;
-      } else if (segid < 0){
-        elem->next            = segdata->reg_freelist;
-        segdata->reg_freelist = elem;
-      } else {
-        // This should not happen!
-        DART_ASSERT(segid != 0);
-      }
-      // set the segment ID again
-      elem->data.segid = segid;
-      return DART_OK;
-    }
+  dart_segment_elem_t **slot = segment_slot(segdata, segid, false);
 
-    pred = elem;
-    elem = elem->next;
+  if (slot == NULL || *slot == NULL) {
+    // element not found
+    return DART_ERR_INVAL;
   }
 
-  // element not found
-  return DART_ERR_INVAL;
+  dart_segment_elem_t *elem = *slot;
+  *slot = NULL;
+  // no need for locking since operations on the same segmentdata
+  // are not thread-safe
+  if (segid > 0) {
+    elem->next            = segdata->mem_freelist;
+    segdata->mem_freelist = elem;
+  } else if (segid < 0){
+    elem->next            = segdata->reg_freelist;
+    segdata->reg_freelist = elem;
+  } else {
+    // This should not happen!
+    DART_ASSERT(segid != 0);
+  }
+  // set the segment ID again
+  elem->data.segid = segid;
+  return DART_OK;
 }
 
-static void clear_segdata_list(dart_seghash_elem_t *listhead)
+static void clear_segdata_list(dart_segment_elem_t *listhead)
 {
-  dart_seghash_elem_t *elem = listhead;
+  dart_segment_elem_t *elem = listhead;
   while (elem != NULL) {
-    dart_seghash_elem_t *tmp = elem;
+    dart_segment_elem_t *tmp = elem;
     elem = tmp->next;
     tmp->next = NULL;
     // segment info should have been cleared in dart_segment_fini
@@ -352,7 +383,7 @@ static void clear_segdata_list(dart_seghash_elem_t *listhead)
 }
 
 /**
- * @brief Clear the segment data hash table.
+ * @brief Clear the segment data tables.
  */
 dart_ret_t dart_segment_fini(
   dart_segmentdata_t  * segdata)
@@ -365,11 +396,21 @@ dart_ret_t dart_segment_fini(
     free_segment_info(seg);
   }
 
-  // clear the remaining hash table
-  for (int i = 0; i < DART_SEGMENT_HASH_SIZE; i++) {
-    clear_segdata_list(segdata->hashtab[i]);
-    segdata->hashtab[i] = NULL;
+  // clear the remaining segment tables
+  for (int i = 0; i < segdata->mem_capacity; i++) {
+    clear_segdata_list(segdata->mem_segs[i]);
+  }
+  for (int i = 0; i < segdata->reg_capacity; i++) {
+    clear_segdata_list(segdata->reg_segs[i]);
   }
+  clear_segdata_list(segdata->local_ext_seg);
+  free(segdata->mem_segs);
+  free(segdata->reg_segs);
+  segdata->mem_segs      = NULL;
+  segdata->reg_segs      = NULL;
+  segdata->mem_capacity  = 0;
+  segdata->reg_capacity  = 0;
+  segdata->local_ext_seg = NULL;
   clear_segdata_list(segdata->mem_freelist);
   segdata->mem_freelist = NULL;
 
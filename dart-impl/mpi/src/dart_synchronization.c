@@ -7,6 +7,7 @@
 #include <dash/dart/base/logging.h>
 #include <dash/dart/base/assert.h>
 #include <dash/dart/base/mutex.h>
+#include <dash/dart/base/env.h>
 
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_globmem.h>
@@ -20,24 +21,122 @@
 #include <dash/dart/mpi/dart_synchronization_priv.h>
 #include <dash/dart/mpi/dart_segment.h>
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <malloc.h>
 
 
+/**
+ * Locks are hierarchical MCS queue locks (cohort locks): units on the same
+ * node queue in a node-local MCS queue held in a shared memory window. The
+ * head of a node queue enqueues in a global MCS queue among nodes. Once a
+ * node holds the global lock, it is handed over between the node's units
+ * without global communication for at most \c batch_max consecutive
+ * acquisitions before it is passed on to the next node.
+ *
+ * Shared (reader) acquisitions are admitted per node: readers register in a
+ * counter at the first unit of their node (the node leader) and never enter
+ * the queues. Once the lock has been used in shared mode, a node acquiring
+ * the global lock for exclusive access raises the writer flag at all node
+ * leaders and waits for their reader counters to drain, so exclusive
+ * acquisitions handed over within a node do not pay for reader exclusion
+ * again. Locks only used for exclusive access skip reader exclusion.
+ *
+ * Before its first shared acquisition, a unit marks the lock as used in
+ * shared mode at all node leaders and passes through the queues once
+ * without excluding readers (or, when trying to acquire the lock, finds the
+ * global lock free), so exclusive holders that skipped reader exclusion
+ * have released the lock.
+ */
+
+/* Slots of every unit in the node-local window */
+/** Node rank of the successor in the node queue */
+#define LOCAL_NEXT       0
+/** Status of the unit waiting in the node queue */
+#define LOCAL_STATUS     1
+/** At node rank 0: node rank at the tail of the node queue */
+#define LOCAL_TAIL       2
+/** At node rank 0: number of handovers since the global lock was acquired */
+#define LOCAL_BATCH      3
+/** At node rank 0: team unit whose global queue element holds the lock */
+#define LOCAL_OWNER      4
+/** At node rank 0: non-zero if the node holding the lock excludes readers */
+#define LOCAL_EXCLUDED   5
+#define LOCAL_NUM_SLOTS  6
+
+/* Slots of every unit in the global queue element */
+/** Team unit enqueued after this unit in the global queue */
+#define GLOBAL_NEXT      0
+/** Non-zero while waiting for the global lock */
+#define GLOBAL_WAIT      1
+/** At node leaders: number of units on the node holding the lock shared */
+#define GLOBAL_READERS   2
+/** At node leaders: non-zero while a node holds the global lock */
+#define GLOBAL_WRITER    3
+/** At node leaders: non-zero once the lock has been used in shared mode */
+#define GLOBAL_SHARED    4
+#define GLOBAL_NUM_SLOTS 5
+
+/* Values of LOCAL_STATUS */
+#define LOCK_WAITING        0
+/** The lock was handed over with the global lock held by the node */
+#define LOCK_GRANTED_GLOBAL 1
+/** The node queue was handed over, the global lock has to be acquired */
+#define LOCK_GRANTED_LOCAL  2
+
+/* Values of dart_lock_struct::is_acquired */
+#define LOCK_HELD_NONE      0
+#define LOCK_HELD_EXCLUSIVE 1
+#define LOCK_HELD_SHARED    2
+
+/**
+ * Name of the environment variable setting the maximum number of
+ * consecutive lock handovers between units of a node. A value of 0
+ * disables node-local queueing.
+ */
+#define DART_LOCK_COHORT_BATCH_ENVSTR  "DART_LOCK_COHORT_BATCH"
+#define DART_LOCK_COHORT_BATCH_DEFAULT 64
+
 struct dart_lock_struct
 {
   /**
-   * Global memory storing the unit at the tail of lock queue.
+   * Global memory storing the unit at the tail of the global lock queue.
    * Stored in team-unit 0 by default.
    */
   dart_gptr_t  gptr_tail;
   /**
-   * Pointer to the current unit's successor in the waiting list,
-   * to which we send a release message.
+   * Global queue elements of all units: the unit's successor in the global
+   * queue and whether it is waiting for the global lock.
    */
   dart_gptr_t  gptr_list;
+  /**
+   * Window used for atomic operations on the tail, depends on whether the
+   * tail was allocated from the local allocation pool or a chained chunk.
+   */
+  MPI_Win      tail_win;
+  /**
+   * Window used for atomic operations on the global queue elements.
+   */
+  MPI_Win      list_win;
+  /**
+   * Shared memory window holding the node-local lock state, spanning the
+   * units of the team on the same node.
+   */
+  MPI_Win      local_win;
+  /** Rank of this unit in \c local_win */
+  int          local_rank;
+  /** Maximum number of consecutive handovers within a node */
+  int32_t      batch_max;
+  /** Team unit holding the reader counter of this unit's node */
+  dart_unit_t  leader_unit;
+  /** Whether this unit marked the lock as used in shared mode */
+  bool         shared_enabled;
+  /** Team units of all node leaders */
+  dart_unit_t *leaders;
+  /** Number of node leaders in the team */
+  int          num_leaders;
   /**
    * Pointer to the next element a the list.
    */
@@ -47,12 +146,351 @@ struct dart_lock_struct
    */
   dart_mutex_t mutex;
   dart_team_t teamid;
-  /** Whether this unit has acquired the lock. */
+  /** Whether this unit has acquired the lock, one of LOCK_HELD_*. */
   int32_t is_acquired;
 };
 
 static dart_ret_t destroy_lock_segments(dart_lock_t lock);
 
+/**
+ * The window holding the tail of a lock, which is allocated through
+ * \c dart_memalloc in \c DART_TEAM_ALL.
+ */
+static inline MPI_Win lock_tail_win(dart_gptr_t gptr_tail)
+{
+  dart_segment_info_t *seginfo = dart_segment_get_info(
+      &(dart_adapt_teamlist_get(DART_TEAM_ALL)->segdata), gptr_tail.segid);
+  return (seginfo != NULL) ? seginfo->win : dart_win_local_alloc;
+}
+
+static inline void lock_progress(dart_team_data_t *team_data)
+{
+  int flag;
+  MPI_Iprobe(
+    MPI_ANY_SOURCE, MPI_ANY_TAG,
+    team_data->comm, &flag, MPI_STATUS_IGNORE);
+}
+
+/**
+ * Atomic operation on a slot of the node-local lock state of the unit with
+ * rank \c rank on this node.
+ */
+static int32_t local_op(
+  dart_lock_t lock,
+  int         rank,
+  int         slot,
+  MPI_Op      op,
+  int32_t     value)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT32_T, rank, slot, op, lock->local_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(rank, lock->local_win),
+    MPI_SUCCESS);
+  return result;
+}
+
+static int32_t local_cas(
+  dart_lock_t lock,
+  int         rank,
+  int         slot,
+  int32_t     compare,
+  int32_t     value)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value, &compare, &result, MPI_INT32_T, rank, slot, lock->local_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(rank, lock->local_win),
+    MPI_SUCCESS);
+  return result;
+}
+
+/**
+ * Atomic operation on a slot of the global queue element of \c unit.
+ */
+static int32_t global_op(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  dart_unit_t              unit,
+  int                      slot,
+  MPI_Op                   op,
+  int32_t                  value)
+{
+  dart_segment_info_t *list_seginfo = dart_segment_get_info(
+      &(team_data->segdata), lock->gptr_list.segid);
+  MPI_Aint disp = dart_segment_disp(list_seginfo, DART_TEAM_UNIT_ID(unit))
+                  + slot * sizeof(int32_t);
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &value, &result, MPI_INT32_T, unit, disp, op, lock->list_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(unit, lock->list_win),
+    MPI_SUCCESS);
+  return result;
+}
+
+/**
+ * Raise the writer flag at all node leaders, denying admission to new
+ * readers.
+ */
+static void writer_enter(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  for (int i = 0; i < lock->num_leaders; ++i) {
+    global_op(lock, team_data, lock->leaders[i], GLOBAL_WRITER,
+              MPI_REPLACE, 1);
+  }
+}
+
+static void writer_exit(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  for (int i = 0; i < lock->num_leaders; ++i) {
+    global_op(lock, team_data, lock->leaders[i], GLOBAL_WRITER,
+              MPI_REPLACE, 0);
+  }
+}
+
+/**
+ * Whether units on any node currently hold the lock shared.
+ */
+static bool readers_active(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  for (int i = 0; i < lock->num_leaders; ++i) {
+    if (global_op(lock, team_data, lock->leaders[i], GLOBAL_READERS,
+                  MPI_NO_OP, 0) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Atomic operation on a slot of the global queue element of the node
+ * leader. Only readers modify the reader counter, so its updates are atomic
+ * with respect to each other. All accesses to the slots of the node leader
+ * use the window of the global queue elements.
+ */
+static inline int32_t leader_op(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  int                      slot,
+  MPI_Op                   op,
+  int32_t                  value)
+{
+  return global_op(lock, team_data, lock->leader_unit, slot, op, value);
+}
+
+/**
+ * Exclude readers for as long as the node holds the global lock if the
+ * lock has been used in shared mode. Waits for active readers to release
+ * the lock if \c wait is set.
+ *
+ * \return Whether no readers hold the lock.
+ */
+static bool writer_exclude(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  bool                     wait)
+{
+  int32_t excluded = (leader_op(lock, team_data, GLOBAL_SHARED,
+                                MPI_NO_OP, 0) != 0);
+  local_op(lock, 0, LOCAL_EXCLUDED, MPI_REPLACE, excluded);
+  if (!excluded) {
+    return true;
+  }
+  writer_enter(lock, team_data);
+  if (!wait) {
+    return !readers_active(lock, team_data);
+  }
+  while (readers_active(lock, team_data)) {
+    lock_progress(team_data);
+  }
+  return true;
+}
+
+/**
+ * Mark the lock as used in shared mode at all node leaders, exclusive
+ * acquisitions exclude readers afterwards.
+ */
+static void shared_enable(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  for (int i = 0; i < lock->num_leaders; ++i) {
+    global_op(lock, team_data, lock->leaders[i], GLOBAL_SHARED,
+              MPI_REPLACE, 1);
+  }
+}
+
+/**
+ * Register as reader at the node leader unless a writer holds the lock.
+ */
+static bool reader_try_enter(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  if (leader_op(lock, team_data, GLOBAL_WRITER, MPI_NO_OP, 0) != 0) {
+    return false;
+  }
+  leader_op(lock, team_data, GLOBAL_READERS, MPI_SUM, 1);
+  /* A writer may have raised its flag before observing our registration */
+  if (leader_op(lock, team_data, GLOBAL_WRITER, MPI_NO_OP, 0) != 0) {
+    leader_op(lock, team_data, GLOBAL_READERS, MPI_SUM, -1);
+    return false;
+  }
+  return true;
+}
+
+static int32_t tail_cas(
+  dart_lock_t lock,
+  int32_t     compare,
+  int32_t     value)
+{
+  int32_t result;
+  DART_ASSERT_RETURNS(
+    MPI_Compare_and_swap(
+      &value,
+      &compare,
+      &result,
+      MPI_INT32_T,
+      lock->gptr_tail.unitid,
+      lock->gptr_tail.addr_or_offs.offset,
+      lock->tail_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(lock->gptr_tail.unitid, lock->tail_win),
+    MPI_SUCCESS);
+  return result;
+}
+
+/**
+ * Enqueue this unit in the global queue and wait for the global lock.
+ * Called by the unit at the head of the node queue.
+ */
+static void global_acquire(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  dart_team_unit_t         unitid,
+  bool                     exclude_readers)
+{
+  int32_t predecessor;
+
+  global_op(lock, team_data, unitid.id, GLOBAL_NEXT, MPI_REPLACE, -1);
+  global_op(lock, team_data, unitid.id, GLOBAL_WAIT, MPI_REPLACE, 1);
+
+  /* Fetch the current tail and make this unit the new tail */
+  DART_LOG_TRACE(
+    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
+    "tail_unit %i with offset %lu",
+    unitid.id, lock->gptr_tail.unitid, lock->gptr_tail.addr_or_offs.offset);
+  DART_ASSERT_RETURNS(
+    MPI_Fetch_and_op(
+      &unitid.id,
+      &predecessor,
+      MPI_INT32_T,
+      lock->gptr_tail.unitid,
+      lock->gptr_tail.addr_or_offs.offset,
+      MPI_REPLACE,
+      lock->tail_win),
+    MPI_SUCCESS);
+  DART_ASSERT_RETURNS(
+    MPI_Win_flush(lock->gptr_tail.unitid, lock->tail_win),
+    MPI_SUCCESS);
+
+  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
+    predecessor, unitid.id);
+
+  /* If there was a previous tail (predecessor), update the previous tail's
+   * next pointer with unitid and wait for notification from its node.
+   */
+  if (predecessor != -1) {
+    global_op(lock, team_data, predecessor, GLOBAL_NEXT, MPI_REPLACE,
+              unitid.id);
+
+    DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
+                   "%d in team %d",
+                   predecessor, lock->teamid);
+    while (global_op(lock, team_data, unitid.id, GLOBAL_WAIT,
+                     MPI_NO_OP, 0) != 0) {
+      lock_progress(team_data);
+    }
+  }
+
+  local_op(lock, 0, LOCAL_OWNER, MPI_REPLACE, unitid.id);
+  local_op(lock, 0, LOCAL_BATCH, MPI_REPLACE, 0);
+
+  if (exclude_readers) {
+    writer_exclude(lock, team_data, true);
+  } else {
+    local_op(lock, 0, LOCAL_EXCLUDED, MPI_REPLACE, 0);
+  }
+}
+
+/**
+ * Pass the global lock held by this node to the next node in the global
+ * queue. Called by the unit holding the lock, which is not necessarily the
+ * owner of the global queue element.
+ */
+static void global_release(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  int32_t owner = local_op(lock, 0, LOCAL_OWNER, MPI_NO_OP, 0);
+
+  if (local_op(lock, 0, LOCAL_EXCLUDED, MPI_NO_OP, 0) != 0) {
+    writer_exit(lock, team_data);
+  }
+
+  int32_t next  = global_op(lock, team_data, owner, GLOBAL_NEXT,
+                            MPI_NO_OP, 0);
+
+  if (next == -1) {
+    /* Check if the owner is at the tail of the global queue and reset the
+     * tail pointer if it is. */
+    if (tail_cas(lock, owner, -1) == owner) {
+      return;
+    }
+    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
+                   "of unit %d in team %d", owner, lock->teamid);
+    do {
+      lock_progress(team_data);
+      next = global_op(lock, team_data, owner, GLOBAL_NEXT, MPI_NO_OP, 0);
+    } while (next == -1);
+  }
+
+  DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
+                 lock->teamid);
+  global_op(lock, team_data, next, GLOBAL_WAIT, MPI_REPLACE, 0);
+}
+
+/**
+ * Wait for the successor of this unit in the node queue to link itself.
+ */
+static int32_t local_wait_next(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data)
+{
+  int32_t next;
+  while ((next = local_op(lock, lock->local_rank, LOCAL_NEXT,
+                          MPI_NO_OP, 0)) == -1) {
+    lock_progress(team_data);
+  }
+  return next;
+}
+
 dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 {
   int ret;
@@ -85,13 +523,13 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
     /* Local store is safe and effective followed by the sync call. */
     *tail_ptr = -1;
-    MPI_Win_sync(dart_win_local_alloc);
+    MPI_Win_sync(lock_tail_win(gptr_tail));
   }
 
   /* Create a global memory region across the team.
-   * Every local memory segment holds the next unit
-   * waiting on the lock. */
-  ret = dart_team_memalloc_aligned(teamid, 1, DART_TYPE_INT, &gptr_list);
+   * Every local memory segment holds the global queue element of a unit. */
+  ret = dart_team_memalloc_aligned(
+          teamid, GLOBAL_NUM_SLOTS, DART_TYPE_INT, &gptr_list);
   if (ret != DART_OK) {
     DART_LOG_ERROR("%s: Failed to allocate global memory!", __func__);
     return ret;
@@ -104,9 +542,66 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
 
   dart_gptr_setunit(&gptr_list, unitid);
   dart_gptr_getaddr(gptr_list, (void*)&list_ptr);
-  *list_ptr = -1;
+  list_ptr[GLOBAL_NEXT]    = -1;
+  list_ptr[GLOBAL_WAIT]    = 0;
+  list_ptr[GLOBAL_READERS] = 0;
+  list_ptr[GLOBAL_WRITER]  = 0;
+  list_ptr[GLOBAL_SHARED]  = 0;
   MPI_Win_sync(win);
 
+  /* Units of the team on the same node share the node-local lock state,
+   * every unit forms a node of its own if node-local queueing is
+   * disabled. All units have to agree on the node-local communicator. */
+  int32_t batch_max = dart__base__env__number(
+                        DART_LOCK_COHORT_BATCH_ENVSTR,
+                        DART_LOCK_COHORT_BATCH_DEFAULT);
+  MPI_Allreduce(
+    MPI_IN_PLACE, &batch_max, 1, MPI_INT32_T, MPI_MIN, team_data->comm);
+  MPI_Comm local_comm = MPI_COMM_SELF;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (batch_max > 0 && team_data->sharedmem_comm != MPI_COMM_NULL) {
+    local_comm = team_data->sharedmem_comm;
+  }
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+
+  int32_t *local_ptr;
+  MPI_Win  local_win;
+  if (MPI_Win_allocate_shared(
+        LOCAL_NUM_SLOTS * sizeof(int32_t), sizeof(int32_t), MPI_INFO_NULL,
+        local_comm, &local_ptr, &local_win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("%s: Failed to allocate node-local lock state!",
+                   __func__);
+    dart_team_memfree(gptr_list);
+    return DART_ERR_OTHER;
+  }
+  local_ptr[LOCAL_NEXT]   = -1;
+  local_ptr[LOCAL_STATUS] = LOCK_WAITING;
+  local_ptr[LOCAL_TAIL]   = -1;
+  local_ptr[LOCAL_BATCH]  = 0;
+  local_ptr[LOCAL_OWNER]  = -1;
+  local_ptr[LOCAL_EXCLUDED] = 0;
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, local_win);
+  MPI_Win_sync(local_win);
+  int local_rank;
+  MPI_Comm_rank(local_comm, &local_rank);
+
+  /* The first unit in the node-local communicator is the node leader
+   * holding the reader counter of the node */
+  dart_unit_t leader_unit = unitid.id;
+  MPI_Bcast(&leader_unit, 1, MPI_INT32_T, 0, local_comm);
+  int  is_leader = (leader_unit == unitid.id);
+  int *leader_flags = malloc(team_data->size * sizeof(int));
+  MPI_Allgather(&is_leader, 1, MPI_INT, leader_flags, 1, MPI_INT,
+                team_data->comm);
+  dart_unit_t *leaders     = malloc(team_data->size * sizeof(dart_unit_t));
+  int          num_leaders = 0;
+  for (int u = 0; u < team_data->size; ++u) {
+    if (leader_flags[u]) {
+      leaders[num_leaders++] = (dart_unit_t)u;
+    }
+  }
+  free(leader_flags);
+
   // communicate tail pointer
   ret = dart_bcast(
     &gptr_tail,
@@ -123,8 +618,17 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   *lock = malloc(sizeof(struct dart_lock_struct));
   (*lock)->gptr_tail   = gptr_tail;
   (*lock)->gptr_list   = gptr_list;
+  (*lock)->tail_win    = lock_tail_win(gptr_tail);
+  (*lock)->list_win    = win;
+  (*lock)->local_win   = local_win;
+  (*lock)->local_rank  = local_rank;
+  (*lock)->batch_max   = batch_max;
+  (*lock)->leader_unit = leader_unit;
+  (*lock)->shared_enabled = false;
+  (*lock)->leaders     = leaders;
+  (*lock)->num_leaders = num_leaders;
   (*lock)->teamid      = teamid;
-  (*lock)->is_acquired = 0;
+  (*lock)->is_acquired = LOCK_HELD_NONE;
   DART_ASSERT_RETURNS(
     dart__base__mutex_init_recursive(&(*lock)->mutex),
     DART_OK);
@@ -138,12 +642,53 @@ dart_ret_t dart_team_lock_init(dart_team_t teamid, dart_lock_t* lock)
   return DART_OK;
 }
 
+/**
+ * Acquire the lock for exclusive access. Readers are excluded unless
+ * \c exclude_readers is unset.
+ */
+static void exclusive_acquire(
+  dart_lock_t              lock,
+  dart_team_data_t       * team_data,
+  bool                     exclude_readers)
+{
+  dart_team_unit_t unitid;
+  dart_team_myid(lock->teamid, &unitid);
+
+  int     me     = lock->local_rank;
+  int32_t status = LOCK_GRANTED_LOCAL;
+
+  local_op(lock, me, LOCAL_NEXT,   MPI_REPLACE, -1);
+  local_op(lock, me, LOCAL_STATUS, MPI_REPLACE, LOCK_WAITING);
+
+  /* Enqueue in the node queue */
+  int32_t predecessor = local_op(lock, 0, LOCAL_TAIL, MPI_REPLACE, me);
+  if (predecessor != -1) {
+    local_op(lock, predecessor, LOCAL_NEXT, MPI_REPLACE, me);
+    DART_LOG_DEBUG("dart_lock_acquire: waiting for node-local predecessor "
+                   "%d in team %d", predecessor, lock->teamid);
+    while ((status = local_op(lock, me, LOCAL_STATUS, MPI_NO_OP, 0))
+           == LOCK_WAITING) {
+      lock_progress(team_data);
+    }
+  }
+
+  if (status == LOCK_GRANTED_LOCAL) {
+    /* Head of the node queue, the node does not hold the global lock */
+    global_acquire(lock, team_data, unitid, exclude_readers);
+  } else if (exclude_readers &&
+             local_op(lock, 0, LOCAL_EXCLUDED, MPI_NO_OP, 0) == 0) {
+    /* The lock may have been used in shared mode since the node acquired
+     * the global lock */
+    writer_exclude(lock, team_data, true);
+  }
+}
+
 dart_ret_t dart_lock_acquire(dart_lock_t lock)
 {
   /* lock the local mutex and keep it until the global lock is released */
   DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
 
-  if (lock->is_acquired == 1)
+  if (lock->is_acquired != LOCK_HELD_NONE)
   {
     DART_LOG_ERROR("dart_lock_acquire: LOCK has already been acquired\n");
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
@@ -158,79 +703,10 @@ dart_ret_t dart_lock_acquire(dart_lock_t lock)
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
-
-  int32_t predecessor;
-
-  /* Fetch the current unit's tail and make this unit the new tail */
-  DART_LOG_TRACE(
-    "dart_lock_acquire: MPI_Fetch_and_op to set tail to unit %i on "
-    "tail_unit %i with offset %lu",
-    unitid.id, tail_unit, tail_offset);
-  DART_ASSERT_RETURNS(
-    MPI_Fetch_and_op(
-      &unitid.id,
-      &predecessor,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      MPI_REPLACE,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-      MPI_Win_flush(tail_unit, dart_win_local_alloc),
-      MPI_SUCCESS);
-
-  DART_LOG_TRACE("dart_lock_acquire: predecessor: %i unitid.id: %i",
-    predecessor, unitid.id);
-
-  /* If there was a previous tail (predecessor), update the previous tail's
-   * next pointer with unitid and wait for notification from its predecessor.
-   */
-  if (predecessor != -1) {
-    int32_t    result;
-    MPI_Status status;
-
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win  win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(
-                            list_seginfo, DART_TEAM_UNIT_ID(predecessor));
-
-    /* Atomicity: Update its predecessor's next pointer */
-    DART_ASSERT_RETURNS(
-      MPI_Fetch_and_op(
-        &unitid.id,
-        &result,
-        MPI_INT32_T,
-        predecessor,
-        disp_list,
-        MPI_REPLACE,
-        win),
-      MPI_SUCCESS);
-
-    DART_ASSERT_RETURNS(
-      MPI_Win_flush(predecessor, win),
-      DART_OK);
-
-    /* Waiting for notification from its predecessor*/
-    DART_LOG_DEBUG("dart_lock_acquire: waiting for notification from "
-                   "%d in team %d",
-                   predecessor, lock->teamid);
-
-    MPI_Recv(NULL, 0, MPI_INT, predecessor, 0, team_data->comm,
-        &status);
-  }
+  exclusive_acquire(lock, team_data, true);
 
   DART_LOG_DEBUG("dart_lock_acquire: lock acquired in team %d", lock->teamid);
-  lock->is_acquired = 1;
+  lock->is_acquired = LOCK_HELD_EXCLUSIVE;
   return DART_OK;
 }
 
@@ -242,7 +718,7 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_OK;
   }
 
-  if (lock->is_acquired == 1)
+  if (lock->is_acquired != LOCK_HELD_NONE)
   {
     DART_LOG_ERROR("dart_lock_try_acquire: LOCK has already been acquired\n");
     *is_acquired = 1;
@@ -251,40 +727,48 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
     return DART_ERR_INVAL;
   }
 
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
   dart_team_unit_t unitid;
   dart_team_myid(lock->teamid, &unitid);
 
-  int32_t result;
-  int32_t compare = -1;
-
-
-  dart_gptr_t gptr_tail   = lock->gptr_tail;
-  dart_unit_t tail_unit   = gptr_tail.unitid;
-  uint64_t    tail_offset = gptr_tail.addr_or_offs.offset;
-
-  /* Atomicity: Check if the lock is available and claim it if it is. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &unitid.id,
-      &compare,
-      &result,
-      MPI_INT32_T,
-      tail_unit,
-      tail_offset,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush (tail_unit, dart_win_local_alloc),
-    MPI_SUCCESS);
+  int me = lock->local_rank;
+  *is_acquired = 0;
+
+  local_op(lock, me, LOCAL_NEXT,   MPI_REPLACE, -1);
+  local_op(lock, me, LOCAL_STATUS, MPI_REPLACE, LOCK_WAITING);
+
+  /* Atomicity: Check if the node queue is empty and claim it if it is.
+   * Otherwise, another unit on the node holds or waits for the lock. */
+  if (local_cas(lock, 0, LOCAL_TAIL, -1, me) == -1) {
+    global_op(lock, team_data, unitid.id, GLOBAL_NEXT, MPI_REPLACE, -1);
+    /* Check if the global lock is available and claim it if it is. */
+    if (tail_cas(lock, -1, unitid.id) == -1) {
+      local_op(lock, 0, LOCAL_OWNER, MPI_REPLACE, unitid.id);
+      local_op(lock, 0, LOCAL_BATCH, MPI_REPLACE, 0);
+      if (writer_exclude(lock, team_data, false)) {
+        lock->is_acquired = LOCK_HELD_EXCLUSIVE;
+        *is_acquired = 1;
+      } else {
+        /* The lock is held shared, pass the global lock on to units that
+         * enqueued in the meantime */
+        global_release(lock, team_data);
+      }
+    }
+    if (!*is_acquired &&
+        local_cas(lock, 0, LOCAL_TAIL, me, -1) != me) {
+      /* A unit on the node enqueued in the meantime, hand the node queue
+       * over to let it acquire the global lock. */
+      int32_t next = local_wait_next(lock, team_data);
+      local_op(lock, next, LOCAL_STATUS, MPI_REPLACE, LOCK_GRANTED_LOCAL);
+    }
+  }
 
-  /* If the old predecessor was -1, we have claimed the lock,
-   * otherwise, do nothing. */
-  if (result == -1)
-  {
-    lock->is_acquired = 1;
-    *is_acquired = 1;
-  } else {
-    *is_acquired = 0;
+  if (!*is_acquired) {
+    /* Failed attempts only access the node-local state, trigger progress of
+     * global operations targeting this unit for callers polling the lock */
+    lock_progress(team_data);
     /* unlock the local mutex if we have not acqcuired the global lock */
     DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
   }
@@ -297,94 +781,180 @@ dart_ret_t dart_lock_try_acquire(dart_lock_t lock, int32_t *is_acquired)
 
 dart_ret_t dart_lock_release(dart_lock_t lock)
 {
-  if (lock->is_acquired == 0) {
+  if (lock->is_acquired == LOCK_HELD_NONE) {
     DART_LOG_ERROR("dart_lock_release: LOCK has not been acquired before\n");
     return DART_ERR_INVAL;
   }
 
-  dart_gptr_t gptr_tail = lock->gptr_tail;
-  dart_gptr_t gptr_list = lock->gptr_list;
-
   dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
   DART_ASSERT(team_data != NULL);
 
-  uint64_t      offset_tail = gptr_tail.addr_or_offs.offset;
-  dart_unit_t   tail        = gptr_tail.unitid;
-  int32_t     * addr;
-  DART_ASSERT_RETURNS(dart_gptr_getaddr(gptr_list, (void *)&addr), DART_OK);
+  if (lock->is_acquired == LOCK_HELD_SHARED) {
+    leader_op(lock, team_data, GLOBAL_READERS, MPI_SUM, -1);
+    lock->is_acquired = LOCK_HELD_NONE;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    DART_LOG_DEBUG("dart_lock_release: release shared lock in team %d",
+                   lock->teamid);
+    return DART_OK;
+  }
 
-  dart_team_unit_t unitid;
-  dart_team_myid(lock->teamid, &unitid);
+  int     me   = lock->local_rank;
+  int32_t next = local_op(lock, me, LOCAL_NEXT, MPI_NO_OP, 0);
+
+  if (next != -1 &&
+      local_op(lock, 0, LOCAL_BATCH, MPI_NO_OP, 0) < lock->batch_max) {
+    /* Hand the lock over to the next unit on the node, keeping the global
+     * lock in the node. */
+    local_op(lock, 0, LOCAL_BATCH, MPI_SUM, 1);
+    DART_LOG_DEBUG("dart_lock_release: handing over to node-local unit %d "
+                   "in team %d", next, lock->teamid);
+    local_op(lock, next, LOCAL_STATUS, MPI_REPLACE, LOCK_GRANTED_GLOBAL);
+  } else {
+    global_release(lock, team_data);
+    /* Check if we are at the tail of the node queue and reset the tail
+     * pointer if we are. Otherwise, let the successor acquire the global
+     * lock. */
+    if (next != -1 || local_cas(lock, 0, LOCAL_TAIL, me, -1) != me) {
+      if (next == -1) {
+        next = local_wait_next(lock, team_data);
+      }
+      local_op(lock, next, LOCAL_STATUS, MPI_REPLACE, LOCK_GRANTED_LOCAL);
+    }
+  }
 
-  int32_t result;
-  int32_t reset = -1;
+  lock->is_acquired = LOCK_HELD_NONE;
+  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
+                 (lock -> teamid));
+  return DART_OK;
+}
 
-  /* Check if we are at the tail of this lock queue and reset the tail pointer
-   * if we are. If that is the case we are done.
-   * Otherwise, the reset fails and we need to send notification. */
-  DART_ASSERT_RETURNS(
-    MPI_Compare_and_swap(
-      &reset,
-      &unitid.id,
-      &result,
-      MPI_INT32_T,
-      tail,
-      offset_tail,
-      dart_win_local_alloc),
-    MPI_SUCCESS);
-  DART_ASSERT_RETURNS(
-    MPI_Win_flush(tail, dart_win_local_alloc),
-    MPI_SUCCESS);
+dart_ret_t dart_lock_acquire_shared(dart_lock_t lock)
+{
+  DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
 
-  if (result != unitid.id) {
-    /* We are not at the tail of this lock queue. */
-    int32_t  next;
-    DART_LOG_DEBUG("dart_lock_release: waiting for next pointer "
-                   "(tail = %d) in team %d",
-                   result, (lock -> teamid));
+  if (lock->is_acquired != LOCK_HELD_NONE)
+  {
+    DART_LOG_ERROR("dart_lock_acquire_shared: "
+                   "LOCK has already been acquired\n");
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
 
-    dart_segment_info_t *list_seginfo = dart_segment_get_info(
-                                      &(team_data->segdata), gptr_list.segid);
-    MPI_Win win = list_seginfo->win;
-    MPI_Aint disp_list = dart_segment_disp(list_seginfo, unitid);
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  if (team_data == NULL) {
+    DART_LOG_ERROR("dart_lock_acquire_shared ! failed: Unknown team %i!",
+                   lock->teamid);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
 
-    /* Wait for the update of our next pointer. */
-    do {
-      // trigger progress
-      int flag;
-      MPI_Iprobe(
-        MPI_ANY_SOURCE, MPI_ANY_TAG,
-        team_data->comm, &flag, MPI_STATUS_IGNORE);
-      DART_ASSERT_RETURNS(
-        MPI_Fetch_and_op(
-          NULL,
-          &next,
-          MPI_INT,
-          unitid.id,
-          disp_list,
-          MPI_NO_OP,
-          win),
-        MPI_SUCCESS);
-      DART_ASSERT_RETURNS(
-        MPI_Win_flush(unitid.id, win),
-        MPI_SUCCESS);
-    } while (next == -1);
+  if (!lock->shared_enabled) {
+    /* Wait for exclusive holders that skipped reader exclusion, without
+     * waiting for readers ourselves */
+    shared_enable(lock, team_data);
+    exclusive_acquire(lock, team_data, false);
+    lock->is_acquired = LOCK_HELD_EXCLUSIVE;
+    DART_ASSERT_RETURNS(dart__base__mutex_lock(&lock->mutex), DART_OK);
+    DART_ASSERT_RETURNS(dart_lock_release(lock), DART_OK);
+    lock->shared_enabled = true;
+  }
 
-    DART_LOG_DEBUG("dart_lock_release: notifying %d in team %d", next,
-                   (lock->teamid));
+  DART_LOG_DEBUG("dart_lock_acquire_shared: waiting for admission at "
+                 "unit %d in team %d", lock->leader_unit, lock->teamid);
+  while (!reader_try_enter(lock, team_data)) {
+    lock_progress(team_data);
+  }
 
-    /* Notifying the next unit waiting on the lock queue. */
-    MPI_Send(NULL, 0, MPI_INT, next, 0, team_data->comm);
-    *addr = -1;
-    MPI_Win_sync(win);
+  DART_LOG_DEBUG("dart_lock_acquire_shared: lock acquired in team %d",
+                 lock->teamid);
+  lock->is_acquired = LOCK_HELD_SHARED;
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_try_acquire_shared(dart_lock_t lock, int32_t *is_acquired)
+{
+  if (dart__base__mutex_trylock(&lock->mutex) != DART_OK) {
+    *is_acquired = 0;
+    DART_LOG_DEBUG("dart_lock_try_acquire_shared: "
+                   "LOCK held in another thread\n");
+    return DART_OK;
   }
-  lock->is_acquired = 0;
-  DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
-  DART_LOG_DEBUG("dart_lock_release: release lock in team %d",
-                 (lock -> teamid));
+
+  if (lock->is_acquired != LOCK_HELD_NONE)
+  {
+    DART_LOG_ERROR("dart_lock_try_acquire_shared: "
+                   "LOCK has already been acquired\n");
+    *is_acquired = 1;
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+    return DART_ERR_INVAL;
+  }
+
+  dart_team_data_t *team_data = dart_adapt_teamlist_get(lock->teamid);
+  DART_ASSERT(team_data != NULL);
+
+  if (!lock->shared_enabled) {
+    /* Exclusive holders may have skipped reader exclusion unless no node
+     * holds the global lock. Acquiring the lock exclusively instead would
+     * livelock with polling readers. */
+    shared_enable(lock, team_data);
+    lock->shared_enabled = (tail_cas(lock, -1, -1) == -1);
+  }
+
+  *is_acquired = lock->shared_enabled && reader_try_enter(lock, team_data);
+  if (*is_acquired) {
+    lock->is_acquired = LOCK_HELD_SHARED;
+  } else {
+    lock_progress(team_data);
+    DART_ASSERT_RETURNS(dart__base__mutex_unlock(&lock->mutex), DART_OK);
+  }
+
+  DART_LOG_DEBUG("dart_lock_try_acquire_shared: trylock %s in team %d",
+                 (*is_acquired) ? "succeeded" : "failed",
+                 lock->teamid);
   return DART_OK;
 }
 
+/**
+ * Repeat an attempt to acquire the lock until it succeeds or the timeout
+ * expires. Failed attempts trigger progress.
+ */
+static dart_ret_t try_acquire_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * is_acquired,
+  dart_ret_t (* try_acquire)(dart_lock_t, int32_t *))
+{
+  double deadline = MPI_Wtime() + (double)timeout_us * 1e-6;
+  do {
+    dart_ret_t ret = try_acquire(lock, is_acquired);
+    if (ret != DART_OK || *is_acquired) {
+      return ret;
+    }
+  } while (MPI_Wtime() < deadline);
+  DART_LOG_DEBUG("try_acquire_for: timeout of %llu us expired in team %d",
+                 (unsigned long long)timeout_us, lock->teamid);
+  return DART_OK;
+}
+
+dart_ret_t dart_lock_try_acquire_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * is_acquired)
+{
+  return try_acquire_for(lock, timeout_us, is_acquired,
+                         &dart_lock_try_acquire);
+}
+
+dart_ret_t dart_lock_try_acquire_shared_for(
+  dart_lock_t   lock,
+  uint64_t      timeout_us,
+  int32_t     * is_acquired)
+{
+  return try_acquire_for(lock, timeout_us, is_acquired,
+                         &dart_lock_try_acquire_shared);
+}
+
 dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
 {
   if (!lock || DART_LOCK_NULL == *lock) {
@@ -417,6 +987,7 @@ dart_ret_t dart_team_lock_destroy(dart_lock_t* lock)
   }
 
   (*lock)->teamid    = DART_TEAM_NULL;
+  free((*lock)->leaders);
   dart__base__mutex_destroy(&(*lock)->mutex);
   DART_LOG_DEBUG("dart_team_lock_free: done in team %d", teamid);
   free(*lock);
@@ -475,6 +1046,10 @@ dart_ret_t destroy_lock_segments(dart_lock_t lock)
     }
     lock->gptr_list = DART_GPTR_NULL;
   }
+  if (lock->local_win != MPI_WIN_NULL) {
+    MPI_Win_unlock_all(lock->local_win);
+    MPI_Win_free(&lock->local_win);
+  }
 
   return DART_OK;
 }
@@ -18,6 +18,7 @@
 
 #include <dash/dart/mpi/dart_team_private.h>
 #include <dash/dart/mpi/dart_group_priv.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
 #include <dash/dart/mpi/dart_synchronization_priv.h>
 
 #include <limits.h>
@@ -581,7 +582,6 @@ dart_ret_t dart_team_create(
 {
   MPI_Comm    comm;
   MPI_Comm    subcomm;
-  MPI_Win     win;
   dart_team_t max_teamid = -1;
 
   *newteam = DART_TEAM_NULL;
@@ -603,20 +603,38 @@ dart_ret_t dart_team_create(
   comm = parent_team_data->comm;
   subcomm = MPI_COMM_NULL;
 
-  MPI_Comm_create(comm, group->mpi_group, &subcomm);
+  int group_rank;
+  MPI_Group_rank(group->mpi_group, &group_rank);
+  int is_member = (group_rank != MPI_UNDEFINED);
 
   /* Get the maximum next_availteamid among all the units belonging to
-   * the parent team specified by 'teamid'. */
+   * the parent team specified by 'teamid' and whether any unit in the
+   * group has to create the team's communicator because it does not hold
+   * the communicator of a destroyed team with the same units. */
+  int reduce_buf[2] = {
+    dart_next_availteamid,
+    is_member && !dart_team_comm_cache_contains(group->mpi_group)
+  };
   MPI_Allreduce(
-    &dart_next_availteamid,
-    &max_teamid,
-    1,
-    MPI_INT16_T,
+    MPI_IN_PLACE,
+    reduce_buf,
+    2,
+    MPI_INT,
     MPI_MAX,
     comm);
+  if (reduce_buf[0] >= INT16_MAX) {
+    DART_LOG_ERROR("dart_team_create ! team IDs exhausted");
+    return DART_ERR_OTHER;
+  }
+  max_teamid            = (dart_team_t)reduce_buf[0];
   dart_next_availteamid = max_teamid + 1;
 
-  if (subcomm != MPI_COMM_NULL) {
+  bool cached = !reduce_buf[1];
+  if (!cached) {
+    MPI_Comm_create(comm, group->mpi_group, &subcomm);
+  }
+
+  if (is_member) {
     dart_ret_t result = dart_adapt_teamlist_alloc(max_teamid);
     if (result != DART_OK) {
       return DART_ERR_OTHER;
@@ -624,9 +642,11 @@ dart_ret_t dart_team_create(
     /* max_teamid is thought to be the new created team ID. */
     *newteam = max_teamid;
     dart_team_data_t *team_data = dart_adapt_teamlist_get(max_teamid);
-    team_data->comm = subcomm;
-    MPI_Win_create_dynamic(MPI_INFO_NULL, subcomm, &win);
-    team_data->window = win;
+    if (cached) {
+      dart_team_comm_cache_take(group->mpi_group, team_data);
+    } else {
+      team_data->comm = subcomm;
+    }
 
     int rank;
     MPI_Comm_rank(team_data->comm, &rank);
@@ -635,12 +655,10 @@ dart_ret_t dart_team_create(
 
     team_data->allocated_locks = NULL;
 
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-    dart_allocate_shared_comm(team_data);
-#endif
-    MPI_Win_lock_all(0, win);
-    DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d",
-                   *newteam, teamid);
+    /* The dynamic window and the shared memory communicator are created
+     * on the first collective allocation in the team */
+    DART_LOG_DEBUG("TEAMCREATE - create team %d from parent team %d%s",
+                   *newteam, teamid, cached ? " (cached communicator)" : "");
   }
 
   return DART_OK;
@@ -649,7 +667,6 @@ dart_ret_t dart_team_create(
 dart_ret_t dart_team_destroy(
   dart_team_t * teamid)
 {
-  MPI_Comm    comm;
   MPI_Win     win;
 
   DART_LOG_DEBUG("dart_team_destroy() teamid:%d", *teamid);
@@ -664,28 +681,25 @@ dart_ret_t dart_team_destroy(
     return DART_ERR_INVAL;
   }
 
-  comm = team_data->comm;
-
-  // free(dart_unit_mapping[index]);
+  /* Locks hold segments in the team's window */
+  dart__mpi__destroylocks(team_data->allocated_locks);
+  team_data->allocated_locks = NULL;
 
-  // MPI_Win_free (&(sharedmem_win_list[index]));
-#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
-  free(team_data->sharedmem_tab);
-#endif
   win = team_data->window;
-  MPI_Win_unlock_all(win);
-  MPI_Win_free(&win);
+  if (win != MPI_WIN_NULL) {
+    dart__mpi__wc_release(win);
+    MPI_Win_unlock_all(win);
+    MPI_Win_free(&win);
+    dart__mpi__flush_tracker_destroy(&team_data->tracker);
+  }
 
-  /* -- Release the communicator associated with teamid -- */
-  MPI_Comm_free(&comm);
+  /* -- Keep the communicator associated with teamid for reuse -- */
+  dart_team_comm_cache_put(team_data);
 
   dart_segment_fini(&team_data->segdata);
 
   dart_adapt_teamlist_dealloc(*teamid);
 
-  dart__mpi__destroylocks(team_data->allocated_locks);
-  team_data->allocated_locks = NULL;
-
   DART_LOG_DEBUG("dart_team_destroy > teamid:%d", *teamid);
 
   *teamid = DART_TEAM_NULL;
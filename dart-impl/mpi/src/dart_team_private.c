@@ -3,18 +3,44 @@
  *  @brief Implementations for the operations on teamlist.
  */
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <dash/dart/if/dart_types.h>
 #include <dash/dart/if/dart_team_group.h>
 #include <dash/dart/mpi/dart_team_private.h>
+#include <dash/dart/mpi/dart_communication_priv.h>
 
 #define DART_TEAM_HASH_SIZE (256)
 
+/**
+ * Maximum number of communicators of destroyed teams kept for reuse.
+ */
+#define DART_TEAM_COMM_CACHE_SIZE (16)
+
+typedef struct dart_team_comm_entry {
+  struct dart_team_comm_entry *next;
+  /** The ID of the destroyed team */
+  dart_team_t       teamid;
+  /** The units of the destroyed team */
+  MPI_Group         group;
+  MPI_Comm          comm;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  MPI_Comm          sharedmem_comm;
+  dart_team_unit_t *sharedmem_tab;
+  int               sharedmem_nodesize;
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+} dart_team_comm_entry_t;
+
 dart_team_t dart_next_availteamid = (DART_TEAM_ALL + 1);
 
 MPI_Comm dart_comm_world;
 
 static dart_team_data_t *dart_team_data[DART_TEAM_HASH_SIZE];
 
+/* Cached communicators, most recently destroyed team first */
+static dart_team_comm_entry_t *dart_team_comm_cache      = NULL;
+static int                     dart_team_comm_cache_size = 0;
+
 static int
 dart_adapt_teamlist_hash(dart_team_t teamid)
 {
@@ -202,25 +228,19 @@ dart_ret_t
 dart_adapt_teamlist_dealloc(dart_team_t teamid)
 {
   int slot = dart_adapt_teamlist_hash(teamid);
-  dart_team_data_t *res = dart_team_data[slot];
-  dart_team_data_t **prev = NULL;
+  dart_team_data_t **prev = &dart_team_data[slot];
 
-  while (res != NULL && res->teamid == teamid) {
-    prev = &res;
-    res = res->next;
+  while (*prev != NULL && (*prev)->teamid != teamid) {
+    prev = &(*prev)->next;
   }
 
   // not found!
-  if (res == NULL) {
+  if (*prev == NULL) {
     return DART_ERR_INVAL;
   }
 
-  if (prev == NULL) {
-    dart_team_data[slot] = res->next;
-  } else {
-    (*prev)->next = res->next;
-  }
-
+  dart_team_data_t *res = *prev;
+  *prev     = res->next;
   res->next = NULL;
   free(res);
   return DART_OK;
@@ -233,6 +253,11 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
   dart_team_data_t *res = calloc(1, sizeof(dart_team_data_t));
   res->teamid = teamid;
   res->unitid = DART_UNDEFINED_UNIT_ID;
+  res->comm   = MPI_COMM_NULL;
+  res->window = MPI_WIN_NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  res->sharedmem_comm = MPI_COMM_NULL;
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
   res->next = dart_team_data[slot];
   dart_team_data[slot] = res;
   dart_segment_init(&(res->segdata), teamid);
@@ -240,6 +265,19 @@ dart_adapt_teamlist_alloc(dart_team_t teamid)
 }
 
 
+static void free_comm_entry(dart_team_comm_entry_t *entry)
+{
+  MPI_Group_free(&entry->group);
+  MPI_Comm_free(&entry->comm);
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (entry->sharedmem_comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&entry->sharedmem_comm);
+  }
+  free(entry->sharedmem_tab);
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  free(entry);
+}
+
 dart_ret_t dart_adapt_teamlist_destroy()
 {
   for (int i = 0; i < DART_TEAM_HASH_SIZE; i++) {
@@ -252,14 +290,131 @@ dart_ret_t dart_adapt_teamlist_destroy()
     }
     dart_team_data[i] = NULL;
   }
+
+  /* Units sharing a cached communicator cached it in the same team
+   * destruction, free the communicators in the order of team IDs so their
+   * collective release matches across units */
+  while (dart_team_comm_cache != NULL) {
+    dart_team_comm_entry_t **first = &dart_team_comm_cache;
+    for (dart_team_comm_entry_t **prev = &dart_team_comm_cache;
+         *prev != NULL; prev = &(*prev)->next) {
+      if ((*prev)->teamid < (*first)->teamid) {
+        first = prev;
+      }
+    }
+    dart_team_comm_entry_t *entry = *first;
+    *first = entry->next;
+    free_comm_entry(entry);
+  }
+  dart_team_comm_cache_size = 0;
+  return DART_OK;
+}
+
+dart_ret_t dart_allocate_team_window(dart_team_data_t *team_data)
+{
+  if (team_data->window != MPI_WIN_NULL) {
+    return DART_OK;
+  }
+
+  DART_LOG_DEBUG("dart_allocate_team_window: creating window of team %d",
+                 team_data->teamid);
+  MPI_Win win;
+  if (MPI_Win_create_dynamic(
+        MPI_INFO_NULL, team_data->comm, &win) != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart_allocate_team_window: "
+                   "MPI_Win_create_dynamic failed in team %d",
+                   team_data->teamid);
+    return DART_ERR_OTHER;
+  }
+  /* Start an access epoch on win, and later on all the units
+   * can access the attached memory region allocated by the
+   * collective allocation function through win.
+   *
+   * NOTE: We use MPI_MODE_NOCHECK since there will be no
+   * conflicting locks at all
+   */
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+  team_data->window  = win;
+  team_data->tracker = dart__mpi__flush_tracker_create(team_data->size);
   return DART_OK;
 }
 
+bool dart_team_comm_cache_contains(MPI_Group group)
+{
+  for (dart_team_comm_entry_t *entry = dart_team_comm_cache;
+       entry != NULL; entry = entry->next) {
+    int result;
+    MPI_Group_compare(group, entry->group, &result);
+    if (result == MPI_IDENT) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool dart_team_comm_cache_take(MPI_Group group, dart_team_data_t *team_data)
+{
+  dart_team_comm_entry_t **prev = &dart_team_comm_cache;
+  while (*prev != NULL) {
+    dart_team_comm_entry_t *entry = *prev;
+    int result;
+    MPI_Group_compare(group, entry->group, &result);
+    if (result == MPI_IDENT) {
+      *prev = entry->next;
+      dart_team_comm_cache_size--;
+      team_data->comm = entry->comm;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+      team_data->sharedmem_comm     = entry->sharedmem_comm;
+      team_data->sharedmem_tab      = entry->sharedmem_tab;
+      team_data->sharedmem_nodesize = entry->sharedmem_nodesize;
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+      MPI_Group_free(&entry->group);
+      free(entry);
+      return true;
+    }
+    prev = &entry->next;
+  }
+  return false;
+}
+
+void dart_team_comm_cache_put(dart_team_data_t *team_data)
+{
+  /* Communicators are only released collectively, so either all units of
+   * the team keep the communicator or none does */
+  int cache_full = (dart_team_comm_cache_size >= DART_TEAM_COMM_CACHE_SIZE);
+  MPI_Allreduce(
+    MPI_IN_PLACE, &cache_full, 1, MPI_INT, MPI_MAX, team_data->comm);
+
+  dart_team_comm_entry_t *entry = malloc(sizeof(dart_team_comm_entry_t));
+  entry->teamid = team_data->teamid;
+  MPI_Comm_group(team_data->comm, &entry->group);
+  entry->comm = team_data->comm;
+  team_data->comm = MPI_COMM_NULL;
+#if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  entry->sharedmem_comm     = team_data->sharedmem_comm;
+  entry->sharedmem_tab      = team_data->sharedmem_tab;
+  entry->sharedmem_nodesize = team_data->sharedmem_nodesize;
+  team_data->sharedmem_comm = MPI_COMM_NULL;
+  team_data->sharedmem_tab  = NULL;
+#endif // !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
+  if (cache_full) {
+    free_comm_entry(entry);
+    return;
+  }
+  entry->next = dart_team_comm_cache;
+  dart_team_comm_cache = entry;
+  dart_team_comm_cache_size++;
+}
+
 #if !defined(DART_MPI_DISABLE_SHARED_WINDOWS)
 dart_ret_t dart_allocate_shared_comm(dart_team_data_t *team_data)
 {
   int size;
 
+  if (team_data->sharedmem_tab != NULL) {
+    return DART_OK;
+  }
+
   MPI_Comm_size(team_data->comm, &size);
 
   MPI_Comm sharedmem_comm;
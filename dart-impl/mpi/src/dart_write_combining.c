@@ -0,0 +1,347 @@
+/**
+ * \file dart_write_combining.c
+ *
+ * Write-combining of small non-blocking puts and accumulates.
+ *
+ * Small transfers issued through \c dart_put and \c dart_accumulate to
+ * units that are not reachable through shared memory are staged in a
+ * buffer per window and target unit, coalescing adjacent target ranges.
+ * A buffer is shipped as a single MPI_Rput / MPI_Raccumulate with an
+ * hindexed target type once it is full and before any operation that
+ * completes or orders communication to its target.
+ */
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <dash/dart/mpi/dart_communication_priv.h>
+
+#include <dash/dart/base/env.h>
+#include <dash/dart/base/logging.h>
+#include <dash/dart/base/mutex.h>
+
+#include <mpi.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DART_WC_NUM_BUCKETS     64
+/// the maximum number of disjoint target ranges in a buffer
+#define DART_WC_MAX_ENTRIES     256
+/// transfers larger than the buffer capacity divided by this are not staged
+#define DART_WC_MAX_OP_FRACTION 8
+
+typedef struct dart_wc_buffer {
+  struct dart_wc_buffer * next;
+  MPI_Win                 win;
+  int                     target;
+  /// whether the buffer stages accumulates or puts
+  bool                    is_acc;
+  /// the reduction operation of staged accumulates
+  MPI_Op                  op;
+  /// the element type of staged accumulates, MPI_BYTE for puts
+  MPI_Datatype            mpi_type;
+  int                     elem_size;
+  /// the last shipped transfer, staged data must not be modified before
+  /// its local completion
+  MPI_Request             req;
+  int                     num_entries;
+  size_t                  nbytes;
+  /// the range of target displacements covered by the staged entries
+  MPI_Aint                disp_lo;
+  MPI_Aint                disp_hi;
+  /// target displacements in bytes
+  MPI_Aint                disps[DART_WC_MAX_ENTRIES];
+  /// target range lengths in elements
+  int                     lens[DART_WC_MAX_ENTRIES];
+  char                    data[];
+} dart_wc_buffer_t;
+
+size_t dart__mpi__wc_capacity = 0;
+
+static dart_wc_buffer_t * wc_buckets[DART_WC_NUM_BUCKETS];
+static dart_mutex_t       wc_mutex = DART_MUTEX_INITIALIZER;
+
+static inline int
+wc_bucket(MPI_Win win, int target)
+{
+  return (int)(((uintptr_t)win * 31 + (uintptr_t)target)
+               % DART_WC_NUM_BUCKETS);
+}
+
+static void
+wc_ship_buffer(dart_wc_buffer_t * buf)
+{
+  if (buf->num_entries == 0) {
+    return;
+  }
+  int count = (int)(buf->nbytes / buf->elem_size);
+
+  DART_LOG_TRACE("dart__mpi__wc: shipping %d ranges (%zu bytes) to unit %d",
+                 buf->num_entries, buf->nbytes, buf->target);
+
+  MPI_Aint     target_disp = buf->disps[0];
+  MPI_Datatype target_type = buf->mpi_type;
+  int          target_count = count;
+  if (buf->num_entries > 1) {
+    MPI_Type_create_hindexed(buf->num_entries, buf->lens, buf->disps,
+                             buf->mpi_type, &target_type);
+    MPI_Type_commit(&target_type);
+    target_disp  = 0;
+    target_count = 1;
+  }
+
+  int ret;
+  if (buf->is_acc) {
+    ret = MPI_Raccumulate(buf->data, count, buf->mpi_type, buf->target,
+                          target_disp, target_count, target_type, buf->op,
+                          buf->win, &buf->req);
+  } else {
+    ret = MPI_Rput(buf->data, count, buf->mpi_type, buf->target,
+                   target_disp, target_count, target_type,
+                   buf->win, &buf->req);
+  }
+  if (ret != MPI_SUCCESS) {
+    DART_LOG_ERROR("dart__mpi__wc: shipping staged transfers failed");
+    dart_abort(DART_EXIT_ABORT);
+  }
+
+  if (buf->num_entries > 1) {
+    MPI_Type_free(&target_type);
+  }
+  buf->num_entries = 0;
+  buf->nbytes      = 0;
+}
+
+static inline void
+wc_wait_buffer(dart_wc_buffer_t * buf)
+{
+  if (buf->req != MPI_REQUEST_NULL) {
+    MPI_Wait(&buf->req, MPI_STATUS_IGNORE);
+  }
+}
+
+static dart_wc_buffer_t *
+wc_get_buffer(MPI_Win win, int target, bool is_acc)
+{
+  int bucket = wc_bucket(win, target);
+  for (dart_wc_buffer_t * buf = wc_buckets[bucket];
+       buf != NULL; buf = buf->next) {
+    if (buf->win == win && buf->target == target && buf->is_acc == is_acc) {
+      return buf;
+    }
+  }
+  dart_wc_buffer_t * buf = malloc(sizeof(dart_wc_buffer_t)
+                                  + dart__mpi__wc_capacity);
+  buf->win         = win;
+  buf->target      = target;
+  buf->is_acc      = is_acc;
+  buf->op          = MPI_OP_NULL;
+  buf->mpi_type    = MPI_BYTE;
+  buf->elem_size   = 1;
+  buf->req         = MPI_REQUEST_NULL;
+  buf->num_entries = 0;
+  buf->nbytes      = 0;
+  buf->next        = wc_buckets[bucket];
+  wc_buckets[bucket] = buf;
+  return buf;
+}
+
+/*
+ * Ships and releases all buffers matching the given window and target.
+ * MPI_WIN_NULL and negative targets match any window and target.
+ */
+static void
+wc_release(MPI_Win win, int target)
+{
+  for (int bucket = 0; bucket < DART_WC_NUM_BUCKETS; ++bucket) {
+    dart_wc_buffer_t ** prev = &wc_buckets[bucket];
+    while (*prev != NULL) {
+      dart_wc_buffer_t * buf = *prev;
+      if ((win == MPI_WIN_NULL || buf->win == win) &&
+          (target < 0 || buf->target == target)) {
+        wc_ship_buffer(buf);
+        wc_wait_buffer(buf);
+        *prev = buf->next;
+        free(buf);
+      } else {
+        prev = &buf->next;
+      }
+    }
+  }
+}
+
+static bool
+wc_stage(
+  MPI_Win        win,
+  int            target,
+  MPI_Aint       disp,
+  const void   * src,
+  size_t         nelem,
+  MPI_Datatype   mpi_type,
+  int            elem_size,
+  bool           is_acc,
+  MPI_Op         op)
+{
+  size_t nbytes = nelem * elem_size;
+  if (nbytes == 0) {
+    return false;
+  }
+
+  dart__base__mutex_lock(&wc_mutex);
+
+  // the capacity may be changed concurrently by dart_write_combining
+  size_t capacity = dart__mpi__wc_capacity;
+  if (nbytes > capacity / DART_WC_MAX_OP_FRACTION) {
+    dart__base__mutex_unlock(&wc_mutex);
+    return false;
+  }
+
+  dart_wc_buffer_t * buf = wc_get_buffer(win, target, is_acc);
+
+  if (buf->num_entries > 0) {
+    bool ship = (buf->nbytes + nbytes > capacity ||
+                 buf->num_entries == DART_WC_MAX_ENTRIES ||
+                 buf->mpi_type != mpi_type || buf->op != op);
+    // target ranges of a single transfer must not overlap
+    if (!ship &&
+        disp < buf->disp_hi && disp + (MPI_Aint)nbytes > buf->disp_lo) {
+      for (int e = 0; e < buf->num_entries; ++e) {
+        if (disp < buf->disps[e] + (MPI_Aint)buf->lens[e] * elem_size &&
+            disp + (MPI_Aint)nbytes > buf->disps[e]) {
+          ship = true;
+          break;
+        }
+      }
+    }
+    if (ship) {
+      wc_ship_buffer(buf);
+    }
+  }
+
+  if (buf->num_entries == 0) {
+    wc_wait_buffer(buf);
+    buf->mpi_type  = mpi_type;
+    buf->elem_size = elem_size;
+    buf->op        = op;
+    buf->disp_lo   = disp;
+    buf->disp_hi   = disp;
+  }
+
+  memcpy(buf->data + buf->nbytes, src, nbytes);
+  buf->nbytes += nbytes;
+
+  int last = buf->num_entries - 1;
+  if (last >= 0 &&
+      buf->disps[last] + (MPI_Aint)buf->lens[last] * elem_size == disp) {
+    // coalesce with the preceding range
+    buf->lens[last] += (int)nelem;
+  } else {
+    buf->disps[buf->num_entries] = disp;
+    buf->lens[buf->num_entries]  = (int)nelem;
+    buf->num_entries++;
+  }
+  if (disp < buf->disp_lo) buf->disp_lo = disp;
+  if (disp + (MPI_Aint)nbytes > buf->disp_hi) {
+    buf->disp_hi = disp + (MPI_Aint)nbytes;
+  }
+
+  dart__base__mutex_unlock(&wc_mutex);
+  return true;
+}
+
+dart_ret_t
+dart__mpi__wc_init()
+{
+  dart__base__mutex_init(&wc_mutex);
+  dart__mpi__wc_capacity = dart__base__env__size(
+                             DART_WRITE_COMBINING_ENVSTR, 0);
+  DART_LOG_DEBUG("dart__mpi__wc_init: buffer capacity %zu bytes",
+                 dart__mpi__wc_capacity);
+  return DART_OK;
+}
+
+dart_ret_t
+dart__mpi__wc_fini()
+{
+  dart__base__mutex_lock(&wc_mutex);
+  wc_release(MPI_WIN_NULL, -1);
+  dart__mpi__wc_capacity = 0;
+  dart__base__mutex_unlock(&wc_mutex);
+  dart__base__mutex_destroy(&wc_mutex);
+  return DART_OK;
+}
+
+bool
+dart__mpi__wc_put(
+  MPI_Win      win,
+  int          target,
+  MPI_Aint     disp,
+  const void * src,
+  size_t       nbytes)
+{
+  return wc_stage(win, target, disp, src, nbytes, MPI_BYTE, 1,
+                  false, MPI_OP_NULL);
+}
+
+bool
+dart__mpi__wc_accumulate(
+  MPI_Win         win,
+  int             target,
+  MPI_Aint        disp,
+  const void    * values,
+  size_t          nelem,
+  dart_datatype_t dtype,
+  MPI_Op          op)
+{
+  dart_datatype_struct_t * dts = dart__mpi__datatype_struct(dtype);
+  return wc_stage(win, target, disp, values, nelem,
+                  dts->contiguous.mpi_type, (int)dts->contiguous.size,
+                  true, op);
+}
+
+void
+dart__mpi__wc_ship(
+  MPI_Win win,
+  int     target)
+{
+  dart__base__mutex_lock(&wc_mutex);
+  // buffers of a single target are all found in the same bucket
+  int first = 0;
+  int last  = DART_WC_NUM_BUCKETS - 1;
+  if (win != MPI_WIN_NULL && target >= 0) {
+    first = last = wc_bucket(win, target);
+  }
+  for (int bucket = first; bucket <= last; ++bucket) {
+    for (dart_wc_buffer_t * buf = wc_buckets[bucket];
+         buf != NULL; buf = buf->next) {
+      if ((win == MPI_WIN_NULL || buf->win == win) &&
+          (target < 0 || buf->target == target)) {
+        wc_ship_buffer(buf);
+      }
+    }
+  }
+  dart__base__mutex_unlock(&wc_mutex);
+}
+
+void
+dart__mpi__wc_release(
+  MPI_Win win)
+{
+  dart__base__mutex_lock(&wc_mutex);
+  wc_release(win, -1);
+  dart__base__mutex_unlock(&wc_mutex);
+}
+
+dart_ret_t
+dart_write_combining(
+  size_t nbytes)
+{
+  dart__base__mutex_lock(&wc_mutex);
+  // buffers are re-allocated with the new capacity on demand
+  wc_release(MPI_WIN_NULL, -1);
+  dart__mpi__wc_capacity = nbytes;
+  dart__base__mutex_unlock(&wc_mutex);
+  DART_LOG_DEBUG("dart_write_combining: buffer capacity %zu bytes", nbytes);
+  return DART_OK;
+}
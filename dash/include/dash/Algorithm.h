@@ -16,6 +16,7 @@
 #include <dash/algorithm/ForEach.h>
 #include <dash/algorithm/MinMax.h>
 #include <dash/algorithm/Transform.h>
+#include <dash/algorithm/Eval.h>
 #include <dash/algorithm/Bcast.h>
 #include <dash/algorithm/Reduce.h>
 #include <dash/algorithm/Copy.h>
@@ -4,6 +4,7 @@
 #include <dash/Cartesian.h>
 #include <dash/Dimensional.h>
 #include <dash/Exception.h>
+#include <dash/Expression.h>
 #include <dash/GlobRef.h>
 #include <dash/GlobAsyncRef.h>
 #include <dash/HView.h>
@@ -999,6 +1000,25 @@ public:
     return *this;
   }
 
+  /**
+   * Assigns the elements of an element-wise expression to the local
+   * elements of the array, evaluated at the end of the statement or by
+   * \c dash::eval.
+   *
+   * \code
+   *   y = a * x + y;
+   * \endcode
+   *
+   * \see  DashExpressions
+   */
+  template <
+    class ExprT,
+    typename = typename std::enable_if<
+                 dash::expr::is_expression<ExprT>::value>::type>
+  dash::expr::assignment<self_t, ExprT> operator=(const ExprT & expr) {
+    return { *this, expr };
+  }
+
   /**
    * Destructor, deallocates array elements.
    */
@@ -1553,6 +1573,19 @@ public:
   }
 };
 
+namespace expr {
+
+template <
+  typename ElementType,
+  typename IndexType,
+  class    PatternType,
+  typename LocalMemSpaceT>
+struct is_expression_container<
+         dash::Array<ElementType, IndexType, PatternType, LocalMemSpaceT>>
+  : std::true_type { };
+
+} // namespace expr
+
 } // namespace dash
 
 #endif /* ARRAY_H_INCLUDED */
@@ -0,0 +1,554 @@
+#ifndef DASH__EXPRESSION_H__INCLUDED
+#define DASH__EXPRESSION_H__INCLUDED
+
+#include <dash/Exception.h>
+#include <dash/Team.h>
+#include <dash/Types.h>
+
+#include <dash/internal/Logging.h>
+#include <dash/internal/Macro.h>
+#include <dash/pattern/internal/PatternCompare.h>
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
+
+/**
+ * \defgroup DashExpressions DASH Expressions
+ *
+ * Lazy element-wise expressions on DASH containers.
+ *
+ * Arithmetic operators applied to \c dash::Array and \c dash::Matrix
+ * instances do not compute anything but return expression objects that
+ * are evaluated element by element on the local elements of the operands.
+ * All container operands of an expression must have identical patterns.
+ *
+ * Assigning an expression to a container evaluates it in a single pass
+ * over local memory. Combined with \c dash::eval, several assignments and
+ * reductions are fused into one pass:
+ *
+ * \code
+ *   dash::Array<double> x(size), y(size);
+ *   double a = 2.0, norm;
+ *   // y[i] = a * x[i] + y[i], norm = sum(y[i] * y[i]):
+ *   dash::eval(y = a * x + y, dash::reduce_into(norm, y * y));
+ * \endcode
+ *
+ * As for \c dash::fill or \c dash::transform on identical distributions,
+ * assignments do not synchronize units.
+ */
+
+namespace dash {
+namespace expr {
+
+/**
+ * Type trait indicating whether a type is a node of an element-wise
+ * expression.
+ *
+ * \ingroup DashExpressions
+ */
+template <class T>
+struct is_expression : std::false_type { };
+
+/**
+ * Type trait indicating whether a container type can be used as operand
+ * in an element-wise expression, specialized for \c dash::Array and
+ * \c dash::Matrix.
+ *
+ * \ingroup DashExpressions
+ */
+template <class T>
+struct is_expression_container : std::false_type { };
+
+namespace detail {
+
+template <class T>
+struct is_node_or_container
+  : std::integral_constant<bool,
+      is_expression<typename std::decay<T>::type>::value ||
+      is_expression_container<typename std::decay<T>::type>::value>
+{ };
+
+template <class T>
+struct is_operand
+  : std::integral_constant<bool,
+      is_node_or_container<T>::value ||
+      std::is_arithmetic<typename std::decay<T>::type>::value>
+{ };
+
+template <class L, class R>
+struct is_binary_operands
+  : std::integral_constant<bool,
+      is_operand<L>::value && is_operand<R>::value &&
+      (is_node_or_container<L>::value || is_node_or_container<R>::value)>
+{ };
+
+} // namespace detail
+
+/**
+ * Expression node referencing the local elements of a container.
+ *
+ * \ingroup DashExpressions
+ */
+template <class ContainerT>
+class terminal {
+  using pointer_t = decltype(std::declval<ContainerT &>().lbegin());
+
+public:
+  using container_type = ContainerT;
+  using value_type     = typename std::decay<ContainerT>::type::value_type;
+
+public:
+  explicit terminal(ContainerT & container)
+    : _container(&container)
+    , _lbegin(container.lbegin())
+  { }
+
+  inline auto operator()(dash::default_index_t l_idx) const
+    -> decltype(std::declval<pointer_t>()[0]) {
+    return _lbegin[l_idx];
+  }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction && f) const {
+    f(*_container);
+  }
+
+private:
+  ContainerT * _container;
+  pointer_t    _lbegin;
+};
+
+/**
+ * Expression node of a scalar value that is identical for every element.
+ *
+ * \ingroup DashExpressions
+ */
+template <class ValueT>
+class scalar {
+public:
+  using value_type = ValueT;
+
+public:
+  constexpr explicit scalar(const ValueT & value)
+    : _value(value)
+  { }
+
+  constexpr const ValueT & operator()(dash::default_index_t) const {
+    return _value;
+  }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction &&) const { }
+
+private:
+  ValueT _value;
+};
+
+/**
+ * Expression node applying a unary operation to the elements of an
+ * expression.
+ *
+ * \ingroup DashExpressions
+ */
+template <class UnaryOperation, class ExprT>
+class unary {
+public:
+  using value_type = typename std::decay<
+                       decltype(std::declval<UnaryOperation>()(
+                         std::declval<ExprT>()(0)))>::type;
+
+public:
+  unary(UnaryOperation op, const ExprT & expr)
+    : _op(op)
+    , _expr(expr)
+  { }
+
+  inline value_type operator()(dash::default_index_t l_idx) const {
+    return _op(_expr(l_idx));
+  }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction && f) const {
+    _expr.for_each_terminal(f);
+  }
+
+private:
+  UnaryOperation _op;
+  ExprT          _expr;
+};
+
+/**
+ * Expression node combining the elements of two expressions.
+ *
+ * \ingroup DashExpressions
+ */
+template <class BinaryOperation, class LeftT, class RightT>
+class binary {
+public:
+  using value_type = typename std::decay<
+                       decltype(std::declval<BinaryOperation>()(
+                         std::declval<LeftT>()(0),
+                         std::declval<RightT>()(0)))>::type;
+
+public:
+  binary(BinaryOperation op, const LeftT & left, const RightT & right)
+    : _op(op)
+    , _left(left)
+    , _right(right)
+  { }
+
+  inline value_type operator()(dash::default_index_t l_idx) const {
+    return _op(_left(l_idx), _right(l_idx));
+  }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction && f) const {
+    _left.for_each_terminal(f);
+    _right.for_each_terminal(f);
+  }
+
+private:
+  BinaryOperation _op;
+  LeftT           _left;
+  RightT          _right;
+};
+
+template <class ContainerT>
+struct is_expression<terminal<ContainerT>> : std::true_type { };
+
+template <class ValueT>
+struct is_expression<scalar<ValueT>> : std::true_type { };
+
+template <class UnaryOperation, class ExprT>
+struct is_expression<unary<UnaryOperation, ExprT>> : std::true_type { };
+
+template <class BinaryOperation, class LeftT, class RightT>
+struct is_expression<binary<BinaryOperation, LeftT, RightT>>
+  : std::true_type { };
+
+namespace detail {
+
+template <class T, class Enable = void>
+struct operand;
+
+template <class T>
+struct operand<T, typename std::enable_if<
+                    is_expression<typename std::decay<T>::type>::value
+                  >::type> {
+  using type = typename std::decay<T>::type;
+  static const type & make(const type & expr) { return expr; }
+};
+
+template <class T>
+struct operand<T, typename std::enable_if<
+                    is_expression_container<
+                      typename std::decay<T>::type>::value
+                  >::type> {
+  static_assert(std::is_lvalue_reference<T>::value,
+                "Containers in expressions must be lvalues");
+  using type = terminal<typename std::remove_reference<T>::type>;
+  static type make(typename std::remove_reference<T>::type & container) {
+    return type(container);
+  }
+};
+
+template <class T>
+struct operand<T, typename std::enable_if<
+                    std::is_arithmetic<typename std::decay<T>::type>::value
+                  >::type> {
+  using type = scalar<typename std::decay<T>::type>;
+  static type make(const typename std::decay<T>::type & value) {
+    return type(value);
+  }
+};
+
+template <class T>
+using operand_t = typename operand<T>::type;
+
+template <class BinaryOperation, class L, class R>
+binary<BinaryOperation, operand_t<L>, operand_t<R>>
+make_binary(BinaryOperation op, L && l, R && r) {
+  return binary<BinaryOperation, operand_t<L>, operand_t<R>>(
+           op, operand<L>::make(l), operand<R>::make(r));
+}
+
+/**
+ * State of an action that does not accumulate values.
+ */
+struct no_state { };
+
+template <std::size_t... Is, class UnaryFunction>
+inline void for_each_index(std::index_sequence<Is...>, UnaryFunction && f) {
+  using expand = int[];
+  (void) expand { 0, (f(std::integral_constant<std::size_t, Is>()), 0)... };
+}
+
+template <class... Actions, class UnaryFunction>
+void for_each_terminal(
+  const std::tuple<Actions &...> & actions,
+  UnaryFunction               && f) {
+  for_each_index(std::index_sequence_for<Actions...>(), [&](auto k) {
+    std::get<decltype(k)::value>(actions).for_each_terminal(f);
+  });
+}
+
+/**
+ * Applies all actions to the local elements in index range
+ * \c [l_begin, l_end) in a single loop.
+ */
+template <class... Actions>
+void evaluate_range(
+  const std::tuple<Actions &...>                     & actions,
+  std::tuple<typename Actions::state_type...>        & states,
+  dash::default_index_t                                l_begin,
+  dash::default_index_t                                l_end) {
+  if (l_begin >= l_end) {
+    return;
+  }
+  // accumulate in a private copy so reduction values can stay in
+  // registers:
+  auto l_states = states;
+  auto indices  = std::index_sequence_for<Actions...>();
+  for_each_index(indices, [&](auto k) {
+    std::get<decltype(k)::value>(actions).first(
+      l_begin, std::get<decltype(k)::value>(l_states));
+  });
+  for (auto l_idx = l_begin + 1; l_idx < l_end; ++l_idx) {
+    for_each_index(indices, [&](auto k) {
+      std::get<decltype(k)::value>(actions).apply(
+        l_idx, std::get<decltype(k)::value>(l_states));
+    });
+  }
+  states = l_states;
+}
+
+template <class... Actions>
+void combine_states(
+  const std::tuple<Actions &...>                     & actions,
+  const std::tuple<typename Actions::state_type...>  & in,
+  std::tuple<typename Actions::state_type...>        & inout) {
+  for_each_index(std::index_sequence_for<Actions...>(), [&](auto k) {
+    std::get<decltype(k)::value>(actions).combine(
+      std::get<decltype(k)::value>(in),
+      std::get<decltype(k)::value>(inout));
+  });
+}
+
+/**
+ * Evaluates the given actions on all local elements of their operands
+ * and accumulates the unit's partial results of reductions in \c states.
+ *
+ * \returns  The team of the operands, or \c nullptr if the actions do not
+ *           reference any container.
+ */
+template <class... Actions>
+dash::Team * evaluate_local(
+  const std::tuple<Actions &...>                     & actions,
+  std::tuple<typename Actions::state_type...>        & states) {
+  dash::default_index_t nlocal = 0;
+  dash::Team          * team   = nullptr;
+  for_each_terminal(actions, [&](auto & ref) {
+    if (team != nullptr) {
+      return;
+    }
+    nlocal = ref.lend() - ref.lbegin();
+    team   = &ref.team();
+    for_each_terminal(actions, [&](auto & other) {
+      bool same = dash::internal::same_distribution(
+                    ref.pattern(), other.pattern());
+      DASH_ASSERT_MSG(same, "Operands of expression have different patterns");
+      dash__unused(same);
+    });
+  });
+  DASH_LOG_TRACE("dash::expr::evaluate_local", "local elements:", nlocal);
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc;
+  auto n_threads = uloc.num_domain_threads();
+  DASH_LOG_TRACE("dash::expr::evaluate_local", "thread capacity:", n_threads);
+  if (n_threads > 1 && nlocal >= n_threads) {
+    using states_t = std::tuple<typename Actions::state_type...>;
+    std::vector<states_t> t_states(n_threads, states);
+    #pragma omp parallel num_threads(n_threads)
+    {
+      dash::default_index_t t_id = omp_get_thread_num();
+      dash::default_index_t nt   = omp_get_num_threads();
+      evaluate_range(actions, t_states[t_id],
+                     (nlocal * t_id) / nt, (nlocal * (t_id + 1)) / nt);
+    }
+    for (const auto & t_state : t_states) {
+      combine_states(actions, t_state, states);
+    }
+    return team;
+  }
+#endif
+  evaluate_range(actions, states, 0, nlocal);
+  return team;
+}
+
+} // namespace detail
+
+/**
+ * Action assigning the elements of an expression to the local elements of
+ * a container. Created by assigning an expression to a container.
+ *
+ * The assignment is evaluated when it is passed to \c dash::eval or, if it
+ * has not been passed to \c dash::eval, when it is destroyed, which is at
+ * the end of a statement like \c "y = a * x + y;".
+ *
+ * \ingroup DashExpressions
+ */
+template <class ContainerT, class ExprT>
+class assignment {
+  using self_t    = assignment<ContainerT, ExprT>;
+  using pointer_t = decltype(std::declval<ContainerT &>().lbegin());
+
+public:
+  using state_type = detail::no_state;
+
+public:
+  assignment(ContainerT & lhs, const ExprT & rhs)
+    : _lhs(&lhs)
+    , _lbegin(lhs.lbegin())
+    , _rhs(rhs)
+  { }
+
+  assignment(self_t && other)
+    : _lhs(other._lhs)
+    , _lbegin(other._lbegin)
+    , _rhs(other._rhs)
+    , _pending(other._pending)
+  {
+    other._pending = false;
+  }
+
+  assignment(const self_t & other)          = delete;
+  self_t & operator=(const self_t & other)  = delete;
+  self_t & operator=(self_t && other)       = delete;
+
+  ~assignment() {
+    if (_pending) {
+      _pending = false;
+      std::tuple<state_type> states;
+      detail::evaluate_local(std::forward_as_tuple(*this), states);
+    }
+  }
+
+  ContainerT & lhs() const {
+    return *_lhs;
+  }
+
+  /**
+   * Prevents evaluation of the assignment on destruction, called when
+   * the assignment is evaluated by \c dash::eval.
+   */
+  void release() {
+    _pending = false;
+  }
+
+  inline void first(dash::default_index_t l_idx, state_type & s) const {
+    apply(l_idx, s);
+  }
+
+  inline void apply(dash::default_index_t l_idx, state_type &) const {
+    _lbegin[l_idx] = _rhs(l_idx);
+  }
+
+  void combine(const state_type &, state_type &) const { }
+
+  void assign(const state_type &) const { }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction && f) const {
+    f(*_lhs);
+    _rhs.for_each_terminal(f);
+  }
+
+private:
+  ContainerT * _lhs;
+  pointer_t    _lbegin;
+  ExprT        _rhs;
+  bool         _pending = true;
+};
+
+} // namespace expr
+
+/**
+ * Element-wise sum of expression operands.
+ *
+ * \ingroup DashExpressions
+ */
+template <class L, class R,
+          typename = typename std::enable_if<
+                       expr::detail::is_binary_operands<L, R>::value>::type>
+auto operator+(L && l, R && r) {
+  return expr::detail::make_binary(
+           std::plus<>(), std::forward<L>(l), std::forward<R>(r));
+}
+
+/**
+ * Element-wise difference of expression operands.
+ *
+ * \ingroup DashExpressions
+ */
+template <class L, class R,
+          typename = typename std::enable_if<
+                       expr::detail::is_binary_operands<L, R>::value>::type>
+auto operator-(L && l, R && r) {
+  return expr::detail::make_binary(
+           std::minus<>(), std::forward<L>(l), std::forward<R>(r));
+}
+
+/**
+ * Element-wise product of expression operands.
+ *
+ * \ingroup DashExpressions
+ */
+template <class L, class R,
+          typename = typename std::enable_if<
+                       expr::detail::is_binary_operands<L, R>::value>::type>
+auto operator*(L && l, R && r) {
+  return expr::detail::make_binary(
+           std::multiplies<>(), std::forward<L>(l), std::forward<R>(r));
+}
+
+/**
+ * Element-wise quotient of expression operands.
+ *
+ * \ingroup DashExpressions
+ */
+template <class L, class R,
+          typename = typename std::enable_if<
+                       expr::detail::is_binary_operands<L, R>::value>::type>
+auto operator/(L && l, R && r) {
+  return expr::detail::make_binary(
+           std::divides<>(), std::forward<L>(l), std::forward<R>(r));
+}
+
+/**
+ * Element-wise negation of an expression operand.
+ *
+ * \ingroup DashExpressions
+ */
+template <class E,
+          typename = typename std::enable_if<
+                       expr::detail::is_node_or_container<E>::value>::type>
+auto operator-(E && e) {
+  using operand_t = expr::detail::operand_t<E>;
+  return expr::unary<std::negate<>, operand_t>(
+           std::negate<>(), expr::detail::operand<E>::make(e));
+}
+
+} // namespace dash
+
+#endif // DASH__EXPRESSION_H__INCLUDED
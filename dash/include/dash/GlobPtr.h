@@ -121,6 +121,12 @@ public:
    */
   self_t &operator=(const self_t &rhs) = default;
 
+  self_t &operator=(std::nullptr_t) DASH_NOEXCEPT
+  {
+    m_dart_pointer = DART_GPTR_NULL;
+    return *this;
+  }
+
   //clang-format off
   /**
    * Implicit Converting Constructor, only allowed if one of the following
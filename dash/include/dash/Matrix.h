@@ -5,6 +5,7 @@
 
 #include <dash/Team.h>
 #include <dash/Pattern.h>
+#include <dash/Expression.h>
 #include <dash/GlobRef.h>
 #include <dash/HView.h>
 #include <dash/Meta.h>
@@ -359,6 +360,21 @@ public:
    */
   self_t & operator=(self_t && other);
 
+  /**
+   * Assigns the elements of an element-wise expression to the local
+   * elements of the matrix, evaluated at the end of the statement or by
+   * \c dash::eval.
+   *
+   * \see  DashExpressions
+   */
+  template <
+    class ExprT,
+    typename = typename std::enable_if<
+                 dash::expr::is_expression<ExprT>::value>::type>
+  dash::expr::assignment<self_t, ExprT> operator=(const ExprT & expr) {
+    return { *this, expr };
+  }
+
   /**
    * View at block at given global block coordinates.
    */
@@ -788,6 +804,21 @@ template <
   typename LocalMemSpaceT = HostSpace>
 using NArray = dash::Matrix<T, NumDimensions, IndexT, PatternT, LocalMemSpaceT>;
 
+namespace expr {
+
+template <
+  typename ElementT,
+  dim_t    NumDimensions,
+  typename IndexT,
+  class    PatternT,
+  typename LocalMemSpaceT>
+struct is_expression_container<
+         dash::Matrix<ElementT, NumDimensions, IndexT, PatternT,
+                      LocalMemSpaceT>>
+  : std::true_type { };
+
+} // namespace expr
+
 }  // namespace dash
 
 #include <dash/matrix/internal/Matrix-inl.h>
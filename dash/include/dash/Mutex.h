@@ -4,13 +4,17 @@
 #include <dash/Team.h>
 #include <dash/dart/if/dart_synchronization.h>
 
+#include <chrono>
+#include <memory>
+
 namespace dash {
 
 /**
  * Behaves similar to \c std::mutex and is used to ensure mutual exclusion
  * within a dash team.
  *
- * \note This works properly with \c std::lock_guard
+ * \note This works properly with \c std::lock_guard and, as it meets
+ *       the requirements of \c TimedLockable, with \c std::unique_lock
  * \note Mutex cannot be placed in DASH containers
  *
  * \code
@@ -90,10 +94,36 @@ public:
   bool try_lock();
 
   /**
-   * Release the lock acquired through \c lock() or \c try_lock().
+   * Try to acquire the lock within the given duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Rep, class Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout)
+  {
+    return try_lock_for_us(
+        std::chrono::duration_cast<std::chrono::microseconds>(timeout));
+  }
+
+  /**
+   * Try to acquire the lock until the given point in time.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Clock, class Duration>
+  bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>& timeout_time)
+  {
+    return try_lock_for(timeout_time - Clock::now());
+  }
+
+  /**
+   * Release the lock acquired through \c lock() or any of the
+   * \c try_lock variants.
    */
   void unlock();
 
+private:
+  bool try_lock_for_us(std::chrono::microseconds timeout);
+
 private:
   dash::Team const* _team{nullptr};
   std::unique_ptr<std::remove_pointer<dart_lock_t>::type, DestroyDARTLock>
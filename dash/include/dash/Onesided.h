@@ -30,6 +30,34 @@ namespace internal {
       DART_OK);
   }
 
+  /**
+   * Write of \c nelem values from \c src to the global memory location
+   * referenced by \c gptr that adds \c value to the integer flag
+   * referenced by \c flag_gptr once the values are visible at the target.
+   * The flag update is completed by a subsequent flush of \c flag_gptr.
+   *
+   * \sa dart_put_notify
+   */
+  template<typename T>
+  inline
+  void
+  put_notify(
+    const dart_gptr_t & gptr,
+    const T           * src,
+    size_t              nelem,
+    const dart_gptr_t & flag_gptr,
+    int                 value) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_notify(gptr,
+                      src,
+                      ds.nelem,
+                      ds.dtype,
+                      flag_gptr,
+                      value),
+      DART_OK);
+  }
+
   /**
    * Non-blocking read of \c nelem values the global memory
    * location referenced by \c gptr into memory referenced by \c src.
@@ -116,6 +144,35 @@ namespace internal {
       DART_OK);
   }
 
+  /**
+   * Write of \c nelem values from \c src to the global memory location
+   * referenced by \c gptr that adds \c value to the integer flag
+   * referenced by \c flag_gptr once the handle is completed.
+   *
+   * \sa dart_put_notify_handle
+   */
+  template<typename T>
+  inline
+  void
+  put_notify_handle(
+    const dart_gptr_t & gptr,
+    const T           * src,
+    size_t              nelem,
+    const dart_gptr_t & flag_gptr,
+    int                 value,
+    dart_handle_t     * handle) {
+    dash::dart_storage<T> ds(nelem);
+    DASH_ASSERT_RETURNS(
+      dart_put_notify_handle(gptr,
+                             src,
+                             ds.nelem,
+                             ds.dtype,
+                             flag_gptr,
+                             value,
+                             handle),
+      DART_OK);
+  }
+
   /**
    * Non-blocking read of \c nelem values the global memory
    * location referenced by \c gptr into memory referenced by \c src.
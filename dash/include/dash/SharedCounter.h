@@ -2,14 +2,52 @@
 #define DASH__SHARED_COUNTER_H_
 
 #include <dash/Array.h>
+#include <dash/Atomic.h>
+#include <dash/util/UnitLocality.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
 
 namespace dash {
 
+/**
+ * Strategies used by \c dash::SharedCounter to distribute counter
+ * updates among the units in its team.
+ */
+enum class SharedCounterMode : uint16_t {
+  /**
+   * Every unit accumulates its own increments, reading the counter
+   * sums the values of all units.
+   * Increments are unit-local, reads are not atomic and require O(u)
+   * remote reads for \c u units.
+   */
+  distributed,
+  /**
+   * All units atomically update a single home location at the first unit
+   * in the team.
+   * Increments and reads are atomic and require a single remote
+   * operation each.
+   */
+  atomic,
+  /**
+   * Units atomically update a home location at the first unit on their
+   * node, so increments are combined in the node's shared memory.
+   * Reads accumulate the values of all nodes and require O(n) remote
+   * reads for \c n nodes.
+   */
+  node_combining
+};
+
 /**
  * A simple shared counter that allows atomic increment-
  * and decrement operations.
  *
- * TODO: Should probably be based on MPI_ACCUMULATE.
+ * Counter values are updated using atomic DART operations. Depending on
+ * the \ref SharedCounterMode, every unit, every node or the entire team
+ * shares a single counter location.
+ *
+ * \see dash::SharedCounterMode
  */
 template<typename ValueType = int>
 class SharedCounter {
@@ -20,21 +58,22 @@ public:
   /**
    * Constructor.
    */
-  SharedCounter()
-  : _num_units(dash::Team::All().size()),
-    _myid(dash::Team::All().myid()),
-    _local_counts(_num_units)
-  {
-    _local_counts.local[0] = 0;
-    _local_counts.barrier();
-  }
+  SharedCounter(
+    SharedCounterMode mode = SharedCounterMode::distributed)
+  : SharedCounter(dash::Team::All(), mode)
+  { }
 
-  SharedCounter(dash::Team& team)
+  SharedCounter(
+    dash::Team&       team,
+    SharedCounterMode mode = SharedCounterMode::distributed)
   : _num_units(team.size()),
     _myid(team.myid()),
+    _mode(mode),
+    _home(_myid),
     _local_counts(_num_units, team)
   {
-    _local_counts.local[0] = 0;
+    _local_counts.local[0] = dash::Atomic<ValueType>(0);
+    init_homes(team);
     _local_counts.barrier();
   }
 
@@ -45,7 +84,7 @@ public:
     /// Increment value
     ValueType increment)
   {
-    _local_counts[_myid] += increment;
+    _local_counts[_home].add(increment);
   }
 
   /**
@@ -55,35 +94,95 @@ public:
     /// Decrement value
     ValueType increment)
   {
-    _local_counts[_myid] -= increment;
+    _local_counts[_home].sub(increment);
   }
 
   /**
    * Read the current value of the shared counter.
-   * Accumulates increment/decrement values of every unit.
-   * Reading a shared is not atomic, use Team::barrier() to synchronize.
+   * Accumulates increment/decrement values of every home location.
+   * In mode \c SharedCounterMode::atomic, the value is read in a single
+   * atomic operation. Otherwise, reading a shared counter is not atomic,
+   * use Team::barrier() to synchronize.
    *
-   * \complexity  O(u) for \c u units in the associated team
+   * \complexity  O(1) in mode \c SharedCounterMode::atomic, O(n) for \c n
+   *              nodes in mode \c SharedCounterMode::node_combining, and
+   *              O(u) for \c u units in the associated team otherwise
    */
   ValueType get() const
   {
     ValueType acc = 0;
-    for (team_unit_t i{0}; i < _num_units; ++i) {
-      // use local access on own counter value:
-      acc += (i == _myid
-                ? _local_counts.local[0]
-                : _local_counts[i]);
+    for (auto home : _homes) {
+      acc += _local_counts[home].get();
     }
     return acc;
   }
 
+  /**
+   * The strategy used to distribute counter updates.
+   */
+  inline SharedCounterMode mode() const noexcept
+  {
+    return _mode;
+  }
+
+private:
+  /**
+   * Determines the home location of the calling unit and the set of home
+   * locations to accumulate on reads.
+   */
+  void init_homes(dash::Team & team)
+  {
+    switch (_mode) {
+      case SharedCounterMode::atomic:
+        _home = team_unit_t{0};
+        _homes.push_back(_home);
+        break;
+      case SharedCounterMode::node_combining: {
+        // The first unit on every node is the home of the node's counter.
+        // Locality information is available at every unit, no
+        // communication is needed to find the node leaders.
+        std::vector<std::string> hosts;
+        hosts.reserve(_num_units);
+        for (team_unit_t u{0}; u < _num_units; ++u) {
+          dash::util::UnitLocality uloc(team, u);
+          hosts.emplace_back(uloc.hwinfo().host);
+        }
+        for (team_unit_t u{0}; u < _num_units; ++u) {
+          team_unit_t leader(static_cast<dart_unit_t>(
+                               std::find(hosts.begin(), hosts.end(), hosts[u])
+                               - hosts.begin()));
+          if (leader == u) {
+            _homes.push_back(u);
+          }
+          if (u == _myid) {
+            _home = leader;
+          }
+        }
+        break;
+      }
+      default:
+        _homes.reserve(_num_units);
+        for (team_unit_t u{0}; u < _num_units; ++u) {
+          _homes.push_back(u);
+        }
+    }
+    DASH_LOG_DEBUG("SharedCounter.init_homes", "home:", _home,
+                   "number of homes:", _homes.size());
+  }
+
 private:
   /// The number of units interacting with the counter
-  size_t                 _num_units;
+  size_t                               _num_units;
   /// The DART id of the unit that created this local counter intance
-  team_unit_t            _myid;
-  /// Buffer containing counter increments/decrements of every unit
-  dash::Array<ValueType> _local_counts;
+  team_unit_t                          _myid;
+  /// The strategy used to distribute counter updates
+  SharedCounterMode                    _mode;
+  /// The unit owning the counter value updated by this unit
+  team_unit_t                          _home;
+  /// The units owning counter values that are accumulated on reads
+  std::vector<team_unit_t>             _homes;
+  /// Buffer containing counter increments/decrements of every home
+  dash::Array<dash::Atomic<ValueType>> _local_counts;
 };
 
 } // namespace dash
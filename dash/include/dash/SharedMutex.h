@@ -0,0 +1,183 @@
+#ifndef DASH__SHARED_MUTEX_H__INCLUDED
+#define DASH__SHARED_MUTEX_H__INCLUDED
+
+#include <dash/Team.h>
+#include <dash/dart/if/dart_synchronization.h>
+
+#include <chrono>
+#include <memory>
+
+namespace dash {
+
+/**
+ * Behaves similar to \c std::shared_timed_mutex and is used to ensure
+ * mutual exclusion of writers and concurrent access of readers within a
+ * dash team.
+ *
+ * Units register for shared access on their node only, so readers are
+ * admitted without communication across nodes. Exclusive access excludes
+ * readers on all nodes and takes precedence over waiting readers.
+ *
+ * \note This works properly with \c std::lock_guard, \c std::unique_lock
+ *       and \c std::shared_lock
+ * \note SharedMutex cannot be placed in DASH containers
+ *
+ * \code
+ * dash::SharedMutex mx; // mutex for dash::Team::All();
+ * dash::Array<int> arr(10);
+ * {
+ *    std::shared_lock<dash::SharedMutex> sl(mx);
+ *    int tmp = arr[0];
+ * }
+ * {
+ *    std::unique_lock<dash::SharedMutex> ul(mx, std::chrono::seconds(1));
+ *    if (ul.owns_lock()) {
+ *      arr[0] = arr[0] + 1;
+ *    }
+ * }
+ * \endcode
+ */
+class SharedMutex {
+private:
+  using self_t = SharedMutex;
+
+  struct DestroyDARTLock {
+    void operator()(dart_lock_t lock)
+    {
+      if (DART_LOCK_NULL != lock) {
+        auto ret = dart_team_lock_destroy(&lock);
+
+        if (ret != DART_OK) {
+          DASH_LOG_ERROR(
+              "Failed to destroy DART lock! "
+              "(dart_team_lock_destroy failed)");
+        }
+      }
+    }
+  };
+
+public:
+  /**
+   * DASH SharedMutex is only valid for a dash team. If no team is passed,
+   * team all is used.
+   *
+   * This function is not thread-safe
+   * @param team team for mutual exclusive accesses
+   */
+  explicit SharedMutex(Team& team = dash::Team::All());
+
+  SharedMutex(const SharedMutex& other) = delete;
+  SharedMutex(SharedMutex&& other)      = default;
+
+  self_t& operator=(const self_t& other) = delete;
+  self_t& operator=(self_t&& other) = default;
+
+  /**
+   * Collective destructor to destruct a DART lock.
+   *
+   * This function is not thread-safe
+   */
+  ~SharedMutex() = default;
+
+  /**
+   * Collective initialization of the DART lock.
+   *
+   * This function is not thread-safe
+   *
+   * @return True if lock was successfully initialized, False otherwise
+   */
+  bool init();
+
+  /**
+   * Block until the lock was acquired for exclusive access.
+   */
+  void lock();
+
+  /**
+   * Try to acquire the lock for exclusive access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock();
+
+  /**
+   * Try to acquire the lock for exclusive access within the given
+   * duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Rep, class Period>
+  bool try_lock_for(const std::chrono::duration<Rep, Period>& timeout)
+  {
+    return try_lock_for_us(
+        std::chrono::duration_cast<std::chrono::microseconds>(timeout),
+        false);
+  }
+
+  /**
+   * Try to acquire the lock for exclusive access until the given point in
+   * time.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Clock, class Duration>
+  bool try_lock_until(
+      const std::chrono::time_point<Clock, Duration>& timeout_time)
+  {
+    return try_lock_for(timeout_time - Clock::now());
+  }
+
+  /**
+   * Release the lock acquired for exclusive access.
+   */
+  void unlock();
+
+  /**
+   * Block until the lock was acquired for shared access.
+   */
+  void lock_shared();
+
+  /**
+   * Try to acquire the lock for shared access and return immediately.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  bool try_lock_shared();
+
+  /**
+   * Try to acquire the lock for shared access within the given duration.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Rep, class Period>
+  bool try_lock_shared_for(const std::chrono::duration<Rep, Period>& timeout)
+  {
+    return try_lock_for_us(
+        std::chrono::duration_cast<std::chrono::microseconds>(timeout),
+        true);
+  }
+
+  /**
+   * Try to acquire the lock for shared access until the given point in
+   * time.
+   * @return True if lock was successfully aquired, False otherwise
+   */
+  template <class Clock, class Duration>
+  bool try_lock_shared_until(
+      const std::chrono::time_point<Clock, Duration>& timeout_time)
+  {
+    return try_lock_shared_for(timeout_time - Clock::now());
+  }
+
+  /**
+   * Release the lock acquired for shared access.
+   */
+  void unlock_shared();
+
+private:
+  bool try_lock_for_us(std::chrono::microseconds timeout, bool shared);
+
+private:
+  dash::Team const* _team{nullptr};
+  std::unique_ptr<std::remove_pointer<dart_lock_t>::type, DestroyDARTLock>
+      _mutex{DART_LOCK_NULL};
+};  // class SharedMutex
+
+}  // namespace dash
+
+#endif  // DASH__SHARED_MUTEX_H__INCLUDED
@@ -0,0 +1,291 @@
+#ifndef DASH__ALGORITHM__EVAL_H__
+#define DASH__ALGORITHM__EVAL_H__
+
+#include <dash/Expression.h>
+#include <dash/Team.h>
+
+#include <dash/algorithm/Operation.h>
+
+#include <dash/dart/if/dart_communication.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+namespace dash {
+namespace expr {
+
+/**
+ * Partial result of a reduction, invalid if no element contributed to it.
+ */
+template <class ValueT>
+struct reduction_state {
+  ValueT value{};
+  bool   valid = false;
+};
+
+/**
+ * Action reducing the elements of an expression to a single value.
+ * Created by \c dash::reduce_into and evaluated by \c dash::eval.
+ *
+ * \ingroup DashExpressions
+ */
+template <class ValueT, class ExprT, class BinaryOperation>
+class reduction {
+public:
+  using state_type = reduction_state<ValueT>;
+
+  static_assert(std::is_trivially_copyable<ValueT>::value,
+                "Reduction results must be trivially copyable");
+
+public:
+  reduction(ValueT & result, const ExprT & expr, BinaryOperation op)
+    : _result(&result)
+    , _expr(expr)
+    , _op(op)
+  { }
+
+  void release() { }
+
+  inline void first(dash::default_index_t l_idx, state_type & s) const {
+    s.value = _expr(l_idx);
+    s.valid = true;
+  }
+
+  inline void apply(dash::default_index_t l_idx, state_type & s) const {
+    s.value = _op(s.value, _expr(l_idx));
+  }
+
+  void combine(const state_type & in, state_type & inout) const {
+    if (in.valid) {
+      inout.value = inout.valid ? _op(inout.value, in.value) : in.value;
+      inout.valid = true;
+    }
+  }
+
+  void assign(const state_type & s) const {
+    if (!s.valid) {
+      DASH_LOG_ERROR("dash::eval", "Found invalid reduction value!");
+      return;
+    }
+    *_result = s.value;
+  }
+
+  template <class UnaryFunction>
+  void for_each_terminal(UnaryFunction && f) const {
+    _expr.for_each_terminal(f);
+  }
+
+private:
+  ValueT          * _result;
+  ExprT             _expr;
+  BinaryOperation   _op;
+};
+
+/**
+ * Reduction of the values assigned by a preceding assignment, created by
+ * \c dash::reduce_into without an expression.
+ *
+ * \ingroup DashExpressions
+ */
+template <class ValueT, class BinaryOperation>
+struct reduction_target {
+  ValueT          * result;
+  BinaryOperation   op;
+};
+
+namespace detail {
+
+template <class... Actions>
+struct has_reduction : std::false_type { };
+
+template <class Action, class... Actions>
+struct has_reduction<Action, Actions...>
+  : std::integral_constant<bool,
+      !std::is_same<typename Action::state_type, no_state>::value ||
+      has_reduction<Actions...>::value>
+{ };
+
+/**
+ * Reduction operation combining the partial results of all reductions
+ * evaluated in a single call of \c dash::eval.
+ */
+template <class... Actions>
+void reduce_states_fn(
+  const void   * invec,
+        void   * inoutvec,
+        size_t   len,
+        void   * userdata)
+{
+  using states_t  = std::tuple<typename Actions::state_type...>;
+  using actions_t = std::tuple<Actions &...>;
+  const auto * in      = static_cast<const states_t *>(invec);
+  auto       * inout   = static_cast<states_t *>(inoutvec);
+  const auto & actions = *static_cast<const actions_t *>(userdata);
+  for (size_t i = 0; i < len; ++i) {
+    combine_states(actions, in[i], inout[i]);
+  }
+}
+
+} // namespace detail
+} // namespace expr
+
+/**
+ * Creates a reduction of the elements of expression \c e using the
+ * associative, commutative binary operation \c binary_op, to be
+ * evaluated by \c dash::eval.
+ *
+ * \code
+ *   double dot;
+ *   dash::eval(dash::reduce_into(dot, x * y));
+ * \endcode
+ *
+ * \ingroup DashExpressions
+ */
+template <
+  class ValueT,
+  class ExprT,
+  class BinaryOperation = dash::plus<ValueT>,
+  typename = typename std::enable_if<
+                        expr::detail::is_node_or_container<ExprT>::value
+                      >::type>
+expr::reduction<ValueT, expr::detail::operand_t<ExprT>, BinaryOperation>
+reduce_into(
+  /// Variable to store the result of the reduction at every unit
+  ValueT          & result,
+  /// Expression or container to reduce
+  ExprT          && e,
+  /// Reduce operation
+  BinaryOperation   binary_op = BinaryOperation())
+{
+  return expr::reduction<
+           ValueT, expr::detail::operand_t<ExprT>, BinaryOperation>(
+             result, expr::detail::operand<ExprT>::make(e), binary_op);
+}
+
+/**
+ * Creates a reduction of the values assigned to a container, to be
+ * evaluated by \c dash::eval together with the assignment:
+ *
+ * \code
+ *   double sum;
+ *   dash::eval(y = a * x + y, dash::reduce_into(sum));
+ * \endcode
+ *
+ * \ingroup DashExpressions
+ */
+template <
+  class ValueT,
+  class BinaryOperation = dash::plus<ValueT>,
+  typename = typename std::enable_if<
+                        !expr::detail::is_node_or_container<
+                          BinaryOperation>::value
+                      >::type>
+expr::reduction_target<ValueT, BinaryOperation>
+reduce_into(
+  /// Variable to store the result of the reduction at every unit
+  ValueT          & result,
+  /// Reduce operation
+  BinaryOperation   binary_op = BinaryOperation())
+{
+  return { &result, binary_op };
+}
+
+/**
+ * Evaluates assignments and reductions of element-wise expressions in a
+ * single pass over the local elements of their operands.
+ *
+ * All container operands must have identical patterns. Assignments are
+ * applied in the specified order for every element, so actions may use
+ * values assigned by preceding actions:
+ *
+ * \code
+ *   double rr;
+ *   dash::eval(x = x + alpha * p,
+ *              r = r - alpha * q,
+ *              dash::reduce_into(rr, r * r));
+ * \endcode
+ *
+ * Local elements are processed by all threads available to the unit if
+ * DASH is built with OpenMP support.
+ * Collective operation if reductions are specified, partial results of all
+ * reductions are then combined in a single collective reduction.
+ * Assignments alone do not communicate or synchronize units.
+ *
+ * \see      DashExpressions
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class... Actions>
+void eval(Actions &&... actions)
+{
+  DASH_LOG_DEBUG("dash::eval()", "actions:", sizeof...(Actions));
+
+  using states_t = std::tuple<
+                     typename std::decay<Actions>::type::state_type...>;
+  using actions_t = std::tuple<typename std::decay<Actions>::type &...>;
+
+  actions_t actions_tuple(actions...);
+  expr::detail::for_each_index(
+    std::index_sequence_for<Actions...>(), [&](auto k) {
+      std::get<decltype(k)::value>(actions_tuple).release();
+    });
+
+  states_t     l_states;
+  dash::Team * team = expr::detail::evaluate_local(actions_tuple, l_states);
+
+  if (!expr::detail::has_reduction<
+         typename std::decay<Actions>::type...>::value ||
+      team == nullptr) {
+    return;
+  }
+
+  states_t         g_states;
+  dart_datatype_t  dtype;
+  dart_operation_t dop;
+  DASH_ASSERT_RETURNS(
+    dart_type_create_custom(sizeof(states_t), &dtype),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_op_create(
+      &expr::detail::reduce_states_fn<
+        typename std::decay<Actions>::type...>,
+      &actions_tuple, true, dtype, true, &dop),
+    DART_OK);
+  DASH_ASSERT_RETURNS(
+    dart_allreduce(&l_states, &g_states, 1, dtype, dop, team->dart_id()),
+    DART_OK);
+  dart_op_destroy(&dop);
+  dart_type_destroy(&dtype);
+
+  expr::detail::for_each_index(
+    std::index_sequence_for<Actions...>(), [&](auto k) {
+      std::get<decltype(k)::value>(actions_tuple).assign(
+        std::get<decltype(k)::value>(g_states));
+    });
+}
+
+/**
+ * Evaluates an assignment and a reduction of the values it assigns in a
+ * single pass.
+ *
+ * \see  dash::reduce_into(ValueT &, BinaryOperation)
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class ContainerT, class ExprT, class ValueT, class BinaryOperation>
+void eval(
+  expr::assignment<ContainerT, ExprT>           && assign,
+  expr::reduction_target<ValueT, BinaryOperation> target)
+{
+  using terminal_t = expr::terminal<ContainerT>;
+  dash::eval(
+    std::move(assign),
+    expr::reduction<ValueT, terminal_t, BinaryOperation>(
+      *target.result, terminal_t(assign.lhs()), target.op));
+}
+
+} // namespace dash
+
+#endif // DASH__ALGORITHM__EVAL_H__
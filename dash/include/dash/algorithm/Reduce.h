@@ -7,6 +7,11 @@
 #include <dash/algorithm/LocalRange.h>
 #include <dash/algorithm/Operation.h>
 
+#include <dash/Future.h>
+
+#include <memory>
+#include <numeric>
+
 
 namespace dash {
 
@@ -38,6 +43,41 @@ namespace internal {
       }
     }
   }
+
+  /**
+   * State of an asynchronous reduction that has to outlive the call to
+   * \c dash::reduce_async, shared between the callbacks of the returned
+   * future.
+   */
+  template<typename ValueType, typename BinaryOperation>
+  struct reduce_async_state {
+    using local_result_t = local_result<ValueType>;
+
+    local_result<ValueType> l_result;
+    local_result<ValueType> g_result;
+    // referenced as user data by custom DART reduction operations
+    BinaryOperation         binary_op;
+    dart_datatype_t         dtype  = DART_TYPE_UNDEFINED;
+    dart_operation_t        dop    = DART_OP_UNDEFINED;
+    bool                    custom = false;
+    dart_handle_t           handle = DART_HANDLE_NULL;
+
+    explicit reduce_async_state(BinaryOperation op)
+      : binary_op(op)
+    { }
+
+    ~reduce_async_state() {
+      // the pending collective has to complete before the buffers and the
+      // custom reduction operation can be released
+      if (handle != DART_HANDLE_NULL) {
+        dart_wait(&handle);
+      }
+      if (custom) {
+        dart_op_destroy(&dop);
+        dart_type_destroy(&dtype);
+      }
+    }
+  };
 } // namespace internal
 
 
@@ -230,6 +270,163 @@ reduce(
                       team);
 }
 
+/**
+ * Non-blocking variant of \ref dash::reduce on local ranges.
+ * Starts the accumulation of values in each process' range
+ * [\ref in_first, \ref in_last) and returns a future providing the
+ * result, so that units may perform local work while the reduction is
+ * in progress.
+ *
+ * The local range is accumulated before this function returns, the
+ * range may be modified afterwards. The operation completes when the
+ * result is obtained from the future or the future is destroyed.
+ *
+ * Collective operation.
+ *
+ * \param in_first  Local iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Local iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The binary operation to apply to reduce two elements
+ *                  (default: using \ref dash::plus)
+ * \param non_empty Whether all units are guaranteed to provide a non-empty local
+ *                  range (default \c false).
+ * \param team      The team to use for the collective operation.
+ *
+ * \return  A future providing the result of the reduction.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class LocalInputIter,
+  class InitType,
+  class BinaryOperation
+        = dash::plus<typename std::iterator_traits<LocalInputIter>::value_type>,
+  typename = typename std::enable_if<
+                        !dash::detail::is_global_iterator<LocalInputIter>::value
+                      >::type>
+dash::Future<typename std::iterator_traits<LocalInputIter>::value_type>
+reduce_async(
+  LocalInputIter    in_first,
+  LocalInputIter    in_last,
+  InitType          init,
+  BinaryOperation   binary_op = BinaryOperation(),
+  bool              non_empty = true,
+  dash::Team      & team = dash::Team::All())
+{
+  using value_t = typename std::iterator_traits<LocalInputIter>::value_type;
+  using state_t = dash::internal::reduce_async_state<value_t, BinaryOperation>;
+
+  auto state = std::make_shared<state_t>(binary_op);
+
+  if (in_first != in_last) {
+    state->l_result.value = std::accumulate(std::next(in_first),
+                                            in_last, *in_first,
+                                            binary_op);
+    state->l_result.valid = true;
+  }
+  state->dop   = dash::internal::dart_reduce_operation<BinaryOperation>::value;
+  state->dtype = dash::dart_storage<value_t>::dtype;
+
+  if (!non_empty ||
+      state->dop == DART_OP_UNDEFINED || state->dtype == DART_TYPE_UNDEFINED)
+  {
+    dart_type_create_custom(sizeof(typename state_t::local_result_t),
+                            &state->dtype);
+    // we need a custom reduction operation because not every unit
+    // may have valid values
+    dart_op_create(
+      &dash::internal::reduce_custom_fn<value_t, BinaryOperation>,
+      &state->binary_op, true, state->dtype, true, &state->dop);
+    state->custom = true;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result, &state->g_result, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+  } else {
+    // ideal case: we can use DART predefined reductions
+    state->g_result.valid = true;
+    DASH_ASSERT_RETURNS(
+      dart_iallreduce(&state->l_result.value, &state->g_result.value, 1,
+                      state->dtype, state->dop, team.dart_id(),
+                      &state->handle),
+      DART_OK);
+  }
+
+  auto result = [state, init]() {
+    if (!state->g_result.valid) {
+      DASH_LOG_ERROR("Found invalid reduction value!");
+    }
+    return state->binary_op(init, state->g_result.value);
+  };
+
+  return dash::Future<value_t>(
+    // get
+    [state, result]() {
+      DASH_ASSERT_RETURNS(
+        dart_wait(&state->handle),
+        DART_OK);
+      return result();
+    },
+    // test
+    [state, result](value_t *out) {
+      int32_t flag;
+      DASH_ASSERT_RETURNS(
+        dart_test(&state->handle, &flag),
+        DART_OK);
+      if (flag) {
+        *out = result();
+      }
+      return (flag != 0);
+    });
+}
+
+/**
+ * Non-blocking variant of \ref dash::reduce on the global range
+ * [\ref in_first, \ref in_last).
+ *
+ * Collective operation.
+ *
+ * \param in_first  Global iterator describing the beginning of the range to
+ *                  reduce.
+ * \param in_last   Global iterator describing the end of the range to accumualte
+ * \param init      The initial element to use in the accumulation.
+ * \param binary_op The associative, commutative binary operation to apply.
+ *
+ * \return  A future providing the result of the reduction.
+ *
+ * \see dash::reduce
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <
+  class GlobInputIt,
+  class InitType = typename dash::iterator_traits<GlobInputIt>::value_type,
+  class BinaryOperation
+          = dash::plus<typename dash::iterator_traits<GlobInputIt>::value_type>,
+  typename = typename std::enable_if<
+                        dash::detail::is_global_iterator<GlobInputIt>::value
+                      >::type>
+dash::Future<typename dash::iterator_traits<GlobInputIt>::value_type>
+reduce_async(
+  GlobInputIt     in_first,
+  GlobInputIt     in_last,
+  InitType        init,
+  BinaryOperation binary_op = BinaryOperation())
+{
+  auto & team      = in_first.team();
+  auto index_range = dash::local_range(in_first, in_last);
+
+  static constexpr bool units_non_empty = false;
+  return dash::reduce_async(index_range.begin,
+                            index_range.end,
+                            init,
+                            binary_op,
+                            units_non_empty,
+                            team);
+}
+
 } // namespace dash
 
 #endif // DASH__ALGORITHM__REDUCE_H__
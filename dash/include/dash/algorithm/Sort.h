@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <numeric>
 #include <type_traits>
 #include <vector>
 
@@ -17,9 +18,77 @@
 
 #include <dash/internal/Logging.h>
 #include <dash/util/Trace.h>
+#include <dash/util/UnitLocality.h>
 
 namespace dash {
 
+/**
+ * Temporary global and local memory of \c dash::sort that can be reused in
+ * repeated sort operations of ranges distributed over the same team.
+ *
+ * The global partition data is allocated collectively in the first sort
+ * using the workspace, the local buffer keeps the capacity of the largest
+ * local range sorted so far. Subsequent sorts do not allocate global memory.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<double>        particles(n), sorted(n);
+ *       dash::SortWorkspace<double> workspace(particles.team());
+ *       for (int step = 0; step < nsteps; ++step) {
+ *         // ...
+ *         dash::sort(particles.begin(), particles.end(), sorted.begin(),
+ *                    workspace);
+ *       }
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <typename ValueType>
+class SortWorkspace {
+public:
+  typedef ValueType value_type;
+
+public:
+  explicit SortWorkspace(dash::Team& team = dash::Team::All())
+    : _team(&team)
+  {
+  }
+
+  SortWorkspace(const SortWorkspace&) = delete;
+  SortWorkspace& operator=(const SortWorkspace&) = delete;
+
+  dash::Team& team() const
+  {
+    return *_team;
+  }
+
+  /**
+   * Partition data of \c dash::sort, allocated collectively on first access.
+   */
+  dash::Array<std::size_t>& partition_data()
+  {
+    if (_partition_data.size() == 0) {
+      auto const nunits = _team->size();
+      _partition_data.allocate(nunits * nunits * 3, dash::BLOCKED, *_team);
+    }
+    return _partition_data;
+  }
+
+  /**
+   * Buffer of the locally sorted elements to send.
+   */
+  std::vector<value_type>& buffer()
+  {
+    return _buffer;
+  }
+
+private:
+  dash::Team*              _team;
+  dash::Array<std::size_t> _partition_data;
+  std::vector<value_type>  _buffer;
+};
+
 #ifdef DOXYGEN
 
 /**
@@ -32,8 +101,20 @@ namespace dash {
  * In terms of data distribution, source and destination ranges passed to
  * \c dash::sort must be global (\c GlobIter<ValueType>).
  *
+ * Integer and IEEE 754 floating point elements are sorted by a radix sort:
+ * Local ranges are sorted by LSD radix passes and the splitters between
+ * units are determined digit by digit, so the number of collective rounds
+ * is bounded by the width of the element type independent of the
+ * distribution of values.
+ *
  * The operation is collective among the team of the owning dash container.
  *
+ * If OpenMP is enabled, the local sort, the histogram passes and the final
+ * merge of received sequences are distributed among the threads available
+ * to the unit, see \c dash::util::UnitLocality::num_domain_threads.
+ * Multi-threading is disabled with the configuration key
+ * \c DASH_DISABLE_THREADS.
+ *
  * Example:
  *
  * \code
@@ -80,98 +161,181 @@ void sort(GlobRandomIt begin, GlobRandomIt end);
 template <class GlobRandomIt, class SortableHash>
 void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash hash);
 
-#else
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) in the order
+ * defined by a user-defined comparison function. The order of equal
+ * elements is not guaranteed to be preserved.
+ *
+ * The comparison function has to be a strict weak ordering on the element
+ * type, which must be trivially copyable. Unlike the variant with a sortable
+ * hash, elements do not have to be mapped to an arithmetic value. This allows
+ * to sort by composite or string keys.
+ *
+ * Elements are sorted by a sample sort: Splitters are selected from samples
+ * of the locally sorted ranges, elements are exchanged between units in a
+ * single all-to-all step and merged locally before they are copied to their
+ * final position in the range.
+ *
+ * The variant without comparison function uses this algorithm with
+ * \c operator< if the elements are not arithmetic.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       struct record { char name[16]; int id; };
+ *       dash::Array<record> arr(100);
+ *       // ...
+ *       dash::sort(array.begin(),
+ *                  array.end(),
+ *                  [](record const & a, record const & b) {
+ *                    int cmp = std::strncmp(a.name, b.name, 16);
+ *                    return cmp < 0 || (cmp == 0 && a.id < b.id);
+ *                  });
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class Compare>
+void sort(GlobRandomIt begin, GlobRandomIt end, Compare comp);
 
-#define __DASH_SORT__FINAL_STEP_BY_MERGE (0)
-#define __DASH_SORT__FINAL_STEP_BY_SORT (1)
-#define __DASH_SORT__FINAL_STEP_STRATEGY (__DASH_SORT__FINAL_STEP_BY_MERGE)
+/**
+ * Sorts the arithmetic elements in the range, defined by \c [begin, end)
+ * into the range starting at \c out. The input range is not modified.
+ *
+ * Temporary memory is taken from the given workspace, so repeated sorts
+ * with the same workspace do not allocate global memory and the locally
+ * sorted elements are sent from the workspace buffer without an additional
+ * copy. The output range must have the same distribution as the input
+ * range.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class GlobOutputIt>
+void sort(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace);
 
-#include <dash/algorithm/internal/Sort-inl.h>
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) by a
+ * user-defined hash function into the range starting at \c out, using the
+ * temporary memory of the given workspace.
+ *
+ * \see dash::SortWorkspace
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt, class GlobOutputIt, class SortableHash>
+void sort(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    SortableHash                                      hash,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace);
 
-template <class GlobRandomIt, class SortableHash>
-void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
-{
-  using iter_type    = GlobRandomIt;
-  using value_type   = typename iter_type::value_type;
-  using mapped_type =
-      typename std::decay<typename dash::functional::closure_traits<
-          SortableHash>::result_type>::type;
+/**
+ * Sorts the elements in the range, defined by \c [begin, end) such that the
+ * relative order of equal elements is preserved.
+ *
+ * Provides the same variants as \c dash::sort: Arithmetic elements are
+ * sorted by value, other elements by \c operator<, a sortable hash or a
+ * comparison function. Locally sorted sequences are received in the order of
+ * their source units and merged stably, so elements of equal keys keep their
+ * order in the range if it is distributed in a single block per unit.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobRandomIt>
+void stable_sort(GlobRandomIt begin, GlobRandomIt end);
 
-  static_assert(
-      std::is_arithmetic<mapped_type>::value,
-      "Only arithmetic types are supported");
+/**
+ * Sorts the arithmetic keys in the range \c [keys_begin, keys_end) in
+ * ascending order and reorders the values in the range starting at
+ * \c values_begin accordingly. The order of equal keys is not guaranteed to
+ * be preserved.
+ *
+ * Keys and values are combined into records which are partitioned by the
+ * histogram sort of \c dash::sort and exchanged between units in a single
+ * all-to-all step. Both ranges must have the same distribution and the
+ * values must be trivially copyable.
+ *
+ * The operation is collective among the team of the owning dash container.
+ *
+ * Example:
+ *
+ * \code
+ *       dash::Array<int>    keys(100);
+ *       dash::Array<double> values(100);
+ *       // ...
+ *       dash::sort_by_key(keys.begin(), keys.end(), values.begin());
+ * \endcode
+ *
+ * \ingroup  DashAlgorithms
+ */
+template <class GlobKeyIt, class GlobValueIt>
+void sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin);
 
-  auto pattern = begin.pattern();
+#else
 
-  dash::util::Trace trace("Sort");
+#define __DASH_SORT__FINAL_STEP_BY_MERGE (0)
+#define __DASH_SORT__FINAL_STEP_BY_SORT (1)
+#define __DASH_SORT__FINAL_STEP_STRATEGY (__DASH_SORT__FINAL_STEP_BY_MERGE)
 
-  auto const sort_comp = [&sortable_hash](
-                             const value_type& a, const value_type& b) {
-    return sortable_hash(a) < sortable_hash(b);
-  };
+#include <dash/algorithm/internal/Sort-inl.h>
+#include <dash/algorithm/internal/RadixSort-inl.h>
 
-  if (pattern.team() == dash::Team::Null()) {
-    DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
-    return;
-  }
-  if (pattern.team().size() == 1) {
-    DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
-    trace.enter_state("final_local_sort");
-    std::sort(begin.local(), end.local(), sort_comp);
-    trace.exit_state("final_local_sort");
-    return;
-  }
+namespace detail {
 
-  if (begin >= end) {
-    DASH_LOG_TRACE("dash::sort", "empty range");
-    trace.enter_state("final_barrier");
-    pattern.team().barrier();
-    trace.exit_state("final_barrier");
-    return;
-  }
+/**
+ * Finds the global partition borders of the locally sorted range
+ * [lbegin, lend) in histogram passes and calculates the number of elements
+ * to send to every unit.
+ *
+ * On return, the send counts are stored in the local portion of
+ * \c g_partition_data at offset \c IDX_SEND_COUNT and their displacements in
+ * \c l_send_displs.
+ *
+ * \return  \c false if no elements have to be exchanged between units
+ */
+template <
+    class GlobRandomIt,
+    class LocalIt,
+    class SortableHash,
+    class MappedType>
+inline bool psort__histogram_partition(
+    GlobRandomIt                 begin,
+    GlobRandomIt                 end,
+    LocalIt                      lbegin,
+    LocalIt                      lend,
+    SortableHash                 sortable_hash,
+    int                          nthreads,
+    UnitInfo const&              p_unit_info,
+    dash::Array<std::size_t>&    g_partition_data,
+    PartitionBorder<MappedType>& p_borders,
+    std::vector<std::size_t>&    valid_partitions,
+    std::vector<std::size_t>&    l_send_displs,
+    dash::util::Trace&           trace)
+{
+  auto const& pattern = begin.pattern();
 
   dash::Team& team   = pattern.team();
   auto const  nunits = team.size();
   auto const  myid   = team.myid();
 
-  auto const unit_at_begin = pattern.unit_at(begin.pos());
-
-  // local distance
-  auto const l_range = dash::local_index_range(begin, end);
-
-  auto* l_mem_begin = dash::local_begin(
-      static_cast<typename GlobRandomIt::pointer>(begin), team.myid());
-
-  auto const n_l_elem = l_range.end - l_range.begin;
-
-  auto * lbegin = l_mem_begin + l_range.begin;
-  auto * lend   = l_mem_begin + l_range.end;
-
-  // initial local_sort
-  trace.enter_state("1:initial_local_sort");
-  std::sort(lbegin, lend, sort_comp);
-  trace.exit_state("1:initial_local_sort");
-
-  trace.enter_state("2:init_temporary_global_data");
-
-  using array_t = dash::Array<std::size_t>;
-
-  std::size_t gsize = nunits * NLT_NLE_BLOCK * 2;
-
-  // implicit barrier...
-  array_t g_partition_data(nunits * nunits * 3, dash::BLOCKED, team);
-  std::uninitialized_fill(
-      g_partition_data.lbegin(), g_partition_data.lend(), 0);
-
-  trace.exit_state("2:init_temporary_global_data");
+  auto const n_l_elem = std::distance(lbegin, lend);
 
   trace.enter_state("3:find_global_min_max");
 
-  // Temporary local buffer (sorted);
-  std::vector<value_type> const lcopy(lbegin, lend);
-
-  auto const min_max = detail::find_global_min_max(
-      std::begin(lcopy), std::end(lcopy), team.dart_id(), sortable_hash);
+  auto const min_max =
+      detail::find_global_min_max(lbegin, lend, team.dart_id(), sortable_hash);
 
   trace.exit_state("3:find_global_min_max");
 
@@ -180,27 +344,22 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   if (min_max.first == min_max.second) {
     // all values are equal, so nothing to sort globally.
-    pattern.team().barrier();
-    return;
+    return false;
   }
 
   trace.enter_state("4:init_temporary_local_data");
 
-  auto const p_unit_info =
-      detail::psort__find_partition_borders(pattern, begin, end);
-
   auto const& acc_partition_count = p_unit_info.acc_partition_count;
 
-  auto const               nboundaries = nunits - 1;
-  std::vector<mapped_type> splitters(nboundaries, mapped_type{});
+  auto const              nboundaries = nunits - 1;
+  std::vector<MappedType> splitters(nboundaries, MappedType{});
 
-  detail::PartitionBorder<mapped_type> p_borders(
+  p_borders = detail::PartitionBorder<MappedType>(
       nboundaries, min_max.first, min_max.second);
 
   detail::psort__init_partition_borders(p_unit_info, p_borders);
 
-  DASH_LOG_TRACE_RANGE(
-      "locally sorted array", std::begin(lcopy), std::end(lcopy));
+  DASH_LOG_TRACE_RANGE("locally sorted array", lbegin, lend);
   DASH_LOG_TRACE_RANGE(
       "skipped splitters",
       p_borders.is_skipped.cbegin(),
@@ -209,7 +368,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   bool done = false;
 
   // collect all valid splitters in a temporary vector
-  std::vector<size_t> valid_partitions;
+  valid_partitions.clear();
 
   {
     // make this as a separately scoped block to deallocate non-required
@@ -234,8 +393,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   if (valid_partitions.empty()) {
     // Edge case: We may have a team spanning at least 2 units, however the
     // global range is owned by  only 1 unit
-    team.barrier();
-    return;
+    return false;
   }
 
   trace.exit_state("4:init_temporary_local_data");
@@ -260,9 +418,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
         splitters,
         valid_partitions,
         p_borders,
-        std::begin(lcopy),
-        std::end(lcopy),
-        sortable_hash);
+        lbegin,
+        lend,
+        sortable_hash,
+        nthreads);
 
     detail::trace_local_histo("local histogram", l_nlt_nle);
 
@@ -298,9 +457,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       splitters,
       valid_partitions,
       p_borders,
-      std::begin(lcopy),
-      std::end(lcopy),
-      sortable_hash);
+      lbegin,
+      lend,
+      sortable_hash,
+      nthreads);
   trace.exit_state("6:final_local_histogram");
 
   DASH_LOG_TRACE_RANGE("final splitters", splitters.begin(), splitters.end());
@@ -425,7 +585,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("13:calc_final_send_count");
 
-  std::vector<std::size_t> l_send_displs(nunits, 0);
+  l_send_displs.assign(nunits, 0);
 
   if (n_l_elem > 0) {
     auto const* l_target_count =
@@ -480,6 +640,165 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.exit_state("13:calc_final_send_count");
 
+  return true;
+}
+
+/**
+ * Histogram sort of the range [begin, end) by a sortable hash into the range
+ * starting at \c out which may be identical to \c begin.
+ * If \c stable is set, the order of elements with equal hash values is
+ * preserved.
+ */
+template <class GlobRandomIt, class GlobOutputIt, class SortableHash>
+inline void psort__hash_sort(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    SortableHash                                      sortable_hash,
+    bool                                              stable,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace)
+{
+  using value_type   = typename GlobRandomIt::value_type;
+  using mapped_type =
+      typename std::decay<typename dash::functional::closure_traits<
+          SortableHash>::result_type>::type;
+
+  static_assert(
+      std::is_arithmetic<mapped_type>::value,
+      "Only arithmetic types are supported");
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("Sort");
+
+  auto const sort_comp = [&sortable_hash](
+                             const value_type& a, const value_type& b) {
+    return sortable_hash(a) < sortable_hash(b);
+  };
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc(pattern.team(), pattern.team().myid());
+  auto const nthreads = uloc.num_domain_threads();
+#else
+  auto const nthreads = 1;
+#endif
+  DASH_LOG_DEBUG("dash::sort", "thread capacity:", nthreads);
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+  auto const  myid   = team.myid();
+
+  if (detail::psort__any_unit(workspace.team() != team, team)) {
+    DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::sort: workspace has been created for a different team");
+  }
+
+  // local distance
+  auto const l_range = dash::local_index_range(begin, end);
+
+  auto* l_mem_begin = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(begin), team.myid());
+
+  auto const n_l_elem = l_range.end - l_range.begin;
+
+  auto * lbegin = l_mem_begin + l_range.begin;
+  auto * lend   = l_mem_begin + l_range.end;
+
+  auto const l_out_range = dash::local_index_range(out, out + (end - begin));
+  auto const n_l_out     = l_out_range.end - l_out_range.begin;
+
+  if (detail::psort__any_unit(n_l_out != n_l_elem, team)) {
+    DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::sort: input and output ranges must have the same "
+        "distribution, local sizes at unit "
+            << myid << " are " << n_l_elem << " and " << n_l_out);
+  }
+
+  auto * l_out_begin =
+      dash::local_begin(
+          static_cast<typename GlobOutputIt::pointer>(out), team.myid()) +
+      l_out_range.begin;
+  auto * l_out_end = l_out_begin + n_l_elem;
+
+  if (nunits == 1) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
+    trace.enter_state("final_local_sort");
+    if (l_out_begin != lbegin) {
+      std::copy(lbegin, lend, l_out_begin);
+    }
+    detail::psort__local_sort(
+        l_out_begin, l_out_end, sort_comp, nthreads, stable);
+    trace.exit_state("final_local_sort");
+    return;
+  }
+
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::sort", "empty range");
+    trace.enter_state("final_barrier");
+    team.barrier();
+    trace.exit_state("final_barrier");
+    return;
+  }
+
+  auto const unit_at_begin = pattern.unit_at(begin.pos());
+
+  // initial local_sort into the local buffer of the workspace which is the
+  // source of the exchange
+  trace.enter_state("1:initial_local_sort");
+  auto& lcopy = workspace.buffer();
+  lcopy.assign(lbegin, lend);
+  detail::psort__local_sort(
+      std::begin(lcopy), std::end(lcopy), sort_comp, nthreads, stable);
+  trace.exit_state("1:initial_local_sort");
+
+  trace.enter_state("2:init_temporary_global_data");
+
+  // collective allocation in the first sort using the workspace
+  auto& g_partition_data = workspace.partition_data();
+  // Resetting local partition data is safe without barrier: Remote units
+  // write to it only after the allreduce in find_global_min_max.
+  std::fill(g_partition_data.lbegin(), g_partition_data.lend(), 0);
+
+  trace.exit_state("2:init_temporary_global_data");
+
+  // Copies the locally sorted buffer to the output range if no elements
+  // are exchanged
+  auto const copy_local = [&]() {
+    std::copy(std::begin(lcopy), std::end(lcopy), l_out_begin);
+  };
+
+  auto const p_unit_info =
+      detail::psort__find_partition_borders(pattern, begin, end);
+
+  detail::PartitionBorder<mapped_type> p_borders;
+  std::vector<size_t>                  valid_partitions;
+  std::vector<size_t>                  l_send_displs;
+
+  if (!detail::psort__histogram_partition(
+          begin,
+          end,
+          std::begin(lcopy),
+          std::end(lcopy),
+          sortable_hash,
+          nthreads,
+          p_unit_info,
+          g_partition_data,
+          p_borders,
+          valid_partitions,
+          l_send_displs,
+          trace)) {
+    copy_local();
+    team.barrier();
+    return;
+  }
+
   trace.enter_state("14:barrier");
   team.barrier();
   trace.exit_state("14:barrier");
@@ -505,7 +824,7 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("17:exchange_data (all-to-all)");
 
-  std::vector<dash::Future<iter_type> > async_copies{};
+  std::vector<dash::Future<GlobOutputIt> > async_copies{};
   async_copies.reserve(p_unit_info.valid_remote_partitions.size());
 
   auto const l_partition_data = g_partition_data.local;
@@ -524,27 +843,25 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   for (auto const& unit : p_unit_info.valid_remote_partitions) {
     std::tie(send_count, send_disp, target_disp) = get_send_info(unit);
 
-    // Get a global iterator to the first local element of a unit within the
+    // Get the offset of the first local element of a unit within the
     // range to be sorted [begin, end)
     //
-    iter_type it_copy =
+    auto const unit_offset =
         (unit == unit_at_begin)
             ?
             /* If we are the unit at the beginning of the global range simply
                return begin */
-            begin
+            0
             :
-            /* Otherwise construct an global iterator pointing the first local
-               element from the correspoding unit */
-            iter_type{&(begin.globmem()),
-                      pattern,
-                      pattern.global_index(
-                          static_cast<dash::team_unit_t>(unit), {})};
+            /* Otherwise find the global index of the first local element
+               from the correspoding unit */
+            pattern.global_index(static_cast<dash::team_unit_t>(unit), {}) -
+                begin.pos();
 
     auto&& fut = dash::copy_async(
         &(*(lcopy.begin() + send_disp)),
         &(*(lcopy.begin() + send_disp + send_count)),
-        it_copy + target_disp);
+        out + unit_offset + target_disp);
 
     async_copies.emplace_back(std::move(fut));
   }
@@ -555,13 +872,13 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
     std::copy(
         std::next(std::begin(lcopy), send_disp),
         std::next(std::begin(lcopy), send_disp + send_count),
-        std::next(lbegin, target_disp));
+        std::next(l_out_begin, target_disp));
   }
 
   std::for_each(
       std::begin(async_copies),
       std::end(async_copies),
-      [](dash::Future<iter_type>& fut) { fut.wait(); });
+      [](dash::Future<GlobOutputIt>& fut) { fut.wait(); });
 
   trace.exit_state("17:exchange_data (all-to-all)");
 
@@ -587,7 +904,8 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
   trace.exit_state("18:barrier");
 
   trace.enter_state("19:final_local_sort");
-  std::sort(lbegin, lend);
+  detail::psort__local_sort(
+      l_out_begin, l_out_end, sort_comp, nthreads, stable);
   trace.exit_state("19:final_local_sort");
 #else
   trace.enter_state("18:calc_recv_count (all-to-all)");
@@ -614,15 +932,10 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
 
   trace.enter_state("19:merge_local_sequences");
 
-  // merging sorted sequences
-  auto nsequences = nunits;
-  // number of merge steps in the tree
-  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
-
   // calculate the prefix sum among all receive counts to find the offsets for
   // merging
   std::vector<size_t> recv_count_psum;
-  recv_count_psum.reserve(nsequences + 1);
+  recv_count_psum.reserve(nunits + 1);
   recv_count_psum.emplace_back(0);
 
   std::partial_sum(
@@ -635,44 +948,208 @@ void sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
       std::begin(recv_count_psum),
       std::end(recv_count_psum));
 
-  for (std::size_t d = 0; d < depth; ++d) {
-    // distance between first and mid iterator while merging
-    auto const step = std::size_t(0x1) << d;
-    // distance between first and last iterator while merging
-    auto const dist = step << 1;
-    // number of merges
-    auto const nmerges = nsequences >> 1;
-
-    // These merges are independent from each other and are candidates for
-    // shared memory parallelism
-    for (std::size_t m = 0; m < nmerges; ++m) {
-      auto first = std::next(lbegin, recv_count_psum[m * dist]);
-      auto mid   = std::next(lbegin, recv_count_psum[m * dist + step]);
-      // sometimes we have a lonely merge in the end, so we have to guarantee
-      // that we do not access out of bounds
-      auto last = std::next(
-          lbegin,
-          recv_count_psum[std::min(
-              m * dist + dist, recv_count_psum.size() - 1)]);
-
-      std::inplace_merge(first, mid, last);
-    }
-
-    nsequences -= nmerges;
-  }
+  // merging sorted sequences
+  detail::psort__merge_tree(
+      l_out_begin, recv_count_psum, sort_comp, nthreads);
 
   trace.exit_state("19:merge_local_sequences");
 #endif
 
-  DASH_LOG_TRACE_RANGE("finally sorted range", lbegin, lend);
+  DASH_LOG_TRACE_RANGE("finally sorted range", l_out_begin, l_out_end);
 
   trace.enter_state("20:final_barrier");
   team.barrier();
   trace.exit_state("20:final_barrier");
 }
 
-namespace detail {
-template <typename T>
+/**
+ * Sample sort of the range [begin, end) by a comparison function.
+ * If \c stable is set, the order of equivalent elements is preserved.
+ */
+template <class GlobRandomIt, class Compare>
+inline void psort__sample_sort(
+    GlobRandomIt begin, GlobRandomIt end, Compare comp, bool stable)
+{
+  using value_type = typename GlobRandomIt::value_type;
+
+  static_assert(
+      std::is_trivially_copyable<value_type>::value,
+      "Only trivially copyable types are supported");
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("SampleSort");
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc(pattern.team(), pattern.team().myid());
+  auto const nthreads = uloc.num_domain_threads();
+#else
+  auto const nthreads = 1;
+#endif
+  DASH_LOG_DEBUG("dash::sort", "thread capacity:", nthreads);
+
+  if (pattern.team().size() == 1) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
+    trace.enter_state("final_local_sort");
+    detail::psort__local_sort(
+        begin.local(), end.local(), comp, nthreads, stable);
+    trace.exit_state("final_local_sort");
+    return;
+  }
+
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::sort", "empty range");
+    trace.enter_state("final_barrier");
+    pattern.team().barrier();
+    trace.exit_state("final_barrier");
+    return;
+  }
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+
+  // local distance
+  auto const l_range = dash::local_index_range(begin, end);
+
+  auto* l_mem_begin = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(begin), team.myid());
+
+  auto * lbegin = l_mem_begin + l_range.begin;
+  auto * lend   = l_mem_begin + l_range.end;
+
+  // initial local_sort
+  trace.enter_state("1:initial_local_sort");
+  detail::psort__local_sort(lbegin, lend, comp, nthreads, stable);
+  trace.exit_state("1:initial_local_sort");
+
+  trace.enter_state("2:find_splitters");
+
+  auto const p_unit_info =
+      detail::psort__find_partition_borders(pattern, begin, end);
+
+  auto const splitters = detail::psort__sample_splitters(
+      lbegin, lend, comp, p_unit_info.acc_partition_count, team.dart_id());
+
+  trace.exit_state("2:find_splitters");
+
+  trace.enter_state("3:calc_send_count");
+
+  // Send counts and displacements in bytes, the locally sorted range is sent
+  // in place
+  std::vector<size_t> send_count(nunits, 0);
+  std::vector<size_t> send_displs(nunits, 0);
+
+  auto l_part_begin = lbegin;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    auto l_part_end = (u < splitters.size())
+                          ? std::upper_bound(
+                                l_part_begin, lend, splitters[u], comp)
+                          : lend;
+    send_displs[u] = std::distance(lbegin, l_part_begin) * sizeof(value_type);
+    send_count[u] =
+        std::distance(l_part_begin, l_part_end) * sizeof(value_type);
+    l_part_begin = l_part_end;
+  }
+
+  trace.exit_state("3:calc_send_count");
+
+  trace.enter_state("4:exchange_data (all-to-all)");
+
+  std::vector<size_t> recv_count(nunits, 0);
+  std::vector<size_t> recv_displs(nunits, 0);
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          send_count.data(),
+          recv_count.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::partial_sum(
+      std::begin(recv_count),
+      std::prev(std::end(recv_count)),
+      std::next(std::begin(recv_displs)));
+
+  auto const n_recv =
+      (recv_displs[nunits - 1] + recv_count[nunits - 1]) / sizeof(value_type);
+
+  std::vector<value_type> l_partition(n_recv);
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+          lbegin,
+          send_count.data(),
+          send_displs.data(),
+          DART_TYPE_BYTE,
+          l_partition.data(),
+          recv_count.data(),
+          recv_displs.data(),
+          team.dart_id()),
+      DART_OK);
+
+  trace.exit_state("4:exchange_data (all-to-all)");
+
+  trace.enter_state("5:merge_local_sequences");
+
+  std::vector<size_t> recv_count_psum;
+  recv_count_psum.reserve(nunits + 1);
+  for (auto const displ : recv_displs) {
+    recv_count_psum.emplace_back(displ / sizeof(value_type));
+  }
+  recv_count_psum.emplace_back(n_recv);
+
+  detail::psort__merge_tree(
+      std::begin(l_partition), recv_count_psum, comp, nthreads);
+
+  trace.exit_state("5:merge_local_sequences");
+
+  trace.enter_state("6:calc_target_offset");
+
+  std::vector<size_t> partition_sizes(nunits, 0);
+
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          &n_recv,
+          partition_sizes.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  auto const target_offset = std::accumulate(
+      std::begin(partition_sizes),
+      std::next(std::begin(partition_sizes), team.myid()),
+      static_cast<size_t>(0));
+
+  trace.exit_state("6:calc_target_offset");
+
+  // All units must have sent their local range before it is overwritten
+  trace.enter_state("7:barrier");
+  team.barrier();
+  trace.exit_state("7:barrier");
+
+  trace.enter_state("8:copy_to_target_range");
+  if (n_recv > 0) {
+    dash::copy(
+        l_partition.data(),
+        l_partition.data() + n_recv,
+        begin + target_offset);
+  }
+  trace.exit_state("8:copy_to_target_range");
+
+  trace.enter_state("9:final_barrier");
+  team.barrier();
+  trace.exit_state("9:final_barrier");
+}
+
+template <typename T>
 struct identity_t : std::unary_function<T, T> {
   constexpr T&& operator()(T&& t) const noexcept
   {
@@ -680,15 +1157,624 @@ struct identity_t : std::unary_function<T, T> {
     return std::forward<T>(t);
   }
 };
+
+/**
+ * Radix sort of the arithmetic elements in the range [begin, end) into the
+ * range starting at \c out which may be identical to \c begin.
+ *
+ * Splitters are determined digit by digit in a bounded number of allreduce
+ * rounds, elements are exchanged in a single all-to-all step. The radix sort
+ * is stable.
+ */
+template <class GlobRandomIt, class GlobOutputIt>
+inline void psort__radix_sort(
+    GlobRandomIt                                    begin,
+    GlobRandomIt                                    end,
+    GlobOutputIt                                    out,
+    std::vector<typename GlobRandomIt::value_type>& lbuf)
+{
+  using value_type = typename GlobRandomIt::value_type;
+  using traits     = detail::psort__radix_traits<value_type>;
+  using key_type   = typename traits::key_type;
+
+  static_assert(
+      traits::is_sortable, "Only integer and IEEE 754 keys are supported");
+
+  auto pattern = begin.pattern();
+
+  dash::util::Trace trace("RadixSort");
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc(pattern.team(), pattern.team().myid());
+  auto const nthreads = uloc.num_domain_threads();
+#else
+  auto const nthreads = 1;
+#endif
+  DASH_LOG_DEBUG("dash::sort", "thread capacity:", nthreads);
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+  auto const  myid   = team.myid();
+
+  // local distance
+  auto const l_range = dash::local_index_range(begin, end);
+
+  auto* l_mem_begin = dash::local_begin(
+      static_cast<typename GlobRandomIt::pointer>(begin), team.myid());
+
+  auto const n_l_elem = static_cast<std::size_t>(l_range.end - l_range.begin);
+
+  auto * lbegin = l_mem_begin + l_range.begin;
+  auto * lend   = l_mem_begin + l_range.end;
+
+  auto const l_out_range = dash::local_index_range(out, out + (end - begin));
+  auto const n_l_out     =
+      static_cast<std::size_t>(l_out_range.end - l_out_range.begin);
+
+  if (detail::psort__any_unit(n_l_out != n_l_elem, team)) {
+    DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::sort: input and output ranges must have the same "
+        "distribution, local sizes at unit "
+            << myid << " are " << n_l_elem << " and " << n_l_out);
+  }
+
+  auto * l_out_begin =
+      dash::local_begin(
+          static_cast<typename GlobOutputIt::pointer>(out), team.myid()) +
+      l_out_range.begin;
+
+  if (nunits == 1) {
+    DASH_LOG_TRACE("dash::sort", "Sorting on a team with only 1 unit");
+    trace.enter_state("final_local_sort");
+    if (l_out_begin != lbegin) {
+      std::copy(lbegin, lend, l_out_begin);
+    }
+    lbuf.resize(n_l_elem);
+    detail::psort__local_radix_sort(
+        l_out_begin, l_out_begin + n_l_elem, lbuf.data(), nthreads);
+    trace.exit_state("final_local_sort");
+    return;
+  }
+
+  if (begin >= end) {
+    DASH_LOG_TRACE("dash::sort", "empty range");
+    trace.enter_state("final_barrier");
+    team.barrier();
+    trace.exit_state("final_barrier");
+    return;
+  }
+
+  // The local output range is not accessed by other units before the
+  // exchange and serves as scratch memory of the local sort
+  trace.enter_state("1:initial_local_sort");
+  lbuf.assign(lbegin, lend);
+  value_type* lsorted_begin = lbuf.data();
+  value_type* lsorted_end   = lbuf.data() + n_l_elem;
+  detail::psort__local_radix_sort(
+      lsorted_begin, lsorted_end, l_out_begin, nthreads);
+  trace.exit_state("1:initial_local_sort");
+
+  trace.enter_state("2:find_global_min_max");
+
+  auto const min_max = detail::find_global_min_max(
+      lsorted_begin,
+      lsorted_end,
+      team.dart_id(),
+      [](value_type const& v) -> key_type { return traits::key(v); });
+
+  trace.exit_state("2:find_global_min_max");
+
+  if (min_max.first == min_max.second) {
+    // all values are equal, so nothing to sort globally.
+    std::copy(lsorted_begin, lsorted_end, l_out_begin);
+    team.barrier();
+    return;
+  }
+
+  trace.enter_state("3:find_splitters");
+
+  auto const p_unit_info =
+      detail::psort__find_partition_borders(pattern, begin, end);
+
+  auto const& acc_partition_count = p_unit_info.acc_partition_count;
+  auto const  n_g_elem            = acc_partition_count[nunits];
+
+  // Global ranks of the first elements of units, splitters of units without
+  // elements or following the last element are trivial
+  std::vector<std::size_t> ranks;
+  for (std::size_t u = 1; u < nunits; ++u) {
+    auto const rank = acc_partition_count[u];
+    if (rank > 0 && rank < n_g_elem) {
+      ranks.push_back(rank);
+    }
+  }
+
+  auto const splitters = detail::psort__radix_find_splitters(
+      lsorted_begin,
+      lsorted_end,
+      ranks,
+      min_max.first,
+      min_max.second,
+      team.dart_id());
+
+  trace.exit_state("3:find_splitters");
+
+  trace.enter_state("4:calc_send_count");
+
+  auto const splits = detail::psort__radix_local_splits(
+      lsorted_begin,
+      lsorted_end,
+      ranks,
+      splitters,
+      myid,
+      nunits,
+      team.dart_id());
+
+  // Send counts and displacements in bytes
+  std::vector<size_t> send_count(nunits, 0);
+  std::vector<size_t> send_displs(nunits, 0);
+
+  std::size_t s            = 0;
+  std::size_t l_part_begin = 0;
+  for (std::size_t u = 0; u < nunits; ++u) {
+    auto const rank = acc_partition_count[u + 1];
+    auto const l_part_end =
+        (u + 1 == nunits || rank >= n_g_elem)
+            ? n_l_elem
+            : (rank == 0) ? 0 : splits[s++];
+    send_displs[u] = l_part_begin * sizeof(value_type);
+    send_count[u]  = (l_part_end - l_part_begin) * sizeof(value_type);
+    l_part_begin   = l_part_end;
+  }
+
+  trace.exit_state("4:calc_send_count");
+
+  trace.enter_state("5:exchange_data (all-to-all)");
+
+  std::vector<size_t> recv_count(nunits, 0);
+  std::vector<size_t> recv_displs(nunits, 0);
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          send_count.data(),
+          recv_count.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::partial_sum(
+      std::begin(recv_count),
+      std::prev(std::end(recv_count)),
+      std::next(std::begin(recv_displs)));
+
+  DASH_ASSERT_EQ(
+      (recv_displs[nunits - 1] + recv_count[nunits - 1]) / sizeof(value_type),
+      n_l_elem,
+      "receive count must match the capacity of the unit");
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+          lsorted_begin,
+          send_count.data(),
+          send_displs.data(),
+          DART_TYPE_BYTE,
+          l_out_begin,
+          recv_count.data(),
+          recv_displs.data(),
+          team.dart_id()),
+      DART_OK);
+
+  trace.exit_state("5:exchange_data (all-to-all)");
+
+  trace.enter_state("6:merge_local_sequences");
+
+  std::vector<size_t> recv_count_psum;
+  recv_count_psum.reserve(nunits + 1);
+  for (auto const displ : recv_displs) {
+    recv_count_psum.emplace_back(displ / sizeof(value_type));
+  }
+  recv_count_psum.emplace_back(n_l_elem);
+
+  detail::psort__merge_tree(
+      l_out_begin,
+      recv_count_psum,
+      detail::psort__radix_less<value_type>(),
+      nthreads);
+
+  trace.exit_state("6:merge_local_sequences");
+
+  trace.enter_state("7:final_barrier");
+  team.barrier();
+  trace.exit_state("7:final_barrier");
+}
+
+/**
+ * Sorts arithmetic elements by radix sort if supported for the value type.
+ */
+template <class GlobRandomIt, class GlobOutputIt>
+inline void psort__sort_arithmetic(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    bool                                              stable,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace,
+    std::true_type)
+{
+  // The radix sort is stable
+  (void)(stable);
+  detail::psort__radix_sort(begin, end, out, workspace.buffer());
+}
+
+/**
+ * Sorts arithmetic elements by their value as sortable hash.
+ */
+template <class GlobRandomIt, class GlobOutputIt>
+inline void psort__sort_arithmetic(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    bool                                              stable,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace,
+    std::false_type)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  detail::psort__hash_sort(
+      begin,
+      end,
+      out,
+      detail::identity_t<value_t const&>(),
+      stable,
+      workspace);
+}
+
+template <class GlobRandomIt>
+inline void sort(
+    GlobRandomIt begin, GlobRandomIt end, bool stable, std::true_type)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  SortWorkspace<typename GlobRandomIt::value_type> workspace(
+      begin.pattern().team());
+
+  detail::psort__sort_arithmetic(
+      begin,
+      end,
+      begin,
+      stable,
+      workspace,
+      std::integral_constant<
+          bool,
+          detail::psort__radix_traits<value_t>::is_sortable>());
+}
+
+template <class GlobRandomIt>
+inline void sort(
+    GlobRandomIt begin, GlobRandomIt end, bool stable, std::false_type)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  detail::psort__sample_sort(begin, end, std::less<value_t>(), stable);
+}
 }  // namespace detail
 
+template <class GlobRandomIt, class SortableHash>
+inline typename std::enable_if<!detail::psort__is_comparator<
+    SortableHash,
+    typename GlobRandomIt::value_type>::value>::type
+sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+{
+  SortWorkspace<typename GlobRandomIt::value_type> workspace(
+      begin.pattern().team());
+
+  detail::psort__hash_sort(
+      begin, end, begin, sortable_hash, false, workspace);
+}
+
+template <class GlobRandomIt, class Compare>
+inline typename std::enable_if<detail::psort__is_comparator<
+    Compare,
+    typename GlobRandomIt::value_type>::value>::type
+sort(GlobRandomIt begin, GlobRandomIt end, Compare comp)
+{
+  detail::psort__sample_sort(begin, end, comp, false);
+}
+
 template <class GlobRandomIt>
 inline void sort(GlobRandomIt begin, GlobRandomIt end)
 {
   using value_t = typename std::remove_cv<
       typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
 
-  dash::sort(begin, end, detail::identity_t<value_t const&>());
+  detail::sort(begin, end, false, std::is_arithmetic<value_t>());
+}
+
+template <class GlobRandomIt, class GlobOutputIt, class SortableHash>
+inline void sort(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    SortableHash                                      sortable_hash,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace)
+{
+  detail::psort__hash_sort(begin, end, out, sortable_hash, false, workspace);
+}
+
+template <class GlobRandomIt, class GlobOutputIt>
+inline void sort(
+    GlobRandomIt                                      begin,
+    GlobRandomIt                                      end,
+    GlobOutputIt                                      out,
+    SortWorkspace<typename GlobRandomIt::value_type>& workspace)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  static_assert(
+      std::is_arithmetic<value_t>::value,
+      "Only arithmetic types are supported, use a sortable hash otherwise");
+
+  detail::psort__sort_arithmetic(
+      begin,
+      end,
+      out,
+      false,
+      workspace,
+      std::integral_constant<
+          bool,
+          detail::psort__radix_traits<value_t>::is_sortable>());
+}
+
+template <class GlobRandomIt, class SortableHash>
+inline typename std::enable_if<!detail::psort__is_comparator<
+    SortableHash,
+    typename GlobRandomIt::value_type>::value>::type
+stable_sort(GlobRandomIt begin, GlobRandomIt end, SortableHash sortable_hash)
+{
+  SortWorkspace<typename GlobRandomIt::value_type> workspace(
+      begin.pattern().team());
+
+  detail::psort__hash_sort(
+      begin, end, begin, sortable_hash, true, workspace);
+}
+
+template <class GlobRandomIt, class Compare>
+inline typename std::enable_if<detail::psort__is_comparator<
+    Compare,
+    typename GlobRandomIt::value_type>::value>::type
+stable_sort(GlobRandomIt begin, GlobRandomIt end, Compare comp)
+{
+  detail::psort__sample_sort(begin, end, comp, true);
+}
+
+template <class GlobRandomIt>
+inline void stable_sort(GlobRandomIt begin, GlobRandomIt end)
+{
+  using value_t = typename std::remove_cv<
+      typename dash::iterator_traits<GlobRandomIt>::value_type>::type;
+
+  detail::sort(begin, end, true, std::is_arithmetic<value_t>());
+}
+
+template <class GlobKeyIt, class GlobValueIt>
+void sort_by_key(
+    GlobKeyIt keys_begin, GlobKeyIt keys_end, GlobValueIt values_begin)
+{
+  using key_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobKeyIt>::value_type>::type;
+  using mapped_value_type = typename std::remove_cv<
+      typename dash::iterator_traits<GlobValueIt>::value_type>::type;
+  using record_type = detail::psort__key_value<key_type, mapped_value_type>;
+
+  static_assert(
+      std::is_arithmetic<key_type>::value,
+      "Only arithmetic key types are supported");
+  static_assert(
+      std::is_trivially_copyable<mapped_value_type>::value,
+      "Only trivially copyable value types are supported");
+
+  auto pattern = keys_begin.pattern();
+
+  dash::util::Trace trace("SortByKey");
+
+  auto const key_hash = [](record_type const& r) -> key_type {
+    return r.key;
+  };
+  auto const key_comp = [](record_type const& a, record_type const& b) {
+    return a.key < b.key;
+  };
+
+  if (pattern.team() == dash::Team::Null()) {
+    DASH_LOG_TRACE("dash::sort_by_key", "Sorting on dash::Team::Null()");
+    return;
+  }
+
+  dash::Team& team   = pattern.team();
+  auto const  nunits = team.size();
+
+  auto const values_end = values_begin + (keys_end - keys_begin);
+
+  auto const l_keys_range   = dash::local_index_range(keys_begin, keys_end);
+  auto const l_values_range = dash::local_index_range(values_begin, values_end);
+
+  auto const n_l_elem   = l_keys_range.end - l_keys_range.begin;
+  auto const n_l_values = l_values_range.end - l_values_range.begin;
+
+  if (detail::psort__any_unit(n_l_values != n_l_elem, team)) {
+    DASH_THROW(
+        dash::exception::InvalidArgument,
+        "dash::sort_by_key: key and value ranges must have the same "
+        "distribution, local sizes at unit "
+            << team.myid() << " are " << n_l_elem << " and " << n_l_values);
+  }
+
+  auto* lkeys =
+      dash::local_begin(
+          static_cast<typename GlobKeyIt::pointer>(keys_begin), team.myid()) +
+      l_keys_range.begin;
+  auto* lvalues = dash::local_begin(
+                      static_cast<typename GlobValueIt::pointer>(values_begin),
+                      team.myid()) +
+                  l_values_range.begin;
+
+#ifdef DASH_ENABLE_OPENMP
+  dash::util::UnitLocality uloc(team, team.myid());
+  auto const nthreads = uloc.num_domain_threads();
+#else
+  auto const nthreads = 1;
+#endif
+  DASH_LOG_DEBUG("dash::sort_by_key", "thread capacity:", nthreads);
+
+  if (nunits > 1 && keys_begin >= keys_end) {
+    DASH_LOG_TRACE("dash::sort_by_key", "empty range");
+    trace.enter_state("final_barrier");
+    team.barrier();
+    trace.exit_state("final_barrier");
+    return;
+  }
+
+  // Writes sorted records back to the local key and value ranges
+  auto const unpack = [lkeys, lvalues](
+                          record_type const* first, record_type const* last) {
+    for (auto it = first; it != last; ++it) {
+      lkeys[it - first]   = it->key;
+      lvalues[it - first] = it->value;
+    }
+  };
+
+  // initial local_sort of key-value records
+  trace.enter_state("1:initial_local_sort");
+  std::vector<record_type> lcopy(n_l_elem);
+  for (dash::default_index_t i = 0; i < n_l_elem; ++i) {
+    lcopy[i].key   = lkeys[i];
+    lcopy[i].value = lvalues[i];
+  }
+  detail::psort__local_sort(
+      std::begin(lcopy), std::end(lcopy), key_comp, nthreads);
+  trace.exit_state("1:initial_local_sort");
+
+  if (nunits == 1) {
+    DASH_LOG_TRACE("dash::sort_by_key", "Sorting on a team with only 1 unit");
+    unpack(lcopy.data(), lcopy.data() + n_l_elem);
+    return;
+  }
+
+  trace.enter_state("2:init_temporary_global_data");
+
+  // implicit barrier...
+  dash::Array<std::size_t> g_partition_data(
+      nunits * nunits * 3, dash::BLOCKED, team);
+  std::uninitialized_fill(
+      g_partition_data.lbegin(), g_partition_data.lend(), 0);
+
+  trace.exit_state("2:init_temporary_global_data");
+
+  auto const p_unit_info =
+      detail::psort__find_partition_borders(pattern, keys_begin, keys_end);
+
+  detail::PartitionBorder<key_type> p_borders;
+  std::vector<size_t>               valid_partitions;
+  std::vector<size_t>               l_send_displs;
+
+  if (!detail::psort__histogram_partition(
+          keys_begin,
+          keys_end,
+          std::begin(lcopy),
+          std::end(lcopy),
+          key_hash,
+          nthreads,
+          p_unit_info,
+          g_partition_data,
+          p_borders,
+          valid_partitions,
+          l_send_displs,
+          trace)) {
+    unpack(lcopy.data(), lcopy.data() + n_l_elem);
+    team.barrier();
+    return;
+  }
+
+  trace.enter_state("14:exchange_data (all-to-all)");
+
+  // Keys and values are exchanged as records in a single step, counts and
+  // displacements in bytes
+  std::vector<size_t> send_count(nunits, 0);
+  std::vector<size_t> send_displs(nunits, 0);
+  std::vector<size_t> recv_count(nunits, 0);
+  std::vector<size_t> recv_displs(nunits, 0);
+
+  for (std::size_t u = 0; u < nunits; ++u) {
+    send_count[u] =
+        g_partition_data.local[IDX_SEND_COUNT(nunits) + u] *
+        sizeof(record_type);
+    send_displs[u] = l_send_displs[u] * sizeof(record_type);
+  }
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoall(
+          send_count.data(),
+          recv_count.data(),
+          1,
+          dash::dart_datatype<size_t>::value,
+          team.dart_id()),
+      DART_OK);
+
+  std::partial_sum(
+      std::begin(recv_count),
+      std::prev(std::end(recv_count)),
+      std::next(std::begin(recv_displs)));
+
+  auto const n_recv =
+      (recv_displs[nunits - 1] + recv_count[nunits - 1]) / sizeof(record_type);
+
+  DASH_ASSERT_EQ(
+      n_recv, n_l_elem, "receive count must match the capacity of the unit");
+
+  std::vector<record_type> l_partition(n_recv);
+
+  DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+          lcopy.data(),
+          send_count.data(),
+          send_displs.data(),
+          DART_TYPE_BYTE,
+          l_partition.data(),
+          recv_count.data(),
+          recv_displs.data(),
+          team.dart_id()),
+      DART_OK);
+
+  trace.exit_state("14:exchange_data (all-to-all)");
+
+  trace.enter_state("15:merge_local_sequences");
+
+  std::vector<size_t> recv_count_psum;
+  recv_count_psum.reserve(nunits + 1);
+  for (auto const displ : recv_displs) {
+    recv_count_psum.emplace_back(displ / sizeof(record_type));
+  }
+  recv_count_psum.emplace_back(n_recv);
+
+  detail::psort__merge_tree(
+      std::begin(l_partition), recv_count_psum, key_comp, nthreads);
+
+  unpack(l_partition.data(), l_partition.data() + n_recv);
+
+  trace.exit_state("15:merge_local_sequences");
+
+  trace.enter_state("16:final_barrier");
+  team.barrier();
+  trace.exit_state("16:final_barrier");
 }
 
 #endif  // DOXYGEN
@@ -8,12 +8,18 @@
 #include <dash/algorithm/Operation.h>
 
 #include <dash/Iterator.h>
+#include <dash/Onesided.h>
 
 #include <dash/internal/Config.h>
+#include <dash/pattern/internal/PatternCompare.h>
 #include <dash/util/Trace.h>
 
 #include <dash/dart/if/dart_communication.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #ifdef DASH_ENABLE_OPENMP
 #include <omp.h>
 #endif
@@ -60,14 +66,26 @@ OutputIt transform(
  * Apply a given function to pairs of elements from two ranges and store the
  * result in another range, beginning at \c out_first.
  *
- * Corresponding to \c MPI_Accumulate, the binary operation is executed
- * atomically on single elements.
+ * If the first input range is local, the result is accumulated to the
+ * global output range. Corresponding to \c MPI_Accumulate, the binary
+ * operation is executed atomically on single elements.
  *
- * Precondition: All elements in the input range are contained in a single
- * block so that
+ * Precondition: All elements in the local input range are contained in a
+ * single block so that
  *
  *   g_out_last == g_out_first + (l_in_last - l_in_first)
  *
+ * If the first input range is global, the transformation is a collective
+ * operation and every unit computes the output elements in its local
+ * memory (owner computes), no atomic operations are needed:
+ *
+ * - If all ranges have identical distribution and start offset, units
+ *   operate on their local input elements only.
+ * - Otherwise, units fetch the input elements corresponding to their
+ *   local output elements using pipelined non-blocking reads.
+ *   If the output range is also an input range, units synchronize before
+ *   writing output elements.
+ *
  * Semantics:
  *
  *   binary_op(in_a[0], in_b[0]),
@@ -188,7 +206,6 @@ struct transform_impl_glob_input_it{};
  * </pre>
  */
 template <
-    typename ValueType,
     class InputAIt,
     class InputBIt,
     class GlobOutputIt,
@@ -201,59 +218,217 @@ GlobOutputIt transform_local(
     BinaryOperation binary_op)
 {
   DASH_LOG_DEBUG("dash::transform_local()");
-  DASH_ASSERT_MSG(in_a_first.pattern() == in_b_first.pattern(),
-                  "dash::transform_local: "
-                  "distributions of input ranges differ");
-  DASH_ASSERT_MSG(in_a_first.pattern() == out_first.pattern(),
-                  "dash::transform_local: "
-                  "distributions of input- and output ranges differ");
+  DASH_ASSERT_MSG(
+    same_distribution(in_a_first.pattern(), in_b_first.pattern()),
+    "dash::transform_local: distributions of input ranges differ");
+  DASH_ASSERT_MSG(
+    same_distribution(in_a_first.pattern(), out_first.pattern()),
+    "dash::transform_local: "
+    "distributions of input- and output ranges differ");
+  // Number of elements in global ranges:
+  auto num_gvalues    = dash::distance(in_a_first, in_a_last);
+  DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
   // Local subrange of input range a:
-  auto local_range_a   = dash::local_range(in_a_first, in_a_last);
-  ValueType * lbegin_a = local_range_a.begin;
-  ValueType * lend_a   = local_range_a.end;
-  if (lbegin_a == lend_a) {
-    // Local input range is empty, return initial output iterator to indicate
-    // that no values have been transformed:
+  auto l_index_range  = dash::local_index_range(in_a_first, in_a_last);
+  auto l_size         = l_index_range.end - l_index_range.begin;
+  if (l_size <= 0) {
     DASH_LOG_DEBUG("dash::transform_local", "local range empty");
-    return out_first;
+    return out_first + num_gvalues;
   }
-  // Global offset of first local element:
-  auto g_offset_first    = in_a_first.pattern().global(0);
-  // Number of elements in global ranges:
-  auto num_gvalues       = dash::distance(in_a_first, in_b_first);
-  DASH_LOG_TRACE_VAR("dash::transform_local", num_gvalues);
-  // Number of local elements:
-  DASH_LOG_TRACE("dash::transform_local", "local elements:", lend_a-lbegin_a);
-  // Local subrange of input range b:
-  ValueType * lbegin_b   = (in_b_first + g_offset_first).local();
-  // Local pointer of initial output element:
-  ValueType * lbegin_out = (out_first  + g_offset_first).local();
+  DASH_LOG_TRACE("dash::transform_local", "local elements:", l_size);
+  // Offset of the first local element in the ranges, identical in all
+  // ranges:
+  auto l_offset       = in_a_first.pattern().global(l_index_range.begin)
+                        - in_a_first.pos();
+  auto * lbegin_a     = (in_a_first + l_offset).local();
+  auto * lbegin_b     = (in_b_first + l_offset).local();
+  auto * lbegin_out   = (out_first  + l_offset).local();
   // Generate output values:
 #ifdef DASH_ENABLE_OPENMP
   dash::util::UnitLocality uloc;
   auto n_threads = uloc.num_domain_threads();
   DASH_LOG_DEBUG("dash::transform_local", "thread capacity:",  n_threads);
   if (n_threads > 1) {
-    auto l_size = lend_a - lbegin_a;
-    // TODO: Vectorize.
-    // Documentation of Intel MIC intrinsics, see:
-    // https://software.intel.com/de-de/node/523533
-    // https://software.intel.com/de-de/node/523387
     #pragma omp parallel for num_threads(n_threads) schedule(static)
-    for (int i = 0; i < l_size; i++) {
+    for (decltype(l_size) i = 0; i < l_size; i++) {
       lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
     }
     return out_first + num_gvalues;
   }
 #endif
   // No OpenMP or insufficient number of threads for parallelization:
-  for (; lbegin_a != lend_a; ++lbegin_a, ++lbegin_b, ++lbegin_out) {
-    *lbegin_out = binary_op(*lbegin_a, *lbegin_b);
+  for (decltype(l_size) i = 0; i < l_size; i++) {
+    lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
   }
   // Return out_end iterator past final transformed element;
   return out_first + num_gvalues;
 }
 
+/**
+ * Issues non-blocking reads of \c nelem elements starting at \c first into
+ * \c dest, one for every contiguous range of elements in the memory of a
+ * single unit.
+ */
+template <class GlobInputIt, class ValueType, class IndexType>
+void transform_fetch_async(
+    GlobInputIt                  first,
+    IndexType                    nelem,
+    ValueType                  * dest,
+    std::vector<dart_handle_t> & handles)
+{
+  IndexType run_begin = 0;
+  auto      run_lpos  = first.lpos();
+  for (IndexType i = 1; i <= nelem; ++i) {
+    if (i < nelem) {
+      auto lpos = (first + i).lpos();
+      if (lpos.unit  == run_lpos.unit &&
+          lpos.index == run_lpos.index + (i - run_begin)) {
+        continue;
+      }
+      run_lpos = lpos;
+    }
+    dart_handle_t handle;
+    dash::internal::get_handle(
+      (first + run_begin).dart_gptr(), dest + run_begin,
+      i - run_begin, &handle);
+    handles.push_back(handle);
+    run_begin = i;
+  }
+}
+
+/**
+ * Transform operation on ranges with different distribution or start
+ * offset.
+ * Every unit computes its local output elements from input elements that
+ * are fetched in pipelined non-blocking reads issued for all contiguous
+ * blocks of local output elements at once. Blocks are computed as soon
+ * as their input elements arrived.
+ */
+template <
+    class GlobInputAIt,
+    class GlobInputBIt,
+    class GlobOutputIt,
+    class BinaryOperation>
+GlobOutputIt transform_owner_computes(
+    GlobInputAIt    in_a_first,
+    GlobInputAIt    in_a_last,
+    GlobInputBIt    in_b_first,
+    GlobOutputIt    out_first,
+    BinaryOperation binary_op)
+{
+  using value_a_t = typename dash::iterator_traits<GlobInputAIt>::value_type;
+  using value_b_t = typename dash::iterator_traits<GlobInputBIt>::value_type;
+  using index_t   = typename GlobOutputIt::pattern_type::index_type;
+
+  DASH_LOG_DEBUG("dash::transform_owner_computes()");
+  auto num_gvalues   = dash::distance(in_a_first, in_a_last);
+  auto out_last      = out_first + num_gvalues;
+  const auto & pattern_out = out_first.pattern();
+
+  // Contiguous blocks of local output elements:
+  struct block_t {
+    index_t lbegin;
+    index_t offset;
+    index_t size;
+  };
+  std::vector<block_t> blocks;
+  auto l_index_range = dash::local_index_range(out_first, out_last);
+  index_t num_lvalues = 0;
+  for (index_t l = l_index_range.begin; l < l_index_range.end; ++l) {
+    index_t offset = pattern_out.global(l) - out_first.pos();
+    if (offset < 0 || offset >= num_gvalues) {
+      continue;
+    }
+    if (!blocks.empty() &&
+        blocks.back().lbegin + blocks.back().size == l &&
+        blocks.back().offset + blocks.back().size == offset) {
+      ++blocks.back().size;
+    } else {
+      blocks.push_back(block_t { l, offset, 1 });
+    }
+    ++num_lvalues;
+  }
+  DASH_LOG_TRACE("dash::transform_owner_computes", "local elements:",
+                 num_lvalues, "blocks:", blocks.size());
+
+  // Issue reads of all input blocks:
+  std::vector<value_a_t> values_a(num_lvalues);
+  std::vector<value_b_t> values_b(num_lvalues);
+  std::vector<std::vector<dart_handle_t>> handles(blocks.size());
+  std::vector<index_t> buf_offsets(blocks.size());
+  index_t buf_offset = 0;
+  for (size_t b = 0; b < blocks.size(); ++b) {
+    const auto & block = blocks[b];
+    buf_offsets[b] = buf_offset;
+    transform_fetch_async(in_a_first + block.offset, block.size,
+                          values_a.data() + buf_offset, handles[b]);
+    transform_fetch_async(in_b_first + block.offset, block.size,
+                          values_b.data() + buf_offset, handles[b]);
+    buf_offset += block.size;
+  }
+  auto wait_block = [&handles](size_t b) {
+    DASH_ASSERT_RETURNS(
+      dart_waitall_local(handles[b].data(), handles[b].size()),
+      DART_OK);
+  };
+
+  // Units must not overwrite input elements before all units fetched them:
+  bool out_is_input = false;
+  if (num_gvalues > 0) {
+    dart_gptr_t gptr_out = out_first.dart_gptr();
+    dart_gptr_t gptr_a   = in_a_first.dart_gptr();
+    dart_gptr_t gptr_b   = in_b_first.dart_gptr();
+    out_is_input = (gptr_out.teamid == gptr_a.teamid &&
+                    gptr_out.segid  == gptr_a.segid) ||
+                   (gptr_out.teamid == gptr_b.teamid &&
+                    gptr_out.segid  == gptr_b.segid);
+  }
+  if (out_is_input) {
+    DASH_LOG_TRACE("dash::transform_owner_computes",
+                   "output range is input range, synchronize");
+    for (size_t b = 0; b < blocks.size(); ++b) {
+      wait_block(b);
+    }
+    pattern_out.team().barrier();
+  }
+
+  auto compute_block = [&](size_t b) {
+    const auto & block = blocks[b];
+    auto * lbegin_out = (out_first + block.offset).local();
+    const value_a_t * lbegin_a = values_a.data() + buf_offsets[b];
+    const value_b_t * lbegin_b = values_b.data() + buf_offsets[b];
+    for (index_t i = 0; i < block.size; ++i) {
+      lbegin_out[i] = binary_op(lbegin_a[i], lbegin_b[i]);
+    }
+  };
+
+  // Compute blocks in the order of their arrival, block on the first
+  // pending block if none of them arrived yet:
+  std::vector<size_t> pending(blocks.size());
+  std::iota(pending.begin(), pending.end(), 0);
+  while (!pending.empty()) {
+    auto arrived = std::stable_partition(
+                     pending.begin(), pending.end(),
+                     [&handles](size_t b) {
+                       int32_t flag;
+                       DASH_ASSERT_RETURNS(
+                         dart_testall_local(
+                           handles[b].data(), handles[b].size(), &flag),
+                         DART_OK);
+                       return flag == 0;
+                     });
+    if (arrived == pending.end()) {
+      wait_block(pending.front());
+      arrived = std::rotate(pending.begin(), pending.begin() + 1,
+                            pending.end());
+    }
+    std::for_each(arrived, pending.end(), compute_block);
+    pending.erase(arrived, pending.end());
+  }
+
+  return out_last;
+}
+
 /**
  * Specialization of \c dash::transform for global lhs input range.
  */
@@ -276,26 +451,7 @@ GlobOutputIt transform(
     /// Specialization for a global input iterator
     transform_impl_glob_input_it /*unused*/)
 {
-  using iterator_traits = dash::iterator_traits<InputIt>;
   DASH_LOG_DEBUG("dash::transform(gaf, gal, gbf, goutf, binop)");
-  auto in_first = in_a_first;
-  auto in_last  = in_a_last;
-
-  if (in_b_first == out_first) {
-    // Output range is rhs input range: C += A
-    // Input is (in_a_first, in_a_last).
-  } else {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::transform is only implemented for out = op(in,out)");
-    // Output range different from rhs input range: C = A+B
-    // Input is (in_a_first, in_a_last) + (in_b_first, in_b_last):
-
-    // TODO:
-    // in_range.allocate(...);
-    // in_first = in_range.begin();
-    // in_last  = in_range.end();
-  }
 
   dash::util::Trace trace("transform");
 
@@ -304,61 +460,39 @@ GlobOutputIt transform(
   const auto& pattern_in_b = in_b_first.pattern();
   const auto& pattern_out  = out_first.pattern();
 
-#if __NON_ATOMIC__
-  // Fast path: check if transform operation is local-only:
-  if (pattern_in_a == pattern_in_b &&
-      pattern_in_a == pattern_out) {
-    // Identical pattern in all ranges
-    if (in_a_first.pos() == in_b_first.pos() &&
-        in_a_first.pos() == out_first.pos()) {
-      trace.enter_state("local");
-      // All units operate on local ranges that have identical distribution:
-      auto out_last = dash::transform_local<iterator_traits::value_type>(
-                        in_a_first,
-                        in_a_last,
-                        in_b_first,
-                        out_first,
-                        binary_op);
-      trace.exit_state("local");
-      return out_last;
-    }
-  }
-#endif
-  // Resolve teams from global iterators:
-  dash::Team & team_in_a        = pattern_in_a.team();
   DASH_ASSERT_MSG(
-    team_in_a == pattern_in_b.team(),
+    pattern_in_a.team() == pattern_in_b.team(),
     "dash::transform: Different teams in input ranges");
   DASH_ASSERT_MSG(
-    team_in_a == pattern_out.team(),
+    pattern_in_a.team() == pattern_out.team(),
     "dash::transform: Different teams in input- and output ranges");
-  // Resolve local range from global range:
-  auto l_index_range_in_a       = local_index_range(in_a_first, in_a_last);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", l_index_range_in_a.end);
-  // Local range to global offset:
-  auto global_offset            = pattern_in_a.global(
-                                    l_index_range_in_a.begin);
-  DASH_LOG_TRACE_VAR("dash::transform", global_offset);
-  // Number of elements in local range:
-  size_t num_local_elements     = l_index_range_in_a.end -
-                                  l_index_range_in_a.begin;
-  DASH_LOG_TRACE_VAR("dash::transform", num_local_elements);
-  // Global iterator to dart_gptr_t:
-  dart_gptr_t dest_gptr         = (out_first + global_offset).dart_gptr();
-  // Native pointer to local sub-range:
-  auto l_values          = (in_a_first + global_offset).local();
-  // Send accumulate message:
-  trace.enter_state("transform_blocking");
-  dash::internal::transform_blocking_impl(
-      dest_gptr,
-      l_values,
-      num_local_elements,
-      binary_op.dart_operation());
-  trace.exit_state("transform_blocking");
 
-  return out_first + global_offset + num_local_elements;
+  // Fast path: check if transform operation is local-only:
+  if (same_distribution(pattern_in_a, pattern_in_b) &&
+      same_distribution(pattern_in_a, pattern_out) &&
+      in_a_first.pos() == in_b_first.pos() &&
+      in_a_first.pos() == out_first.pos()) {
+    // All units operate on local ranges that have identical distribution:
+    trace.enter_state("local");
+    auto out_last = dash::internal::transform_local(
+                      in_a_first,
+                      in_a_last,
+                      in_b_first,
+                      out_first,
+                      binary_op);
+    trace.exit_state("local");
+    return out_last;
+  }
 
+  trace.enter_state("owner_computes");
+  auto out_last = dash::internal::transform_owner_computes(
+                    in_a_first,
+                    in_a_last,
+                    in_b_first,
+                    out_first,
+                    binary_op);
+  trace.exit_state("owner_computes");
+  return out_last;
 }
 
 template <
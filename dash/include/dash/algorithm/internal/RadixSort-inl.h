@@ -0,0 +1,396 @@
+#ifndef DASH__ALGORITHM__INTERNAL__RADIX_SORT_H__INCLUDED
+#define DASH__ALGORITHM__INTERNAL__RADIX_SORT_H__INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <dash/Types.h>
+
+#include <dash/dart/if/dart.h>
+
+#include <dash/internal/Config.h>
+#include <dash/internal/Logging.h>
+
+namespace detail {
+
+// Number of bits of a single radix digit
+constexpr std::size_t psort__radix_bits = 8;
+
+// Number of buckets of a radix digit
+constexpr std::size_t psort__radix_nbuckets = std::size_t(1)
+                                              << psort__radix_bits;
+
+// Ranges with fewer elements are sorted by comparison
+constexpr std::size_t psort__radix_min_elements = 256;
+
+/**
+ * Maps elements of type \c T to unsigned integer keys such that the order of
+ * keys is the order of elements.
+ *
+ * Keys are at least 32 bits wide as DART reductions are not defined on
+ * smaller unsigned types, passes on digits shared by all keys are skipped.
+ */
+template <typename T, typename = void>
+struct psort__radix_traits {
+  static constexpr bool is_sortable = false;
+};
+
+template <typename T>
+struct psort__radix_traits<
+    T,
+    typename std::enable_if<
+        std::is_integral<T>::value && sizeof(T) <= 8>::type> {
+  static constexpr bool is_sortable = true;
+
+  typedef typename std::
+      conditional<sizeof(T) <= 4, std::uint32_t, std::uint64_t>::type
+          key_type;
+
+  static key_type key(T value) noexcept
+  {
+    typedef typename std::make_signed<key_type>::type wide_signed;
+    // Sign-extended values with flipped sign bit order negative values first
+    return std::is_signed<T>::value
+               ? static_cast<key_type>(static_cast<wide_signed>(value)) ^
+                     (key_type(1) << (sizeof(key_type) * 8 - 1))
+               : static_cast<key_type>(value);
+  }
+};
+
+template <typename T>
+struct psort__radix_traits<
+    T,
+    typename std::enable_if<
+        std::is_floating_point<T>::value &&
+        std::numeric_limits<T>::is_iec559 &&
+        (sizeof(T) == 4 || sizeof(T) == 8)>::type> {
+  static constexpr bool is_sortable = true;
+
+  typedef typename std::
+      conditional<sizeof(T) == 4, std::uint32_t, std::uint64_t>::type
+          key_type;
+
+  static key_type key(T value) noexcept
+  {
+    key_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    key_type const sign = key_type(1) << (sizeof(key_type) * 8 - 1);
+    // Inverting negative values reverses their order
+    return (bits & sign) ? ~bits : (bits | sign);
+  }
+};
+
+template <typename T>
+struct psort__radix_less {
+  bool operator()(T const& a, T const& b) const noexcept
+  {
+    return psort__radix_traits<T>::key(a) < psort__radix_traits<T>::key(b);
+  }
+};
+
+/**
+ * LSD radix sort of the range [first, last) using \c scratch as temporary
+ * buffer of the same size. The digit histograms of all passes are counted in
+ * a single scan of the range, passes on digits shared by all elements are
+ * skipped.
+ */
+template <typename T>
+inline void psort__radix_sort_range(T* first, T* last, T* scratch)
+{
+  using traits   = psort__radix_traits<T>;
+  using key_type = typename traits::key_type;
+
+  constexpr std::size_t ndigits = sizeof(key_type) * 8 / psort__radix_bits;
+  constexpr key_type    mask    = psort__radix_nbuckets - 1;
+
+  auto const n = static_cast<std::size_t>(std::distance(first, last));
+
+  if (n < psort__radix_min_elements) {
+    std::stable_sort(first, last, psort__radix_less<T>());
+    return;
+  }
+
+  std::array<std::array<std::size_t, psort__radix_nbuckets>, ndigits>
+      counts{};
+
+  for (auto it = first; it != last; ++it) {
+    auto const key = traits::key(*it);
+    for (std::size_t d = 0; d < ndigits; ++d) {
+      ++counts[d][(key >> (d * psort__radix_bits)) & mask];
+    }
+  }
+
+  auto const first_key = traits::key(*first);
+
+  T* src = first;
+  T* dst = scratch;
+
+  for (std::size_t d = 0; d < ndigits; ++d) {
+    auto const shift = d * psort__radix_bits;
+    auto&      count = counts[d];
+
+    if (count[(first_key >> shift) & mask] == n) {
+      // all elements share this digit
+      continue;
+    }
+
+    // exclusive prefix sum to obtain bucket offsets
+    std::size_t offset = 0;
+    for (auto& c : count) {
+      auto const nbucket = c;
+      c                  = offset;
+      offset += nbucket;
+    }
+
+    for (auto it = src; it != src + n; ++it) {
+      dst[count[(traits::key(*it) >> shift) & mask]++] = *it;
+    }
+
+    std::swap(src, dst);
+  }
+
+  if (src != first) {
+    std::copy(src, src + n, first);
+  }
+}
+
+/**
+ * Radix sort of the local range [first, last) with \c nthreads threads:
+ * Every thread sorts a contiguous chunk of the range in the corresponding
+ * chunk of \c scratch, the sorted chunks are merged in
+ * \c psort__merge_tree.
+ */
+template <typename T>
+inline void psort__local_radix_sort(
+    T* first, T* last, T* scratch, int nthreads = 1)
+{
+  DASH_LOG_TRACE("< psort__local_radix_sort");
+
+  auto const n = static_cast<std::size_t>(std::distance(first, last));
+
+  if (nthreads <= 1 || n < nthreads * psort__min_elements_per_thread) {
+    psort__radix_sort_range(first, last, scratch);
+    DASH_LOG_TRACE("psort__local_radix_sort >");
+    return;
+  }
+
+  std::vector<size_t> chunk_offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    chunk_offsets[t] = (n * t) / nthreads;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    psort__radix_sort_range(
+        first + chunk_offsets[t],
+        first + chunk_offsets[t + 1],
+        scratch + chunk_offsets[t]);
+  }
+
+  psort__merge_tree(first, chunk_offsets, psort__radix_less<T>(), nthreads);
+
+  DASH_LOG_TRACE("psort__local_radix_sort >");
+}
+
+/**
+ * Finds the radix keys of the elements at the given global ranks in the
+ * locally sorted ranges [lbegin, lend) of all units.
+ *
+ * Keys are refined by one digit per round, starting at the most significant
+ * digit in which the global minimum and maximum key differ. Every round
+ * requires a single allreduce of the digit histograms of the buckets
+ * containing the ranks, so the number of rounds is bounded by the number of
+ * digits of the key type.
+ */
+template <typename T>
+inline std::vector<typename psort__radix_traits<T>::key_type>
+psort__radix_find_splitters(
+    T const*                                   lbegin,
+    T const*                                   lend,
+    std::vector<std::size_t> const&            ranks,
+    typename psort__radix_traits<T>::key_type  min_key,
+    typename psort__radix_traits<T>::key_type  max_key,
+    dart_team_t                                teamid)
+{
+  DASH_LOG_TRACE("< psort__radix_find_splitters");
+
+  using traits   = psort__radix_traits<T>;
+  using key_type = typename traits::key_type;
+
+  constexpr std::size_t nbits = sizeof(key_type) * 8;
+  constexpr key_type    mask  = psort__radix_nbuckets - 1;
+
+  auto const nsplitters = ranks.size();
+
+  // Digits above the most significant bit in which minimum and maximum
+  // differ are shared by all keys
+  std::size_t top_bit = 0;
+  for (auto diff = min_key ^ max_key; diff > 1; diff >>= 1) {
+    ++top_bit;
+  }
+  auto const first_shift =
+      (top_bit / psort__radix_bits) * psort__radix_bits;
+  auto const common_prefix =
+      (first_shift + psort__radix_bits >= nbits)
+          ? key_type(0)
+          : static_cast<key_type>(
+                min_key &
+                ~((key_type(1) << (first_shift + psort__radix_bits)) - 1));
+
+  std::vector<key_type>    splitters(nsplitters, common_prefix);
+  // number of elements in buckets preceding the bucket of every splitter
+  std::vector<std::size_t> below(nsplitters, 0);
+  // local range of the bucket of every splitter
+  std::vector<std::size_t> lo(nsplitters, 0);
+  std::vector<std::size_t> hi(
+      nsplitters, static_cast<std::size_t>(std::distance(lbegin, lend)));
+
+  std::vector<std::size_t> l_histo(nsplitters * psort__radix_nbuckets);
+  std::vector<std::size_t> g_histo(nsplitters * psort__radix_nbuckets);
+  std::vector<std::size_t> bucket_pos(
+      nsplitters * (psort__radix_nbuckets + 1));
+
+  for (std::size_t shift = first_shift + psort__radix_bits; shift > 0;) {
+    shift -= psort__radix_bits;
+
+    auto const digit = [shift, mask](T const& value) {
+      return (traits::key(value) >> shift) & mask;
+    };
+
+    for (std::size_t s = 0; s < nsplitters; ++s) {
+      // Elements in the bucket are sorted by the current digit
+      auto* pos = &bucket_pos[s * (psort__radix_nbuckets + 1)];
+      pos[0]    = lo[s];
+      for (std::size_t b = 0; b < psort__radix_nbuckets; ++b) {
+        pos[b + 1] = (pos[b] == hi[s])
+                         ? hi[s]
+                         : std::distance(
+                               lbegin,
+                               std::partition_point(
+                                   lbegin + pos[b],
+                                   lbegin + hi[s],
+                                   [&digit, b](T const& value) {
+                                     return digit(value) <= b;
+                                   }));
+        l_histo[s * psort__radix_nbuckets + b] = pos[b + 1] - pos[b];
+      }
+    }
+
+    DASH_ASSERT_RETURNS(
+        dart_allreduce(
+            l_histo.data(),
+            g_histo.data(),
+            l_histo.size(),
+            dash::dart_datatype<std::size_t>::value,
+            DART_OP_SUM,
+            teamid),
+        DART_OK);
+
+    for (std::size_t s = 0; s < nsplitters; ++s) {
+      auto const* histo = &g_histo[s * psort__radix_nbuckets];
+      auto const* pos   = &bucket_pos[s * (psort__radix_nbuckets + 1)];
+      auto const  rank  = ranks[s] - below[s];
+
+      std::size_t b   = 0;
+      std::size_t acc = 0;
+      while (b < psort__radix_nbuckets - 1 && acc + histo[b] <= rank) {
+        acc += histo[b];
+        ++b;
+      }
+
+      below[s] += acc;
+      splitters[s] |= static_cast<key_type>(b) << shift;
+      lo[s] = pos[b];
+      hi[s] = pos[b + 1];
+    }
+  }
+
+  DASH_LOG_TRACE("psort__radix_find_splitters >");
+  return splitters;
+}
+
+/**
+ * Local positions in the sorted range [lbegin, lend) at which the range is
+ * split for the given splitter keys and global ranks.
+ *
+ * Elements less than a splitter are located before the split, equal
+ * elements are assigned to the left-hand partition in the order of their
+ * units until the number of elements before the split equals the rank.
+ */
+template <typename T>
+inline std::vector<std::size_t> psort__radix_local_splits(
+    T const*                                                lbegin,
+    T const*                                                lend,
+    std::vector<std::size_t> const&                         ranks,
+    std::vector<typename psort__radix_traits<T>::key_type> const& splitters,
+    dash::team_unit_t                                       myid,
+    std::size_t                                             nunits,
+    dart_team_t                                             teamid)
+{
+  using traits = psort__radix_traits<T>;
+
+  auto const nsplitters = ranks.size();
+
+  // number of local elements less than and equal to each splitter
+  std::vector<std::size_t> l_nlt_neq(nsplitters * NLT_NLE_BLOCK);
+  std::vector<std::size_t> l_lower(nsplitters);
+
+  for (std::size_t s = 0; s < nsplitters; ++s) {
+    auto const key   = splitters[s];
+    auto const lower = std::partition_point(
+        lbegin, lend, [key](T const& v) { return traits::key(v) < key; });
+    auto const upper = std::partition_point(
+        lower, lend, [key](T const& v) { return traits::key(v) <= key; });
+    l_lower[s]                       = std::distance(lbegin, lower);
+    l_nlt_neq[s * NLT_NLE_BLOCK]     = l_lower[s];
+    l_nlt_neq[s * NLT_NLE_BLOCK + 1] = std::distance(lower, upper);
+  }
+
+  std::vector<std::size_t> g_nlt_neq(nunits * l_nlt_neq.size());
+
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          l_nlt_neq.data(),
+          g_nlt_neq.data(),
+          l_nlt_neq.size(),
+          dash::dart_datatype<std::size_t>::value,
+          teamid),
+      DART_OK);
+
+  std::vector<std::size_t> splits(nsplitters);
+
+  for (std::size_t s = 0; s < nsplitters; ++s) {
+    std::size_t nlt        = 0;
+    std::size_t neq_before = 0;
+    for (std::size_t u = 0; u < nunits; ++u) {
+      auto const* u_nlt_neq = &g_nlt_neq[u * l_nlt_neq.size()];
+      nlt += u_nlt_neq[s * NLT_NLE_BLOCK];
+      if (u < static_cast<std::size_t>(myid)) {
+        neq_before += u_nlt_neq[s * NLT_NLE_BLOCK + 1];
+      }
+    }
+    // equal elements to assign to the left-hand partition
+    auto const neq_left = ranks[s] - nlt;
+    auto const l_neq    = l_nlt_neq[s * NLT_NLE_BLOCK + 1];
+    auto const l_left =
+        (neq_left <= neq_before)
+            ? 0
+            : std::min(neq_left - neq_before, l_neq);
+
+    splits[s] = l_lower[s] + l_left;
+  }
+
+  return splits;
+}
+
+}  // namespace detail
+
+#endif  // DASH__ALGORITHM__INTERNAL__RADIX_SORT_H__INCLUDED
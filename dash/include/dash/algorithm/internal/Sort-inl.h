@@ -11,18 +11,60 @@
 #define NLT_NLE_BLOCK 2
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <iterator>
 #include <limits>
 #include <numeric>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <dash/Array.h>
 #include <dash/Types.h>
 
+#include <dash/internal/Config.h>
 #include <dash/internal/Logging.h>
 
+#ifdef DASH_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 namespace detail {
 
+// Minimum number of elements per thread in thread-parallel local phases
+constexpr std::size_t psort__min_elements_per_thread = 4096;
+
+// Maximum number of samples per unit to determine splitters in sample sort
+constexpr std::size_t psort__nsamples_per_unit = 64;
+
+/**
+ * Whether \c Compare is a binary predicate on elements of type \c T, as
+ * opposed to a sortable hash.
+ */
+template <typename Compare, typename T, typename = void>
+struct psort__is_comparator : std::false_type {
+};
+
+template <typename Compare, typename T>
+struct psort__is_comparator<
+    Compare,
+    T,
+    decltype(void(std::declval<Compare&>()(
+        std::declval<T const&>(), std::declval<T const&>())))>
+  : std::true_type {
+};
+
+/**
+ * Key and associated value, exchanged as a single record in
+ * \c dash::sort_by_key.
+ */
+template <typename Key, typename Value>
+struct psort__key_value {
+  Key   key;
+  Value value;
+};
+
 struct UnitInfo {
   std::size_t nunits;
   // prefix sum over the number of local elements of all unit
@@ -55,6 +97,8 @@ public:
   // track  only the left unit.
   std::vector<dash::default_index_t> left_partition;
 
+  PartitionBorder() = default;
+
   PartitionBorder(size_t nsplitter, T _lower_bound, T _upper_bound)
     : is_stable(nsplitter, false)
     , is_skipped(nsplitter, false)
@@ -114,7 +158,8 @@ inline const std::vector<std::size_t> psort__local_histogram(
     PartitionBorder<MappedType> const& p_borders,
     Iter                               data_lbegin,
     Iter                               data_lend,
-    SortableHash                       sortable_hash)
+    SortableHash                       sortable_hash,
+    int                                nthreads = 1)
 {
   DASH_LOG_TRACE("< psort__local_histogram");
 
@@ -133,7 +178,15 @@ inline const std::vector<std::size_t> psort__local_histogram(
   using reference = typename std::iterator_traits<Iter>::reference;
 
   if (n_l_elem > 0) {
-    for (auto const& idx : valid_partitions) {
+    auto const nvalid = static_cast<dash::default_index_t>(
+        valid_partitions.size());
+    // Partitions have distinct bounding units on the left-hand side, so
+    // threads write to disjoint histogram entries
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp parallel for num_threads(nthreads) if (nthreads > 1)
+#endif
+    for (dash::default_index_t v = 0; v < nvalid; ++v) {
+      auto const idx = valid_partitions[v];
       // search lower bound of partition value
       auto lb_it = std::lower_bound(
           data_lbegin,
@@ -174,6 +227,23 @@ inline const std::vector<std::size_t> psort__local_histogram(
   return l_nlt_nle;
 }
 
+/**
+ * Whether \c l_invalid holds at any unit of the team. Argument checks of
+ * collective sort operations agree on their result so that either all
+ * units throw or none does.
+ */
+inline bool psort__any_unit(bool l_invalid, dash::Team& team)
+{
+  char l_flag = l_invalid;
+  char g_flag = 0;
+
+  DASH_ASSERT_RETURNS(
+      dart_allreduce(
+          &l_flag, &g_flag, 1, DART_TYPE_BYTE, DART_OP_BOR, team.dart_id()),
+      DART_OK);
+  return g_flag;
+}
+
 template <class InputIt, class OutputIt>
 inline void psort__global_histogram(
     InputIt     local_histo_begin,
@@ -621,6 +691,340 @@ inline void psort__init_partition_borders(
   DASH_LOG_TRACE("psort__init_partition_borders >");
 }
 
+/**
+ * Number of elements in the first sequence among the first \c k elements
+ * of the merged sequences \c a and \c b (co-rank).
+ */
+template <class RandomIt, class Compare>
+inline std::size_t psort__merge_corank(
+    std::size_t k,
+    RandomIt    a,
+    std::size_t na,
+    RandomIt    b,
+    std::size_t nb,
+    Compare     comp)
+{
+  std::size_t lo = (k > nb) ? k - nb : 0;
+  std::size_t hi = std::min(k, na);
+  while (lo < hi) {
+    auto const i = lo + (hi - lo) / 2;
+    auto const j = k - i;
+    if (j > 0 && i < na && !comp(*std::next(b, j - 1), *std::next(a, i))) {
+      // a[i] precedes b[j-1] in the merged sequence
+      lo = i + 1;
+    }
+    else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+/**
+ * Merges the sorted sequences [first, mid) and [mid, last) with \c nthreads
+ * threads. Every thread merges a contiguous range of the result into the
+ * temporary buffer, the ranges are determined by their co-ranks.
+ */
+template <class RandomIt, class Compare>
+inline void psort__parallel_merge(
+    RandomIt                                                      first,
+    RandomIt                                                      mid,
+    RandomIt                                                      last,
+    std::vector<typename std::iterator_traits<RandomIt>::value_type>& buf,
+    Compare                                                       comp,
+    int                                                           nthreads)
+{
+  auto const na = static_cast<std::size_t>(std::distance(first, mid));
+  auto const nb = static_cast<std::size_t>(std::distance(mid, last));
+  auto const n  = na + nb;
+
+  if (nthreads <= 1 || n < nthreads * psort__min_elements_per_thread) {
+    std::inplace_merge(first, mid, last, comp);
+    return;
+  }
+
+  buf.resize(n);
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    auto const k_first = (n * t) / nthreads;
+    auto const k_last  = (n * (t + 1)) / nthreads;
+    auto const i_first =
+        psort__merge_corank(k_first, first, na, mid, nb, comp);
+    auto const i_last  =
+        psort__merge_corank(k_last, first, na, mid, nb, comp);
+    std::merge(
+        std::next(first, i_first),
+        std::next(first, i_last),
+        std::next(mid, k_first - i_first),
+        std::next(mid, k_last - i_last),
+        std::next(std::begin(buf), k_first),
+        comp);
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    auto const k_first = (n * t) / nthreads;
+    auto const k_last  = (n * (t + 1)) / nthreads;
+    std::copy(
+        std::next(std::begin(buf), k_first),
+        std::next(std::begin(buf), k_last),
+        std::next(first, k_first));
+  }
+}
+
+/**
+ * Merges the locally sorted sequences starting at \c first at the given
+ * offsets in a binary tree.
+ * Merges on the same level of the tree are independent and are distributed
+ * among threads. Levels with fewer merges than threads merge every pair of
+ * sequences with all threads instead.
+ */
+template <class RandomIt, class Compare>
+inline void psort__merge_tree(
+    RandomIt                   first,
+    std::vector<size_t> const& seq_offsets,
+    Compare                    comp,
+    int                        nthreads = 1)
+{
+  DASH_LOG_TRACE("< psort__merge_tree");
+
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+  if (seq_offsets.size() < 3) {
+    // nothing to merge
+    return;
+  }
+
+  // merging sorted sequences
+  auto nsequences = seq_offsets.size() - 1;
+  // number of merge steps in the tree
+  auto const depth = static_cast<size_t>(std::ceil(std::log2(nsequences)));
+  // temporary buffer for thread-parallel merges
+  std::vector<value_type> buf;
+
+  for (std::size_t d = 0; d < depth; ++d) {
+    // distance between first and mid iterator while merging
+    auto const step = std::size_t(0x1) << d;
+    // distance between first and last iterator while merging
+    auto const dist = step << 1;
+    // number of merges
+    auto const nmerges = static_cast<dash::default_index_t>(nsequences >> 1);
+
+    auto const merge_range = [&](dash::default_index_t m, int mthreads) {
+      auto mfirst = std::next(first, seq_offsets[m * dist]);
+      auto mid    = std::next(first, seq_offsets[m * dist + step]);
+      // sometimes we have a lonely merge in the end, so we have to guarantee
+      // that we do not access out of bounds
+      auto mlast = std::next(
+          first,
+          seq_offsets[std::min(m * dist + dist, seq_offsets.size() - 1)]);
+
+      if (mthreads > 1) {
+        psort__parallel_merge(mfirst, mid, mlast, buf, comp, mthreads);
+      }
+      else {
+        std::inplace_merge(mfirst, mid, mlast, comp);
+      }
+    };
+
+    if (nthreads > 1 && nmerges < nthreads) {
+      for (dash::default_index_t m = 0; m < nmerges; ++m) {
+        merge_range(m, nthreads);
+      }
+    }
+    else {
+      // These merges are independent from each other
+#ifdef DASH_ENABLE_OPENMP
+      #pragma omp parallel for num_threads(nthreads) if (nthreads > 1)
+#endif
+      for (dash::default_index_t m = 0; m < nmerges; ++m) {
+        merge_range(m, 1);
+      }
+    }
+
+    nsequences -= nmerges;
+  }
+
+  DASH_LOG_TRACE("psort__merge_tree >");
+}
+
+/**
+ * Sorts the local range [first, last) with \c nthreads threads: Every
+ * thread sorts a contiguous chunk of the range, the sorted chunks are
+ * merged in \c psort__merge_tree.
+ * Chunks are sorted with \c std::stable_sort if \c stable is set, the
+ * merges preserve the order of equivalent elements.
+ */
+template <class RandomIt, class Compare>
+inline void psort__local_sort(
+    RandomIt first,
+    RandomIt last,
+    Compare  comp,
+    int      nthreads = 1,
+    bool     stable   = false)
+{
+  DASH_LOG_TRACE("< psort__local_sort");
+
+  auto const n = static_cast<std::size_t>(std::distance(first, last));
+
+  auto const sort_range = [&comp, stable](RandomIt sfirst, RandomIt slast) {
+    if (stable) {
+      std::stable_sort(sfirst, slast, comp);
+    }
+    else {
+      std::sort(sfirst, slast, comp);
+    }
+  };
+
+  if (nthreads <= 1 || n < nthreads * psort__min_elements_per_thread) {
+    sort_range(first, last);
+    DASH_LOG_TRACE("psort__local_sort >");
+    return;
+  }
+
+  std::vector<size_t> chunk_offsets(nthreads + 1);
+  for (int t = 0; t <= nthreads; ++t) {
+    chunk_offsets[t] = (n * t) / nthreads;
+  }
+
+#ifdef DASH_ENABLE_OPENMP
+  #pragma omp parallel for num_threads(nthreads)
+#endif
+  for (int t = 0; t < nthreads; ++t) {
+    sort_range(
+        std::next(first, chunk_offsets[t]),
+        std::next(first, chunk_offsets[t + 1]));
+  }
+
+  psort__merge_tree(first, chunk_offsets, comp, nthreads);
+
+  DASH_LOG_TRACE("psort__local_sort >");
+}
+
+/**
+ * Determines splitters for a sample sort of the locally sorted range
+ * [lbegin, lend) such that the number of elements less than or equal to
+ * splitter \c k approximates the number of elements in the sort range
+ * located at units before unit \c k+1.
+ *
+ * Every unit selects up to \c psort__nsamples_per_unit equidistant samples
+ * from its local range. Samples are weighted by the number of local elements
+ * they represent, so units with different local sizes are sampled evenly.
+ */
+template <class RandomIt, class Compare>
+inline std::vector<typename std::iterator_traits<RandomIt>::value_type>
+psort__sample_splitters(
+    RandomIt                   lbegin,
+    RandomIt                   lend,
+    Compare                    comp,
+    std::vector<size_t> const& acc_partition_count,
+    dart_team_t                teamid)
+{
+  DASH_LOG_TRACE("< psort__sample_splitters");
+
+  using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+  auto const nunits   = acc_partition_count.size() - 1;
+  auto const n_l_elem = static_cast<std::size_t>(std::distance(lbegin, lend));
+  auto const nsamples = std::min(n_l_elem, psort__nsamples_per_unit);
+
+  std::vector<value_type> l_samples;
+  l_samples.reserve(nsamples);
+  for (std::size_t s = 0; s < nsamples; ++s) {
+    // center of the s-th of nsamples equally sized segments
+    l_samples.push_back(
+        *std::next(lbegin, ((2 * s + 1) * n_l_elem) / (2 * nsamples)));
+  }
+
+  // Exchange number of samples and local elements of all units
+  std::size_t         l_sample_info[2] = {nsamples, n_l_elem};
+  std::vector<size_t> sample_info(2 * nunits);
+
+  DASH_ASSERT_RETURNS(
+      dart_allgather(
+          l_sample_info,
+          sample_info.data(),
+          2,
+          dash::dart_datatype<size_t>::value,
+          teamid),
+      DART_OK);
+
+  std::vector<size_t> recv_count(nunits);
+  std::vector<size_t> recv_displs(nunits, 0);
+  for (std::size_t u = 0; u < nunits; ++u) {
+    recv_count[u] = sample_info[2 * u] * sizeof(value_type);
+    if (u > 0) {
+      recv_displs[u] = recv_displs[u - 1] + recv_count[u - 1];
+    }
+  }
+
+  auto const nsamples_total =
+      (recv_displs[nunits - 1] + recv_count[nunits - 1]) / sizeof(value_type);
+
+  std::vector<value_type> samples(nsamples_total);
+  std::vector<double>     weights;
+  weights.reserve(nsamples_total);
+
+  DASH_ASSERT_RETURNS(
+      dart_allgatherv(
+          l_samples.data(),
+          nsamples * sizeof(value_type),
+          DART_TYPE_BYTE,
+          samples.data(),
+          recv_count.data(),
+          recv_displs.data(),
+          teamid),
+      DART_OK);
+
+  for (std::size_t u = 0; u < nunits; ++u) {
+    auto const nsamples_u = sample_info[2 * u];
+    auto const n_elem_u   = sample_info[2 * u + 1];
+    std::fill_n(
+        std::back_inserter(weights),
+        nsamples_u,
+        static_cast<double>(n_elem_u) / nsamples_u);
+  }
+
+  // All units sort the same samples and obtain identical splitters
+  std::vector<size_t> sample_order(nsamples_total);
+  std::iota(sample_order.begin(), sample_order.end(), 0);
+  std::sort(
+      sample_order.begin(),
+      sample_order.end(),
+      [&samples, &comp](size_t a, size_t b) {
+        return comp(samples[a], samples[b]);
+      });
+
+  std::vector<value_type> splitters;
+  if (nsamples_total == 0) {
+    DASH_LOG_TRACE("psort__sample_splitters >", "no samples");
+    return splitters;
+  }
+  splitters.reserve(nunits - 1);
+
+  double      acc_weight = 0;
+  std::size_t s          = 0;
+  for (std::size_t k = 1; k < nunits; ++k) {
+    auto const target = static_cast<double>(acc_partition_count[k]);
+    while (s < nsamples_total &&
+           acc_weight + weights[sample_order[s]] <= target) {
+      acc_weight += weights[sample_order[s]];
+      ++s;
+    }
+    // Partitions only have to be approximately balanced as elements are
+    // finally copied to their target position:
+    splitters.push_back(samples[sample_order[std::max<size_t>(s, 1) - 1]]);
+  }
+
+  DASH_LOG_TRACE("psort__sample_splitters >");
+  return splitters;
+}
+
 template <class Iter, class SortableHash>
 inline auto find_global_min_max(
     Iter lbegin, Iter lend, dart_team_t teamid, SortableHash sortable_hash)
@@ -4,6 +4,7 @@
 #include <dash/Team.h>
 #include <dash/GlobPtr.h>
 #include <dash/Atomic.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/MemorySpace.h>
 
@@ -38,6 +39,26 @@ public:
     DASH_LOG_DEBUG("event posted");
   }
 
+  /**
+   * copy \c nelem values from \c src to \c dest and post an event to this
+   * unit once the values are visible. After waiting for the event, the
+   * unit can read the values without further synchronization.
+   * This function is thread-safe
+   */
+  template <typename T, typename GlobPtrT>
+  inline void post(
+    const GlobPtrT & dest,
+    const T        * src,
+    size_t           nelem) const {
+    DASH_LOG_DEBUG("post event with data to gptr", _gptr);
+    dash::internal::put_notify(dest.dart_gptr(), src, nelem,
+                               _gptr.dart_gptr(), 1);
+    DASH_ASSERT_RETURNS(
+      dart_flush(_gptr.dart_gptr()),
+      DART_OK);
+    DASH_LOG_DEBUG("event posted");
+  }
+
   /**
    * returns the number of arrived events at this unit
    */
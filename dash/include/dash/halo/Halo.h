@@ -6,7 +6,12 @@
 #include <dash/internal/Logging.h>
 #include <dash/util/FunctionalExpr.h>
 
+#include <array>
 #include <functional>
+#include <set>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace dash {
 
@@ -300,6 +305,104 @@ std::ostream& operator<<(
   return os;
 }
 
+/**
+ * Stencil point with relative coordinates specified as template parameters
+ * e.g. StaticStencilPoint<-1,0> -> north
+ */
+template <int16_t... Values>
+struct StaticStencilPoint {
+  using point_value_t = int16_t;
+
+  /**
+   * Returns the number of dimensions
+   */
+  static constexpr dim_t ndim() { return sizeof...(Values); }
+
+  /**
+   * Returns the distance to the center in the given dimension
+   */
+  static constexpr point_value_t value(dim_t dim) {
+    const point_value_t values[] = { Values... };
+    return values[dim];
+  }
+
+  /**
+   * Returns the stencil point as \ref StencilPoint
+   */
+  template <typename StencilPointT>
+  static StencilPointT stencil_point() {
+    return StencilPointT(Values...);
+  }
+};  // StaticStencilPoint
+
+/**
+ * \ref StencilSpec with all stencil points known at compile time, specified
+ * as \ref StaticStencilPoint template parameters.
+ * e.g. StaticStencilSpec<StaticStencilPoint<-1,0>, StaticStencilPoint<1,0>>
+ * -> north and south
+ *
+ * Can be used wherever a \ref StencilSpec is expected, the stencil point
+ * coordinates are additionally available as constant expressions.
+ */
+template <typename... StaticStencilPointsT>
+class StaticStencilSpec
+: public StencilSpec<
+    StencilPoint<std::tuple_element<
+      0, std::tuple<StaticStencilPointsT...>>::type::ndim()>,
+    sizeof...(StaticStencilPointsT)> {
+private:
+  static constexpr auto NumDimensions = std::tuple_element<
+    0, std::tuple<StaticStencilPointsT...>>::type::ndim();
+  static constexpr auto NumStencilPoints = sizeof...(StaticStencilPointsT);
+
+  using Base_t = StencilSpec<StencilPoint<NumDimensions>, NumStencilPoints>;
+
+public:
+  using StencilPoint_t  = typename Base_t::StencilPoint_t;
+  using point_value_t   = typename Base_t::point_value_t;
+  using stencil_index_t = typename Base_t::stencil_index_t;
+
+public:
+  /**
+   * Default Constructor
+   */
+  StaticStencilSpec()
+  : Base_t(
+      StaticStencilPointsT::template stencil_point<StencilPoint_t>()...) {
+    static_assert(same_ndim(),
+                  "All stencil points must have the same number of dimensions");
+  }
+
+  /**
+   * Returns the distance to the center of the stencil point with the given
+   * index in the given dimension
+   */
+  static constexpr point_value_t point_value(stencil_index_t index,
+                                             dim_t           dim) {
+    const point_value_t values[] = { StaticStencilPointsT::value(dim)... };
+    return values[index];
+  }
+
+private:
+  static constexpr bool same_ndim() {
+    bool same = true;
+    for(auto ndim : { StaticStencilPointsT::ndim()... })
+      same = same && ndim == NumDimensions;
+
+    return same;
+  }
+};  // StaticStencilSpec
+
+/**
+ * Whether the stencil spec type is a \ref StaticStencilSpec
+ */
+template <typename StencilSpecT>
+struct is_static_stencil_spec : std::false_type {};
+
+template <typename... StaticStencilPointsT>
+struct is_static_stencil_spec<StaticStencilSpec<StaticStencilPointsT...>>
+: std::true_type {};
+
 /**
  * Global boundary Halo properties
  */
@@ -657,6 +760,28 @@ std::ostream& operator<<(std::ostream&                    os,
   return os;
 }
 
+/**
+ * Number of consecutive stencil applications that halo regions have to
+ * provide elements for. Halos for \c k steps (deep halos) are \c k times
+ * as wide as the stencil and allow to advance a stencil operation by
+ * \c k steps between two halo updates.
+ */
+class HaloDepth {
+public:
+  using depth_t = uint16_t;
+
+public:
+  constexpr explicit HaloDepth(depth_t num_steps) : _num_steps(num_steps) {}
+
+  /**
+   * Number of stencil applications covered by the halo regions
+   */
+  constexpr depth_t num_steps() const { return _num_steps; }
+
+private:
+  depth_t _num_steps;
+};  // HaloDepth
+
 /**
  * Contains all specified Halo regions. HaloSpec can be build with
  * \ref StencilSpec.
@@ -688,6 +813,18 @@ public:
     read_stencil_points(stencil_spec);
   }
 
+  /**
+   * Constructor for deep halos providing the elements for
+   * \c depth.num_steps() consecutive applications of the given stencils.
+   */
+  template <typename... StencilSpecT>
+  HaloSpec(const HaloDepth& depth, const StencilSpecT&... stencil_specs) {
+    DASH_ASSERT_MSG(depth.num_steps() > 0, "Halo depth must be positive");
+    using expand = int[];
+    (void) expand{ 0, (read_stencil_points(stencil_specs, depth.num_steps()),
+                       0)... };
+  }
+
   template <typename... ARGS>
   HaloSpec(const RegionSpec_t& region_spec, const ARGS&... args) {
     std::array<RegionSpec_t, sizeof...(ARGS) + 1> tmp{ region_spec, args... };
@@ -731,13 +868,55 @@ private:
   template <typename StencilSpecT>
   void read_stencil_points(const StencilSpecT& stencil_spec) {
     for(const auto& stencil : stencil_spec.specs()) {
-      auto stencil_combination = stencil;
+      read_stencil_point(stencil);
+    }
+  }
 
-      set_region_spec(stencil_combination);
-      while(next_region(stencil, stencil_combination)) {
-        set_region_spec(stencil_combination);
+  /*
+   * Reads all points reachable by the given number of consecutive
+   * applications of the stencil and sets the region specification.
+   */
+  template <typename StencilSpecT>
+  void read_stencil_points(const StencilSpecT&  stencil_spec,
+                           HaloDepth::depth_t   num_steps) {
+    using StencilPoint_t = typename StencilSpecT::StencilPoint_t;
+    using Point_t        = std::array<typename StencilPoint_t::point_value_t,
+                                      NumDimensions>;
+
+    std::set<Point_t> reachable{ Point_t{} };
+    for(HaloDepth::depth_t step = 0; step < num_steps; ++step) {
+      const auto points = reachable;
+      for(const auto& point : points) {
+        for(const auto& stencil : stencil_spec.specs()) {
+          auto next = point;
+          for(dim_t d = 0; d < NumDimensions; ++d)
+            next[d] += stencil[d];
+          reachable.insert(next);
+        }
       }
     }
+
+    for(const auto& point : reachable) {
+      StencilPoint_t stencil;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        stencil[d] = point[d];
+      if(stencil.max() > 0)
+        read_stencil_point(stencil);
+    }
+  }
+
+  /*
+   * Sets the region specification for all regions required by a stencil
+   * point.
+   */
+  template <typename StencilPointT>
+  void read_stencil_point(const StencilPointT& stencil) {
+    auto stencil_combination = stencil;
+
+    set_region_spec(stencil_combination);
+    while(next_region(stencil, stencil_combination)) {
+      set_region_spec(stencil_combination);
+    }
   }
 
   /*
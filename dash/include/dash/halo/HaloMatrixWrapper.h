@@ -4,9 +4,11 @@
 #include <dash/dart/if/dart.h>
 
 #include <dash/Matrix.h>
+#include <dash/Onesided.h>
 #include <dash/Pattern.h>
 #include <dash/halo/StencilOperator.h>
 
+#include <algorithm>
 #include <type_traits>
 #include <vector>
 
@@ -43,6 +45,16 @@ namespace halo {
  *           |    `-------------------------'    '- halo width in dimension 1
  *           '                  \
  *     halo region 3             '- halo region 7
+ *
+ * Halo updates of all regions (\ref update, \ref update_async) are
+ * push-based: every unit packs the boundary elements required by each
+ * neighbor into a contiguous buffer and writes them to the neighbor's halo
+ * memory, followed by a single notification per neighbor. The writes of
+ * all regions are issued without waiting for completion, \ref wait
+ * completes them with a single flush per neighbor before notifying the
+ * neighbors. The exchange plan is set up once in the constructor. Updates of single regions
+ * (\ref update_at, \ref update_async_at) read the halo elements from the
+ * neighbor instead.
  */
 
 template <typename MatrixT>
@@ -75,7 +87,8 @@ private:
 public:
   /**
    * Constructor that takes \ref Matrix, a \ref GlobalBoundarySpec and a user
-   * defined number of stencil specifications (\ref StencilSpec)
+   * defined number of stencil specifications (\ref StencilSpec).
+   * Collective operation, sets up the exchange plan for halo updates.
    */
   template <typename... StencilSpecT>
   HaloMatrixWrapper(MatrixT& matrix, const GlobBoundSpec_t& cycle_spec,
@@ -235,6 +248,8 @@ public:
         num_elems_block = region.view().extent(0);
       }
     }
+
+    init_push_plans();
   }
 
   /**
@@ -248,11 +263,22 @@ public:
 
   HaloMatrixWrapper() = delete;
 
+  HaloMatrixWrapper(const HaloMatrixWrapper& other) = delete;
+  HaloMatrixWrapper& operator=(const HaloMatrixWrapper& other) = delete;
+
   ~HaloMatrixWrapper() {
     for(auto& dart_type : _dart_types) {
       dart_type_destroy(&dart_type);
     }
     _dart_types.clear();
+
+    for(auto& handle : _push_handles) {
+      dart_handle_free(&handle);
+    }
+    auto gptr_halo   = _push_halo_gptr;
+    gptr_halo.unitid = _matrix.team().myid().id;
+    dart_team_memderegister(gptr_halo);
+    dart_team_memfree(_push_flag_gptr);
   }
 
   /**
@@ -262,11 +288,14 @@ public:
 
   /**
    * Initiates a blocking halo region update for all halo elements.
+   *
+   * Collective operation, the boundary elements of the calling unit are
+   * written to the halo regions of its neighbors. Units have to be
+   * synchronized before the update, so that neighbors have finished
+   * writing their boundary elements and reading their halo elements.
    */
   void update() {
-    for(auto& region : _region_data) {
-      update_halo_intern(region.second);
-    }
+    push_halos();
     wait();
   }
 
@@ -284,11 +313,14 @@ public:
 
   /**
    * Initiates an asychronous halo region update for all halo elements.
+   *
+   * Collective operation with the same requirements as \ref update.
+   * Returns after the writes of the boundary elements to all neighbors
+   * were issued, \ref wait completes them and the update of the local
+   * halo elements. The boundary elements must not be modified before.
    */
   void update_async() {
-    for(auto& region : _region_data) {
-      update_halo_intern(region.second);
-    }
+    push_halos();
   }
 
   /**
@@ -310,6 +342,7 @@ public:
     for(auto& region : _region_data) {
       dart_wait_local(&region.second.handle);
     }
+    wait_push();
   }
 
   /**
@@ -320,6 +353,7 @@ public:
     auto it_find = _region_data.find(index);
     if(it_find != _region_data.end())
       dart_wait_local(&it_find->second.handle);
+    wait_push();
   }
 
   /**
@@ -453,6 +487,35 @@ private:
     dart_handle_t                       handle{};
   };
 
+  /*
+   * Contiguous range of elements in the local block
+   */
+  struct ElementRun {
+    pattern_size_t offset;
+    pattern_size_t length;
+  };
+
+  /*
+   * Halo region of a neighbor filled with elements of the local block
+   */
+  struct PushRegion {
+    /// offset of the region in the halo memory of the neighbor
+    pattern_size_t halo_offset;
+    /// offset of the packed region elements in the push buffer
+    pattern_size_t buffer_offset;
+    pattern_size_t size;
+  };
+
+  /*
+   * All halo regions of a neighbor filled with elements of the local block,
+   * the elements are packed in order of the runs.
+   */
+  struct PushPlan {
+    team_unit_t             unit;
+    std::vector<ElementRun> runs;
+    std::vector<PushRegion> regions;
+  };
+
   void update_halo_intern(Data& data) {
     if(data.region.is_custom_region())
       return;
@@ -460,6 +523,215 @@ private:
     data.get_halos(data.handle);
   }
 
+  /*
+   * Sets up the persistent push plans. Every unit sends the element runs
+   * of its halo regions to the units owning them, and registers its halo
+   * memory as target of the pushed elements.
+   */
+  void init_push_plans() {
+    auto& team      = _matrix.team();
+    auto  team_size = team.size();
+    auto  myid      = team.myid();
+
+    // requests for every unit:
+    // (halo offset, region size, number of runs, (offset, length)...)...
+    std::vector<std::vector<size_t>> requests(team_size);
+    for(const auto& region : _haloblock.halo_regions()) {
+      if(region.size() == 0 || region.is_custom_region())
+        continue;
+
+      auto  it       = region.begin();
+      auto  it_end   = region.end();
+      auto  unit     = it.lpos().unit;
+      auto& request  = requests[unit.id];
+      request.push_back(std::distance(
+        _halomemory.begin(), _halomemory.first_element_at(region.index())));
+      request.push_back(region.size());
+      auto runs_pos = request.size();
+      request.push_back(0);
+      for(; it != it_end; ++it) {
+        auto lpos = it.lpos();
+        DASH_ASSERT_MSG(lpos.unit == unit,
+                        "Halo region spans the blocks of multiple units");
+        size_t index = lpos.index;
+        if(request[runs_pos] > 0
+           && request[request.size() - 2] + request.back() == index) {
+          ++request.back();
+          continue;
+        }
+        request.push_back(index);
+        request.push_back(1);
+        ++request[runs_pos];
+      }
+    }
+
+    std::vector<size_t> send_counts(team_size);
+    std::vector<size_t> send_displs(team_size);
+    std::vector<size_t> send_data;
+    for(size_t u = 0; u < team_size; ++u) {
+      send_counts[u] = requests[u].size();
+      send_displs[u] = send_data.size();
+      send_data.insert(send_data.end(), requests[u].begin(),
+                       requests[u].end());
+    }
+    std::vector<size_t> recv_counts(team_size);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(send_counts.data(), recv_counts.data(), 1,
+                    DART_TYPE_SIZET, team.dart_id()),
+      DART_OK);
+    std::vector<size_t> recv_displs(team_size);
+    size_t              recv_size = 0;
+    for(size_t u = 0; u < team_size; ++u) {
+      recv_displs[u] = recv_size;
+      recv_size += recv_counts[u];
+    }
+    std::vector<size_t> recv_data(recv_size);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(send_data.data(), send_counts.data(),
+                     send_displs.data(), DART_TYPE_SIZET, recv_data.data(),
+                     recv_counts.data(), recv_displs.data(), team.dart_id()),
+      DART_OK);
+
+    pattern_size_t buffer_size = 0;
+    for(size_t u = 0; u < team_size; ++u) {
+      if(recv_counts[u] == 0)
+        continue;
+
+      PushPlan plan;
+      plan.unit = team_unit_t(u);
+      auto pos  = recv_displs[u];
+      auto end  = pos + recv_counts[u];
+      while(pos < end) {
+        PushRegion region;
+        region.halo_offset   = recv_data[pos++];
+        region.size          = recv_data[pos++];
+        region.buffer_offset = buffer_size;
+        buffer_size += region.size;
+        plan.regions.push_back(region);
+        auto num_runs = recv_data[pos++];
+        for(size_t r = 0; r < num_runs; ++r, pos += 2) {
+          plan.runs.push_back(ElementRun{ recv_data[pos], recv_data[pos + 1] });
+        }
+      }
+      _push_plans.push_back(std::move(plan));
+    }
+    _push_buffer.resize(buffer_size);
+
+    for(size_t u = 0; u < team_size; ++u) {
+      if(u != static_cast<size_t>(myid.id) && !requests[u].empty())
+        ++_push_num_senders;
+    }
+
+    auto* halo_mem =
+      (_haloblock.halo_size() > 0) ? &*(_halomemory.begin()) : nullptr;
+    DASH_ASSERT_RETURNS(
+      dart_team_memregister(team.dart_id(),
+                            _haloblock.halo_size() * sizeof(Element_t),
+                            DART_TYPE_BYTE, halo_mem, &_push_halo_gptr),
+      DART_OK);
+    DASH_ASSERT_RETURNS(
+      dart_team_memalloc_aligned(team.dart_id(), 1, DART_TYPE_INT,
+                                 &_push_flag_gptr),
+      DART_OK);
+    auto  gptr_flag   = _push_flag_gptr;
+    int*  flag        = nullptr;
+    gptr_flag.unitid  = myid.id;
+    DASH_ASSERT_RETURNS(dart_gptr_getaddr(gptr_flag, (void**) &flag),
+                        DART_OK);
+    *flag = 0;
+    team.barrier();
+
+    DASH_LOG_DEBUG("HaloMatrixWrapper.init_push_plans()",
+                   "neighbors:", _push_plans.size(),
+                   "senders:", _push_num_senders,
+                   "buffer size:", buffer_size);
+  }
+
+  /*
+   * Packs the boundary elements and issues their writes to the halo memory
+   * of all neighbors, the last write to every neighbor notifies it on
+   * completion in \ref wait_push.
+   */
+  void push_halos() {
+    DASH_ASSERT_MSG(!_push_pending,
+                    "Halo update initiated before the previous one finished");
+
+    const auto* local  = _matrix.lbegin();
+    auto*       packed = _push_buffer.data();
+    for(const auto& plan : _push_plans) {
+      for(const auto& run : plan.runs) {
+        packed = std::copy(local + run.offset,
+                           local + run.offset + run.length, packed);
+      }
+    }
+
+    auto myid = _matrix.team().myid();
+    for(const auto& plan : _push_plans) {
+      if(plan.unit == myid) {
+        auto halo_begin = _halomemory.begin();
+        for(const auto& region : plan.regions) {
+          auto* src = _push_buffer.data() + region.buffer_offset;
+          std::copy(src, src + region.size, halo_begin + region.halo_offset);
+        }
+        continue;
+      }
+
+      auto gptr_flag   = _push_flag_gptr;
+      gptr_flag.unitid = plan.unit.id;
+      auto num_regions = plan.regions.size();
+      for(size_t r = 0; r < num_regions; ++r) {
+        const auto& region = plan.regions[r];
+        auto        gptr   = _push_halo_gptr;
+        gptr.unitid        = plan.unit.id;
+        dart_gptr_incaddr(&gptr, region.halo_offset * sizeof(Element_t));
+        auto* src = _push_buffer.data() + region.buffer_offset;
+        dart_handle_t handle;
+        if(r + 1 < num_regions)
+          dash::internal::put_handle(gptr, src, region.size, &handle);
+        else
+          dash::internal::put_notify_handle(gptr, src, region.size,
+                                            gptr_flag, 1, &handle);
+        if(handle != DART_HANDLE_NULL)
+          _push_handles.push_back(handle);
+      }
+    }
+    _push_pending = true;
+  }
+
+  /*
+   * Completes the writes to all neighbors with a single flush per neighbor
+   * followed by their notification, and waits for the notifications of
+   * all neighbors pushing halo elements. The notifications of this update
+   * are subtracted from the counter again, notifications of the next update
+   * that arrived in the meantime are kept.
+   */
+  void wait_push() {
+    if(!_push_pending)
+      return;
+
+    DASH_ASSERT_RETURNS(
+      dart_waitall(_push_handles.data(), _push_handles.size()), DART_OK);
+    _push_handles.clear();
+
+    if(_push_num_senders > 0) {
+      int flag         = 0;
+      auto gptr_flag   = _push_flag_gptr;
+      gptr_flag.unitid = _matrix.team().myid().id;
+      while(flag < _push_num_senders) {
+        DASH_ASSERT_RETURNS(dart_fetch_and_op(gptr_flag, nullptr, &flag,
+                                              DART_TYPE_INT, DART_OP_NO_OP),
+                            DART_OK);
+        DASH_ASSERT_RETURNS(dart_flush(gptr_flag), DART_OK);
+      }
+      int consumed = -_push_num_senders;
+      DASH_ASSERT_RETURNS(dart_fetch_and_op(gptr_flag, &consumed, &flag,
+                                            DART_TYPE_INT, DART_OP_SUM),
+                          DART_OK);
+      DASH_ASSERT_RETURNS(dart_flush(gptr_flag), DART_OK);
+    }
+    _push_pending = false;
+  }
+
   Element_t* halo_element_at(ElementCoords_t& coords) {
     auto        index     = _haloblock.index_at(_view_local, coords);
     const auto& spec      = _halo_spec.spec(index);
@@ -483,6 +755,13 @@ private:
   HaloMemory_t                   _halomemory;
   std::map<region_index_t, Data> _region_data;
   std::vector<dart_datatype_t>   _dart_types;
+  std::vector<PushPlan>          _push_plans;
+  std::vector<Element_t>         _push_buffer;
+  std::vector<dart_handle_t>     _push_handles;
+  dart_gptr_t                    _push_halo_gptr = DART_GPTR_NULL;
+  dart_gptr_t                    _push_flag_gptr = DART_GPTR_NULL;
+  int                            _push_num_senders = 0;
+  bool                           _push_pending     = false;
 };
 
 }  // namespace halo
@@ -3,6 +3,16 @@
 
 #include <dash/halo/iterator/StencilIterator.h>
 
+#include <algorithm>
+#include <array>
+#include <utility>
+#include <vector>
+
+#ifdef DASH_ENABLE_OPENMP
+#include <dash/util/UnitLocality.h>
+#include <omp.h>
+#endif
+
 namespace dash {
 
 namespace halo {
@@ -32,6 +42,9 @@ private:
 
   using StencilOperator_t = StencilOperator<ElementT, PatternT, GlobMemT, StencilSpecT>;
   using pattern_size_t    = typename StencilOperator_t::pattern_size_t;
+  using signed_pattern_size_t =
+    typename StencilOperator_t::signed_pattern_size_t;
+  using SignedCoords_t    = typename StencilOperator_t::SignedCoords_t;
 
 public:
   using ViewSpec_t      = typename StencilOperator_t::ViewSpec_t;
@@ -212,7 +225,162 @@ public:
     }
   }
 
+  /**
+   * Updates all inner elements using a user-defined stencil operation on
+   * element values, without stencil iterators.
+   *
+   * The inner view is split into tiles of the given extents (spatial cache
+   * blocking), tiles are distributed among all threads available to the
+   * unit if DASH is built with OpenMP support. Within a tile, the operation
+   * is applied row by row along the fastest dimension in memory with
+   * loop-invariant pointers for all stencil points, so the row loops can
+   * be vectorized.
+   *
+   * For a \ref StaticStencilSpec, the stencil point offsets are derived
+   * from the compile-time coordinates, points along the fastest dimension
+   * are accessed at constant offsets from the center.
+   *
+   * The operation is called with the value of the center and the values
+   * of all stencil points in order of the \ref StencilSpec and has to
+   * return the new value, e.g. for a 5-point stencil:
+   *
+   * \code
+   *   stencil_op.inner.update_tiled(dst, [](double c, double n, double w,
+   *                                         double e, double s) {
+   *     return 0.2 * (c + n + w + e + s);
+   *   });
+   * \endcode
+   *
+   * \param begin_dst    Pointer to the beginning of the destination memory,
+   *                     must not overlap the local memory
+   * \param operation    User-defined operation for updating all inner
+   *                     elements
+   * \param tile_extents Extents of the tiles, the extent of the inner view
+   *                     is used for dimensions with extent 0 (default)
+   */
+  template <typename Op>
+  void update_tiled(ElementT* begin_dst, Op operation,
+                    const ElementCoords_t& tile_extents = ElementCoords_t{}) {
+    constexpr dim_t fd = StencilOperator_t::FastestDim;
+
+    const auto&           view_inner = view();
+    SignedCoords_t        begin;
+    SignedCoords_t        end;
+    SignedCoords_t        tile;
+    SignedCoords_t        num_tiles_dim;
+    SignedCoords_t        ext_local;
+    signed_pattern_size_t num_tiles = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      signed_pattern_size_t extent = view_inner.extent(d);
+      if(extent == 0)
+        return;
+
+      begin[d]         = view_inner.offset(d);
+      end[d]           = begin[d] + extent;
+      tile[d]          = (tile_extents[d] > 0)
+                           ? std::min<signed_pattern_size_t>(tile_extents[d],
+                                                             extent)
+                           : extent;
+      num_tiles_dim[d] = (extent + tile[d] - 1) / tile[d];
+      num_tiles       *= num_tiles_dim[d];
+      ext_local[d]     = _stencil_op->_view_local->extent(d);
+    }
+
+    const auto  dim_offs     = StencilOperator_t::dimension_offsets(ext_local);
+    const auto& stencil_offs = _stencil_op->_stencil_offsets;
+    const auto* src          = _stencil_op->_local_memory;
+
+    auto update_tile = [&](signed_pattern_size_t tile_index) {
+      SignedCoords_t tile_begin;
+      SignedCoords_t tile_end;
+      for(dim_t d = NumDimensions; d-- > 0;) {
+        tile_begin[d] = begin[d] + (tile_index % num_tiles_dim[d]) * tile[d];
+        tile_end[d]   = std::min(tile_begin[d] + tile[d], end[d]);
+        tile_index /= num_tiles_dim[d];
+      }
+      auto row_length = tile_end[fd] - tile_begin[fd];
+      StencilOperator_t::for_each_row(
+        tile_begin, tile_end, [&](const SignedCoords_t& coords) {
+          signed_pattern_size_t offset = 0;
+          for(dim_t d = 0; d < NumDimensions; ++d)
+            offset += coords[d] * dim_offs[d];
+          update_row(src + offset, begin_dst + offset, stencil_offs,
+                     dim_offs, row_length, operation,
+                     std::make_index_sequence<NumStencilPoints>(),
+                     is_static_stencil_spec<StencilSpecT>());
+        });
+    };
+
+#ifdef DASH_ENABLE_OPENMP
+    dash::util::UnitLocality uloc;
+    auto n_threads = uloc.num_domain_threads();
+    if(n_threads > 1 && num_tiles > 1) {
+      #pragma omp parallel for num_threads(n_threads) schedule(static)
+      for(signed_pattern_size_t t = 0; t < num_tiles; ++t)
+        update_tile(t);
+
+      return;
+    }
+#endif
+    for(signed_pattern_size_t t = 0; t < num_tiles; ++t)
+      update_tile(t);
+  }
+
 private:
+  template <typename Op, std::size_t... Is>
+  static void update_row(const ElementT* center, ElementT* center_dst,
+                         const StencilOffsets_t& stencil_offs,
+                         const SignedCoords_t&, signed_pattern_size_t length,
+                         Op& operation, std::index_sequence<Is...>,
+                         std::false_type) {
+    const ElementT* const points[] = { (center + stencil_offs[Is])... };
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp simd
+#endif
+    for(signed_pattern_size_t i = 0; i < length; ++i) {
+      center_dst[i] = operation(center[i], points[Is][i]...);
+    }
+  }
+
+  /*
+   * Row update for a StaticStencilSpec, offsets of stencil points along
+   * the fastest dimension are constants.
+   */
+  template <typename Op, std::size_t... Is>
+  static void update_row(const ElementT* center, ElementT* center_dst,
+                         const StencilOffsets_t&,
+                         const SignedCoords_t& dim_offs,
+                         signed_pattern_size_t length, Op& operation,
+                         std::index_sequence<Is...>, std::true_type) {
+    const signed_pattern_size_t offsets[] = {
+      static_point_offset<Is>(dim_offs)...
+    };
+#ifdef DASH_ENABLE_OPENMP
+    #pragma omp simd
+#endif
+    for(signed_pattern_size_t i = 0; i < length; ++i) {
+      center_dst[i] = operation(center[i], center[i + offsets[Is]]...);
+    }
+  }
+
+  /*
+   * Offset of a stencil point of a StaticStencilSpec, the offset of the
+   * fastest dimension is 1.
+   */
+  template <std::size_t Point>
+  static signed_pattern_size_t static_point_offset(
+    const SignedCoords_t& dim_offs) {
+    constexpr dim_t fd = StencilOperator_t::FastestDim;
+
+    signed_pattern_size_t offset = StencilSpecT::point_value(Point, fd);
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(d != fd && StencilSpecT::point_value(Point, d) != 0)
+        offset += StencilSpecT::point_value(Point, d) * dim_offs[d];
+    }
+
+    return offset;
+  }
+
   template <dim_t dim, typename Op>
   struct Loop {
     template <typename OffsetT>
@@ -689,7 +857,261 @@ public:
     return offset;
   }
 
+  /**
+   * Advances all local elements by \c num_steps consecutive applications
+   * of a user-defined stencil operation without halo updates in between.
+   *
+   * The local elements and the halo elements are copied to a padded
+   * buffer. Every step applies the operation to a region that starts as
+   * the local block extended by <tt>num_steps - 1</tt> stencil widths
+   * into the halo and shrinks by one stencil width per step, so redundant
+   * computations on halo elements replace halo updates. The results of the
+   * last step are written back to the local elements.
+   * Elements within the stencil width of global borders without halo
+   * regions (\ref BoundaryProp::NONE) and custom halo elements
+   * (\ref BoundaryProp::CUSTOM) are not modified.
+   *
+   * The halo regions have to be updated before and must provide elements
+   * for \c num_steps stencil applications, see \ref HaloDepth.
+   * Local elements are modified in place, units have to be synchronized
+   * before and after the preceding halo update.
+   *
+   * \param num_steps Number of stencil applications
+   * \param operation User-defined operation with the signature used by
+   *                  \ref StencilOperatorInner::update, called with
+   *                  pointers, offsets and stencil offsets relating to
+   *                  the padded buffers
+   */
+  template <typename Op>
+  void update_steps(HaloDepth::depth_t num_steps, Op operation) {
+    DASH_ASSERT_MSG(halo_covers_steps(num_steps),
+                    "Halo regions are not deep enough for the given number "
+                    "of stencil steps");
+    if(num_steps == 0)
+      return;
+
+    SignedCoords_t ext_local;
+    SignedCoords_t ext_padded;
+    SignedCoords_t halo_pre;
+    SignedCoords_t reach_pre;
+    SignedCoords_t reach_post;
+    SignedCoords_t origin{};
+    std::array<StepBound, NumDimensions> bound_pre;
+    std::array<StepBound, NumDimensions> bound_post;
+    pattern_size_t size_padded = 1;
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      auto minmax   = _stencil_spec.minmax_distances(d);
+      reach_pre[d]  = -minmax.first;
+      reach_post[d] = minmax.second;
+      ext_local[d]  = _view_local->extent(d);
+      halo_pre[d]   = num_steps * reach_pre[d];
+      ext_padded[d] = ext_local[d] + halo_pre[d] + num_steps * reach_post[d];
+      bound_pre[d]  = step_bound(d, RegionPos::PRE);
+      bound_post[d] = step_bound(d, RegionPos::POST);
+      size_padded  *= ext_padded[d];
+    }
+
+    // local block and halo elements to padded buffer
+    auto& buffer = _step_buffers[0];
+    buffer.assign(size_padded, ElementT());
+    copy_block(_local_memory, ext_local, origin, buffer.data(), ext_padded,
+               halo_pre, ext_local);
+    for(const auto& region : _halo_block->halo_regions()) {
+      if(region.size() == 0)
+        continue;
+
+      const auto&    spec = region.spec();
+      SignedCoords_t ext_region;
+      SignedCoords_t src_offsets{};
+      SignedCoords_t dst_offsets;
+      SignedCoords_t ext_copy;
+      bool           empty = false;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        ext_region[d] = region.view().extent(d);
+        ext_copy[d]   = ext_region[d];
+        if(spec[d] == 0)
+          dst_offsets[d] = halo_pre[d] - ext_region[d];
+        else if(spec[d] == 1)
+          dst_offsets[d] = halo_pre[d];
+        else
+          dst_offsets[d] = halo_pre[d] + ext_local[d];
+        // halo regions may be deeper than required
+        if(dst_offsets[d] < 0) {
+          src_offsets[d] = -dst_offsets[d];
+          ext_copy[d]   += dst_offsets[d];
+          dst_offsets[d] = 0;
+        }
+        ext_copy[d] = std::min(ext_copy[d], ext_padded[d] - dst_offsets[d]);
+        if(ext_copy[d] <= 0)
+          empty = true;
+      }
+      if(empty)
+        continue;
+
+      copy_block(&*(_halo_memory->first_element_at(region.index())),
+                 ext_region, src_offsets, buffer.data(), ext_padded,
+                 dst_offsets, ext_copy);
+    }
+    _step_buffers[1] = buffer;
+
+    auto             dim_offs = dimension_offsets(ext_padded);
+    StencilOffsets_t stencil_offs;
+    for(auto i = 0; i < NumStencilPoints; ++i) {
+      signed_pattern_size_t offset = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d)
+        offset += _stencil_spec[i][d] * dim_offs[d];
+      stencil_offs[i] = offset;
+    }
+
+    auto* src = _step_buffers[0].data();
+    auto* dst = _step_buffers[1].data();
+    for(HaloDepth::depth_t step = 1; step <= num_steps; ++step) {
+      signed_pattern_size_t remaining = num_steps - step;
+      SignedCoords_t        begin;
+      SignedCoords_t        end;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        begin[d] = halo_pre[d];
+        end[d]   = halo_pre[d] + ext_local[d];
+        if(bound_pre[d] == StepBound::HALO)
+          begin[d] -= remaining * reach_pre[d];
+        else if(bound_pre[d] == StepBound::NONE)
+          begin[d] += reach_pre[d];
+        if(bound_post[d] == StepBound::HALO)
+          end[d] += remaining * reach_post[d];
+        else if(bound_post[d] == StepBound::NONE)
+          end[d] -= reach_post[d];
+      }
+
+      for_each_row(begin, end, [&](const SignedCoords_t& coords) {
+        constexpr dim_t fd = FastestDim;
+        signed_pattern_size_t offset = 0;
+        for(dim_t d = 0; d < NumDimensions; ++d)
+          offset += coords[d] * dim_offs[d];
+        for(auto i = begin[fd]; i < end[fd]; ++i, ++offset) {
+          operation(src + offset, dst + offset, offset, stencil_offs);
+        }
+      });
+      std::swap(src, dst);
+    }
+
+    // results of the last step to local block
+    copy_block(src, ext_padded, halo_pre, _local_memory, ext_local, origin,
+               ext_local);
+  }
+
 private:
+  using SignedCoords_t = std::array<signed_pattern_size_t, NumDimensions>;
+
+  static constexpr dim_t FastestDim =
+    (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 : 0;
+
+  /*
+   * Treatment of elements at a block side in \ref update_steps
+   */
+  enum class StepBound : uint8_t {
+    /// halo elements are updated in every step
+    HALO,
+    /// halo elements are custom values and never updated
+    FIXED,
+    /// no halo elements, local elements at the side are never updated
+    NONE
+  };
+
+  StepBound step_bound(dim_t dim, RegionPos pos) const {
+    const auto* region = _halo_block->halo_region(
+      RegionCoords<NumDimensions>::index(dim, pos));
+    if(region == nullptr || region->size() == 0)
+      return StepBound::NONE;
+    if(region->is_custom_region())
+      return StepBound::FIXED;
+
+    return StepBound::HALO;
+  }
+
+  bool halo_covers_steps(HaloDepth::depth_t num_steps) const {
+    if(num_steps == 0)
+      return true;
+
+    HaloSpec<NumDimensions> required(HaloDepth(num_steps), _stencil_spec);
+    const auto&             provided = _halo_block->halo_spec();
+    for(const auto& spec : required.specs()) {
+      if(spec.extent() > provided.extent(spec.index()))
+        return false;
+    }
+
+    return true;
+  }
+
+  static SignedCoords_t dimension_offsets(const SignedCoords_t& extents) {
+    SignedCoords_t dim_offs;
+    if(MemoryArrange == ROW_MAJOR) {
+      dim_offs[NumDimensions - 1] = 1;
+      for(auto d = NumDimensions - 1; d > 0;) {
+        --d;
+        dim_offs[d] = dim_offs[d + 1] * extents[d + 1];
+      }
+    } else {
+      dim_offs[0] = 1;
+      for(auto d = 1; d < NumDimensions; ++d)
+        dim_offs[d] = dim_offs[d - 1] * extents[d - 1];
+    }
+
+    return dim_offs;
+  }
+
+  /*
+   * Calls the given function with the coordinates of the first element of
+   * every contiguous row in the block [begin, end).
+   */
+  template <typename RowFunc>
+  static void for_each_row(const SignedCoords_t& begin,
+                           const SignedCoords_t& end, RowFunc&& row_func) {
+    for(dim_t d = 0; d < NumDimensions; ++d) {
+      if(begin[d] >= end[d])
+        return;
+    }
+
+    auto coords = begin;
+    while(true) {
+      row_func(coords);
+      dim_t i = 0;
+      for(; i < NumDimensions; ++i) {
+        dim_t d = (MemoryArrange == ROW_MAJOR) ? NumDimensions - 1 - i : i;
+        if(d == FastestDim)
+          continue;
+        if(++coords[d] < end[d])
+          break;
+        coords[d] = begin[d];
+      }
+      if(i == NumDimensions)
+        return;
+    }
+  }
+
+  /*
+   * Copies a block of extents ext_copy between two buffers arranged in
+   * memory order of the pattern.
+   */
+  static void copy_block(const ElementT* src, const SignedCoords_t& ext_src,
+                         const SignedCoords_t& src_offsets, ElementT* dst,
+                         const SignedCoords_t& ext_dst,
+                         const SignedCoords_t& dst_offsets,
+                         const SignedCoords_t& ext_copy) {
+    auto           src_dim_offs = dimension_offsets(ext_src);
+    auto           dst_dim_offs = dimension_offsets(ext_dst);
+    SignedCoords_t begin{};
+    for_each_row(begin, ext_copy, [&](const SignedCoords_t& coords) {
+      signed_pattern_size_t src_off = 0;
+      signed_pattern_size_t dst_off = 0;
+      for(dim_t d = 0; d < NumDimensions; ++d) {
+        src_off += (coords[d] + src_offsets[d]) * src_dim_offs[d];
+        dst_off += (coords[d] + dst_offsets[d]) * dst_dim_offs[d];
+      }
+      std::copy(src + src_off, src + src_off + ext_copy[FastestDim],
+                dst + dst_off);
+    });
+  }
+
   StencilOffsets_t set_stencil_offsets() {
     StencilOffsets_t stencil_offs;
     for(auto i = 0; i < NumStencilPoints; ++i) {
@@ -748,6 +1170,8 @@ private:
   iterator_inner _iend;
   iterator_bnd   _bbegin;
   iterator_bnd   _bend;
+
+  std::array<std::vector<ElementT>, 2> _step_buffers;
 };
 
 }  // namespace halo
@@ -3,6 +3,10 @@
 
 #include <dash/Team.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
 namespace dash {
 template <typename Key>
 class HashLocal {
@@ -43,6 +47,18 @@ class HashLocal {
 
 namespace detail {
 
+/**
+ * Whether a hash function maps every key to the calling unit instead of
+ * resolving the unit owning the key, like \c dash::HashLocal.
+ * Lookups in a container using such a hash function must consider the
+ * local indices of all units.
+ */
+template <class Hash>
+struct is_local_hash : std::false_type { };
+
+template <class Key>
+struct is_local_hash<dash::HashLocal<Key>> : std::true_type { };
+
 struct HashNodeBase {
   HashNodeBase* _next;
 
@@ -514,6 +530,14 @@ struct prime_number_hash_policy {
     size = *found;
     return static_cast<uint8_t>(1 + found - prime_list);
   }
+  void commit(uint8_t new_prime_index)
+  {
+    prime_index = new_prime_index;
+  }
+  void reset()
+  {
+    prime_index = 0;
+  }
 
  private:
   uint8_t prime_index = 0;
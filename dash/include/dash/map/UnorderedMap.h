@@ -10,6 +10,7 @@
 #include <dash/Array.h>
 #include <dash/Allocator.h>
 #include <dash/Meta.h>
+#include <dash/Onesided.h>
 
 #include <dash/memory/GlobHeapMem.h>
 
@@ -27,6 +28,7 @@
 #include <functional>
 #include <algorithm>
 #include <cstddef>
+#include <type_traits>
 
 
 namespace dash {
@@ -138,6 +140,21 @@ public:
             size_type, int, dash::CSRPattern<1, dash::ROW_MAJOR, int> >
     local_sizes_map;
 
+private:
+  typedef typename glob_mem_type::template rebind<index_type>
+    glob_index_mem_type;
+
+  typedef detail::prime_number_hash_policy
+    bucket_policy;
+
+  /// Element type sent to the unit owning its key, \c value_type has a
+  /// const key and cannot be assigned.
+  typedef std::pair<key_type, mapped_type>
+    bulk_value;
+
+  /// Successor of erased nodes in the hash index.
+  static constexpr index_type _erased_node = -2;
+
 private:
   /// Team containing all units interacting with the map.
   dash::Team           * _team            = nullptr;
@@ -149,8 +166,12 @@ private:
   iterator               _begin           = nullptr;
   /// Iterator past the last element in the map.
   iterator               _end             = nullptr;
-  /// Number of elements in the map.
+  /// Number of elements at remote units, including erased elements.
   size_type              _remote_size     = 0;
+  /// Number of erased elements at remote units as of the last commit.
+  size_type              _remote_erased   = 0;
+  /// Number of erased elements in local memory space.
+  size_type              _local_erased    = 0;
   /// Native pointer to first local element in the map.
   local_iterator         _lbegin          = nullptr;
   /// Native pointer past the last local element in the map.
@@ -159,15 +180,40 @@ private:
   local_sizes_map        _local_sizes;
   /// Cumulative (postfix sum) local sizes of all units.
   std::vector<size_type> _local_cumul_sizes;
-  /// Iterators to elements in local memory space that are marked for move
-  /// to remote unit in next commit.
-  std::vector<iterator>  _move_elements;
+  /// Local offsets of elements in local memory space that are moved to
+  /// the unit mapped to their key in the next commit.
+  std::vector<index_type> _move_elements;
+  /// Local offsets of elements at remote units that are marked for erase
+  /// in next commit, by unit.
+  std::vector<std::vector<index_type>> _erase_requests;
   /// Global pointer to local element in _local_sizes.
   dart_gptr_t            _local_size_gptr = DART_GPTR_NULL;
   /// Hash type for mapping of key to unit and local offset.
   hasher                 _key_hash;
   /// Predicate for key comparison.
   key_equal              _key_equal;
+  /// Policy mapping key hashes to buckets of the local hash index.
+  bucket_policy          _lbucket_policy;
+  /// Local offset of the first node in every bucket of the local hash
+  /// index, -1 for empty buckets.
+  std::vector<index_type>   _lbucket_heads;
+  /// Local offset of the successor of every local node in its bucket
+  /// chain, -1 at the end of a chain and -2 for erased nodes.
+  std::vector<index_type>   _lnode_next;
+  /// Native pointers to local nodes, indexed by local offset, nullptr for
+  /// erased nodes.
+  std::vector<value_type *> _lnode_lptr;
+  /// Global memory containing the hash index of every unit as of the last
+  /// commit, bucket heads followed by node successors.
+  glob_index_mem_type  * _globidx         = nullptr;
+  /// Number of buckets in the published hash index of every unit.
+  std::vector<size_type>     _unit_bucket_counts;
+  /// Number of nodes in the published hash index of every unit.
+  std::vector<size_type>     _unit_node_counts;
+  /// Number of erased nodes in the published hash index of every unit.
+  std::vector<size_type>     _unit_erased_counts;
+  /// Bucket policies of the published hash index of every unit.
+  std::vector<bucket_policy> _unit_bucket_policies;
   /// Capacity of local buffer containing locally added node elements that
   /// have not been committed to global memory yet.
   /// Default is 4 KB.
@@ -244,36 +290,64 @@ public:
   void barrier()
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.barrier()", _team->dart_id());
-    // Apply changes in local memory spaces to global memory space:
-    if (_globmem != nullptr) {
-      _globmem->commit();
-    }
-    // Accumulate local sizes of remote units:
-    _local_sizes.barrier();
-    _remote_size = 0;
-    for (int u = 0; u < _team->size(); ++u) {
-      size_type local_size_u;
-      if (u != _myid) {
-        local_size_u = _local_sizes[u];
-        _remote_size += local_size_u;
-      } else {
-        local_size_u = _local_sizes.local[0];
+    // Apply erase operations on elements at remote units:
+    _commit_erase();
+    // Move elements inserted for remote units to their owner:
+    _commit_move();
+    _commit();
+    DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
+  }
+
+  /**
+   * Remove erased elements from the local memory space of every unit and
+   * release local memory that is not required for the remaining elements.
+   *
+   * Collective operation, implies \c barrier().
+   * Invalidates all iterators and references to elements in the map.
+   */
+  void compact()
+  {
+    DASH_LOG_DEBUG("UnorderedMap.compact()");
+    _commit_erase();
+    _commit_move();
+    DASH_LOG_TRACE("UnorderedMap.compact", "local elements:",
+                   _local_sizes.local[0], "erased:", _local_erased);
+    // Move remaining elements to the front of local memory space, in
+    // order of their local offset:
+    size_type lnodes   = _local_sizes.local[0];
+    size_type nlive    = 0;
+    auto      lptr_dst = _globmem->lbegin();
+    for (size_type lidx = 0; lidx < lnodes; ++lidx) {
+      value_type * lptr_src = _lnode_lptr[lidx];
+      if (lptr_src == nullptr) {
+        continue;
       }
-      _local_cumul_sizes[u] = local_size_u;
-      if (u > 0) {
-        _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
+      auto * lptr = static_cast<value_type *>(lptr_dst);
+      if (lptr != lptr_src) {
+        new (lptr) value_type(*lptr_src);
+        lptr_src->~value_type();
       }
-      DASH_LOG_TRACE("UnorderedMap.barrier",
-                     "local size at unit", u, ":", local_size_u,
-                     "cumulative size:", _local_cumul_sizes[u]);
+      _lnode_lptr[nlive] = lptr;
+      ++lptr_dst;
+      ++nlive;
     }
-    auto new_size = size();
-    DASH_LOG_TRACE("UnorderedMap.barrier", "new size:", new_size);
-    DASH_ASSERT_EQ(_remote_size, new_size - _local_sizes.local[0],
-                   "invalid size after global commit");
-    _begin = iterator(this, 0);
-    _end   = iterator(this, new_size);
-    DASH_LOG_TRACE("UnorderedMap.barrier >", "passed barrier");
+    _lnode_lptr.resize(nlive);
+    _lnode_next.resize(nlive);
+    _local_erased         = 0;
+    _local_sizes.local[0] = nlive;
+    // Release local memory exceeding the remaining elements and a single
+    // local buffer, detached buckets are deallocated in the commit:
+    size_type lcap     = _globmem->local_size();
+    size_type lcap_new = std::max(nlive, _local_buffer_size);
+    if (lcap > lcap_new) {
+      _globmem->shrink(lcap - lcap_new);
+    }
+    _rehash_local(std::max<size_type>(nlive, 1));
+    _lbegin = local_iterator(this, 0);
+    _lend   = local_iterator(this, nlive);
+    _commit();
+    DASH_LOG_DEBUG("UnorderedMap.compact >", "local elements:", nlive,
+                   "local capacity:", lcapacity());
   }
 
   bool allocate(
@@ -312,6 +386,23 @@ public:
     _globmem     = new glob_mem_type(lcap, *_team);
     DASH_LOG_TRACE("UnorderedMap.allocate", "global memory initialized");
 
+    // Initialize local hash index with one bucket per element in local
+    // capacity:
+    _lnode_next.clear();
+    _lnode_lptr.clear();
+    _rehash_local(lcap);
+    _globidx     = new glob_index_mem_type(0, *_team);
+    _unit_bucket_counts     = std::vector<size_type>(_team->size(), 0);
+    _unit_node_counts       = std::vector<size_type>(_team->size(), 0);
+    _unit_erased_counts     = std::vector<size_type>(_team->size(), 0);
+    _unit_bucket_policies   = std::vector<bucket_policy>(_team->size());
+    _erase_requests.assign(_team->size(), std::vector<index_type>());
+    _move_elements.clear();
+    _local_erased           = 0;
+    _remote_erased          = 0;
+    DASH_LOG_TRACE("UnorderedMap.allocate", "hash index initialized,",
+                   "local buckets:", _lbucket_heads.size());
+
     // Initialize local sizes with 0:
     _local_sizes.allocate(_team->size(), dash::BLOCKED, *_team);
     _local_sizes.local[0] = 0;
@@ -361,8 +452,19 @@ public:
       delete _globmem;
       _globmem = nullptr;
     }
+    if (_globidx != nullptr) {
+      delete _globidx;
+      _globidx = nullptr;
+    }
+    _lbucket_heads.clear();
+    _lnode_next.clear();
+    _lnode_lptr.clear();
+    _erase_requests.clear();
+    _move_elements.clear();
     _local_cumul_sizes    = std::vector<size_type>(_team->size(), 0);
     _remote_size          = 0;
+    _remote_erased        = 0;
+    _local_erased         = 0;
     _begin                = iterator();
     _end                  = _begin;
     DASH_LOG_TRACE_VAR("UnorderedMap.deallocate >", this);
@@ -447,7 +549,7 @@ public:
 
   inline size_type size() const noexcept
   {
-    return _remote_size + _local_sizes.local[0];
+    return (_remote_size - _remote_erased) + lsize();
   }
 
   inline size_type capacity() const noexcept
@@ -462,7 +564,7 @@ public:
 
   inline size_type lsize() const noexcept
   {
-    return _local_sizes.local[0];
+    return _local_sizes.local[0] - _local_erased;
   }
 
   inline size_type lcapacity() const noexcept
@@ -549,14 +651,33 @@ public:
     return nelem;
   }
 
+  /**
+   * Look up the element with the given key.
+   *
+   * Probes the local hash index and the bucket chain of the key in the
+   * hash index of the unit the key is mapped to by the hash function.
+   * Hash functions like \c dash::HashLocal that do not resolve the unit
+   * owning a key require to probe the hash index of every unit.
+   */
   iterator find(const key_type & key)
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find()", key);
-    iterator found = std::find_if(
-                       _begin, _end,
-                       [&](const value_type & v) {
-                         return _key_equal(v.first, key);
-                       });
+    iterator found = _find_local(key);
+    if (detail::is_local_hash<hasher>::value) {
+      for (int u = 0; found == _end && u < _team->size(); ++u) {
+        if (u != _myid) {
+          found = _find_remote(team_unit_t(u), key);
+        }
+      }
+    } else if (found == _end) {
+      // Elements inserted for a remote unit remain in local memory space
+      // until they are moved to their owner in the next commit, so the
+      // local index is probed in any case:
+      team_unit_t unit = _key_hash(key);
+      if (unit != _myid) {
+        found = _find_remote(unit, key);
+      }
+    }
     DASH_LOG_TRACE("UnorderedMap.find >", found);
     return found;
   }
@@ -564,11 +685,7 @@ public:
   const_iterator find(const key_type & key) const
   {
     DASH_LOG_TRACE_VAR("UnorderedMap.find() const", key);
-    const_iterator found = std::find_if(
-                             _begin, _end,
-                             [&](const value_type & v) {
-                               return _key_equal(v.first, key);
-                             });
+    const_iterator found = const_cast<self_t *>(this)->find(key);
     DASH_LOG_TRACE("UnorderedMap.find const >", found);
     return found;
   }
@@ -577,6 +694,14 @@ public:
   // Modifiers
   //////////////////////////////////////////////////////////////////////////
 
+  /**
+   * Insert the given element if the map does not contain an element with
+   * equivalent key.
+   *
+   * Elements with a key mapped to a remote unit by the hash function are
+   * stored in local memory space and moved to that unit in the next
+   * commit, which invalidates iterators and references to them.
+   */
   std::pair<iterator, bool> insert(
     /// The element to insert.
     const value_type & value)
@@ -623,27 +748,8 @@ public:
 
     auto unit = _key_hash(key);
 
-    iterator found = _end;
-
-    if (_myid == unit) {
-      DASH_LOG_TRACE("UnorderedMap.insert", "local element key lookup");
-
-      auto lbegin = static_cast<value_type *>(_lbegin);
-      auto lend = static_cast<value_type *>(_lend);
-      const_local_iterator liter = std::find_if(
-                  _lbegin, _lend,
-                   [&](const value_type & v) {
-                     return _key_equal(v.first, key);
-                   });
-
-      if (liter != _lend) {
-        found = iterator(this, _myid, liter.pos());
-      }
-
-    } else  {
-      DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
-      iterator found = find(key);
-    }
+    DASH_LOG_TRACE("UnorderedMap.insert", "element key lookup");
+    iterator found = find(key);
     DASH_LOG_TRACE_VAR("UnorderedMap.insert", found);
 
     iterator res;
@@ -670,30 +776,122 @@ public:
     // Iterator past the last value in the range to insert.
     InputIterator last)
   {
-    // TODO: Calling insert() on every single element in the range could cause
-    //       multiple calls of globmem.grow(_local_buffer_size).
-    //       Could be optimized to allocate additional memory in a single call
-    //       of globmem.grow(std::distance(first,last)).
+    typedef typename std::iterator_traits<InputIterator>::iterator_category
+      iterator_category;
+    // Allocate local memory for all elements in a single call of
+    // globmem.grow if the range size can be determined in advance:
+    if (std::is_base_of<std::forward_iterator_tag,
+                        iterator_category>::value) {
+      _reserve_local(std::distance(first, last));
+    }
     for (auto it = first; it != last; ++it) {
       insert(*it);
     }
   }
 
+  /**
+   * Insert the elements in the given range of every unit.
+   *
+   * Elements are sent to the unit mapped to their key by the hash function
+   * in a single all-to-all exchange. Every unit then inserts the elements
+   * it received into its local memory space, allocating memory for all
+   * of them in a single call of globmem.grow.
+   * Elements with a key that is already contained in the map are not
+   * inserted.
+   *
+   * Collective operation, implies \c barrier().
+   *
+   * \return  The number of elements inserted at the local unit.
+   */
+  template<class ForwardIterator>
+  size_type insert_bulk(
+    // Iterator at first value in the local range to insert.
+    ForwardIterator first,
+    // Iterator past the last value in the local range to insert.
+    ForwardIterator last)
+  {
+    DASH_ASSERT(_globmem != nullptr);
+    auto nunits = _team->size();
+    auto nlocal = std::distance(first, last);
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk()", "local elements:", nlocal);
+
+    // Map elements to target units and count elements per target unit,
+    // as number of bytes:
+    std::vector<team_unit_t> target_units;
+    std::vector<size_t>      send_counts(nunits, 0);
+    std::vector<size_t>      send_displs(nunits, 0);
+    target_units.reserve(nlocal);
+    for (auto it = first; it != last; ++it) {
+      team_unit_t unit = _key_hash((*it).first);
+      target_units.push_back(unit);
+      send_counts[unit] += sizeof(bulk_value);
+    }
+    for (int u = 1; u < nunits; ++u) {
+      send_displs[u] = send_displs[u-1] + send_counts[u-1];
+    }
+    // Order elements by target unit:
+    std::vector<bulk_value> send_buf(nlocal);
+    {
+      std::vector<size_t> send_pos(send_displs);
+      auto unit_it = target_units.begin();
+      for (auto it = first; it != last; ++it, ++unit_it) {
+        auto & pos = send_pos[*unit_it];
+        send_buf[pos / sizeof(bulk_value)] = bulk_value((*it).first,
+                                                        (*it).second);
+        pos += sizeof(bulk_value);
+      }
+    }
+    target_units.clear();
+    size_type ninserted = _insert_exchange(send_buf, send_counts,
+                                           send_displs);
+    DASH_LOG_TRACE("UnorderedMap.insert_bulk", "inserted:", ninserted);
+
+    barrier();
+    DASH_LOG_DEBUG("UnorderedMap.insert_bulk >", "size:", size());
+    return ninserted;
+  }
+
+  /**
+   * Erase the element at the given position.
+   *
+   * Erased elements are marked as tombstones and are skipped in iteration
+   * and lookup, their memory is reclaimed in \c compact().
+   * Erasing an element at a remote unit takes effect in the next commit.
+   *
+   * \return  Iterator to the element following the erased element.
+   */
   iterator erase(
     const_iterator position)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "iterator:", position);
+    auto lpos = position.lpos();
+    _erase_at(lpos.unit, lpos.index);
+    iterator next(position);
+    ++next;
+    DASH_LOG_DEBUG("UnorderedMap.erase >", next);
+    return next;
   }
 
+  /**
+   * Erase the element with the given key.
+   *
+   * \return  The number of elements erased, 0 or 1.
+   */
   size_type erase(
     /// Key of the container element to remove.
     const key_type & key)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase()", "key:", key);
+    auto found = find(key);
+    if (found == _end) {
+      DASH_LOG_DEBUG("UnorderedMap.erase >", "key not found");
+      return 0;
+    }
+    auto lpos = found.lpos();
+    _erase_at(lpos.unit, lpos.index);
+    DASH_LOG_DEBUG("UnorderedMap.erase >", "unit:", lpos.unit,
+                   "lidx:", lpos.index);
+    return 1;
   }
 
   iterator erase(
@@ -702,9 +900,16 @@ public:
     /// Iterator past the last element to remove.
     const_iterator last)
   {
-    DASH_THROW(
-      dash::exception::NotImplemented,
-      "dash::UnorderedMap.erase is not implemented.");
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last)");
+    DASH_LOG_TRACE_VAR("UnorderedMap.erase()", first);
+    DASH_LOG_TRACE_VAR("UnorderedMap.erase()", last);
+    // Tombstones do not change positions of elements:
+    for (auto it = first; it != last; ++it) {
+      auto lpos = it.lpos();
+      _erase_at(lpos.unit, lpos.index);
+    }
+    DASH_LOG_DEBUG("UnorderedMap.erase(first,last) >");
+    return iterator(last);
   }
 
   //////////////////////////////////////////////////////////////////////////
@@ -822,7 +1027,7 @@ private:
 
     size_type new_local_size   = old_local_size + 1;
     size_type local_capacity   = _globmem->local_size();
-    _local_cumul_sizes[unit]  += 1;
+    _local_cumul_sizes[_myid] += 1;
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", local_capacity);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", _local_buffer_size);
     DASH_LOG_TRACE_VAR("UnorderedMap._insert_at", old_local_size);
@@ -848,23 +1053,25 @@ private:
     // Using placement new to avoid assignment/copy as value_type is
     // const:
     new (lptr_insert) value_type(value);
-    // Convert local iterator to global iterator:
+    // Add new element to local hash index:
+    _index_local_node(old_local_size, lptr_insert);
+    // Convert local iterator to global iterator, the element is stored
+    // at the local unit until the next commit:
     DASH_LOG_TRACE("UnorderedMap._insert_at", "converting to global iterator",
-                   "unit:", unit, "lidx:", old_local_size);
-    result.first  = iterator(this, unit, old_local_size);
+                   "unit:", _myid, "lidx:", old_local_size);
+    result.first  = iterator(this, _myid, old_local_size);
     result.second = true;
+    ++_lend;
 
     if (unit != _myid) {
       DASH_LOG_TRACE("UnorderedMap.insert", "remote insertion");
       // Mark inserted element for move to remote unit in next commit:
-      _move_elements.push_back(result.first);
-    } else {
-      ++_lend;
+      _move_elements.push_back(old_local_size);
     }
 
     // Update iterators as global memory space has been changed for the
     // active unit:
-    auto new_size = size();
+    auto new_size = _remote_size + _local_sizes.local[0];
     DASH_LOG_TRACE("UnorderedMap._insert_at", "new size:", new_size);
     DASH_LOG_TRACE("UnorderedMap._insert_at", "updating _begin");
     _begin        = iterator(this, 0);
@@ -878,6 +1085,491 @@ private:
     return result;
   }
 
+  /**
+   * Allocate local memory and hash index buckets for the given number of
+   * additional local elements.
+   */
+  void _reserve_local(size_type nelem)
+  {
+    size_type lsize_new = _local_sizes.local[0] + nelem;
+    size_type lcap      = _globmem->local_size();
+    DASH_LOG_TRACE("UnorderedMap._reserve_local()",
+                   "new local size:", lsize_new, "local capacity:", lcap);
+    if (lsize_new > lcap) {
+      _globmem->grow(std::max(lsize_new - lcap, _local_buffer_size));
+    }
+    if (lsize_new > _lbucket_heads.size()) {
+      _rehash_local(lsize_new);
+    }
+  }
+
+  /**
+   * Bucket of the given key in the local hash index.
+   */
+  inline size_type _lbucket_index(const key_type & key) const
+  {
+    return _lbucket_policy.index_for_hash(
+             std::hash<key_type>()(key), _lbucket_heads.size() - 1);
+  }
+
+  /**
+   * Local offset of the element with the given key in the local hash
+   * index, -1 if the key is not contained in local memory space.
+   */
+  index_type _find_local_index(const key_type & key) const
+  {
+    if (_lbucket_heads.empty()) {
+      return -1;
+    }
+    for (index_type lidx  = _lbucket_heads[_lbucket_index(key)];
+                    lidx >= 0;
+                    lidx  = _lnode_next[lidx]) {
+      if (_key_equal(_lnode_lptr[lidx]->first, key)) {
+        return lidx;
+      }
+    }
+    return -1;
+  }
+
+  /**
+   * Look up the given key in the local hash index.
+   */
+  iterator _find_local(const key_type & key)
+  {
+    index_type lidx = _find_local_index(key);
+    if (lidx < 0) {
+      return _end;
+    }
+    return iterator(this, _myid, lidx);
+  }
+
+  /**
+   * Look up the given key in the hash index published by a remote unit
+   * in the last commit.
+   * Reads the bucket head and, for every node in the bucket chain, the
+   * node's key and successor.
+   */
+  iterator _find_remote(team_unit_t unit, const key_type & key)
+  {
+    DASH_LOG_TRACE("UnorderedMap._find_remote()", "unit:", unit,
+                   "key:", key);
+    size_type nbuckets = _unit_bucket_counts[unit];
+    if (nbuckets == 0) {
+      DASH_LOG_TRACE("UnorderedMap._find_remote >", "no buckets");
+      return _end;
+    }
+    auto bidx = _unit_bucket_policies[unit].index_for_hash(
+                  std::hash<key_type>()(key), nbuckets - 1);
+    index_type lidx = -1;
+    dash::get_value(&lidx, _globidx->at(unit, bidx));
+    while (lidx >= 0) {
+      iterator node(this, unit, lidx);
+      // Key is the first member of the node, read it only:
+      key_type node_key;
+      dash::internal::get_blocking(node.dart_gptr(), &node_key, 1);
+      if (_key_equal(node_key, key)) {
+        DASH_LOG_TRACE("UnorderedMap._find_remote >", node);
+        return node;
+      }
+      dash::get_value(&lidx, _globidx->at(unit, nbuckets + lidx));
+    }
+    DASH_LOG_TRACE("UnorderedMap._find_remote >", "not found");
+    return _end;
+  }
+
+  /**
+   * Whether the element at the given local offset in local memory space
+   * has been erased.
+   */
+  inline bool _is_erased_local(index_type lidx) const
+  {
+    return lidx >= 0 &&
+           lidx < static_cast<index_type>(_lnode_lptr.size()) &&
+           _lnode_lptr[lidx] == nullptr;
+  }
+
+  /**
+   * Whether the element at the given local offset of the given unit has
+   * been erased.
+   * Elements at remote units are resolved from their published hash index
+   * which is only read if the unit had erased elements in the last commit.
+   */
+  bool _is_erased(team_unit_t unit, index_type lidx) const
+  {
+    if (unit == _myid) {
+      return _is_erased_local(lidx);
+    }
+    if (_unit_erased_counts[unit] == 0 ||
+        lidx < 0 ||
+        lidx >= static_cast<index_type>(_unit_node_counts[unit])) {
+      return false;
+    }
+    index_type next = -1;
+    dash::get_value(&next, _globidx->at(unit,
+                                        _unit_bucket_counts[unit] + lidx));
+    return next == _erased_node;
+  }
+
+  /**
+   * Erase the element at the given local offset of the given unit, or
+   * mark it for erase in the next commit if the unit is remote.
+   */
+  void _erase_at(team_unit_t unit, index_type lidx)
+  {
+    if (unit == _myid) {
+      _erase_local(lidx);
+    } else {
+      _erase_requests[unit].push_back(lidx);
+    }
+  }
+
+  /**
+   * Erase the element at the given local offset in local memory space.
+   * The element is removed from the local hash index and remains in local
+   * memory as tombstone until the next compaction.
+   *
+   * \return  false if the element has already been erased
+   */
+  bool _erase_local(index_type lidx)
+  {
+    DASH_LOG_TRACE("UnorderedMap._erase_local()", "lidx:", lidx);
+    if (lidx < 0 ||
+        lidx >= static_cast<index_type>(_lnode_lptr.size()) ||
+        _lnode_lptr[lidx] == nullptr) {
+      DASH_LOG_TRACE("UnorderedMap._erase_local >", "no element");
+      return false;
+    }
+    // Unlink node from its bucket chain:
+    auto         bidx = _lbucket_index(_lnode_lptr[lidx]->first);
+    index_type * link = &_lbucket_heads[bidx];
+    while (*link != lidx) {
+      link = &_lnode_next[*link];
+    }
+    *link = _lnode_next[lidx];
+    _lnode_lptr[lidx]->~value_type();
+    _lnode_lptr[lidx] = nullptr;
+    _lnode_next[lidx] = _erased_node;
+    ++_local_erased;
+    // Iterators to first element skip erased elements:
+    if (_lbegin.pos() == lidx) {
+      ++_lbegin;
+    }
+    if (_begin.lpos().unit == _myid && _begin.lpos().index == lidx) {
+      ++_begin;
+    }
+    DASH_LOG_TRACE("UnorderedMap._erase_local >", "local erased:",
+                   _local_erased);
+    return true;
+  }
+
+  /**
+   * Add a new element in local memory space to the local hash index.
+   */
+  void _index_local_node(
+    /// Local offset of the new element.
+    index_type   lidx,
+    /// Native pointer to the new element.
+    value_type * lptr)
+  {
+    DASH_ASSERT_EQ(lidx, _lnode_next.size(), "invalid local node offset");
+    _lnode_lptr.push_back(lptr);
+    _lnode_next.push_back(-1);
+    if (_lnode_next.size() > _lbucket_heads.size()) {
+      // Load factor exceeds 1, rehash includes the new node:
+      _rehash_local(2 * _lbucket_heads.size());
+    } else {
+      auto bidx            = _lbucket_index(lptr->first);
+      _lnode_next[lidx]    = _lbucket_heads[bidx];
+      _lbucket_heads[bidx] = lidx;
+    }
+  }
+
+  /**
+   * Rebuild the local hash index with at least the given number of
+   * buckets.
+   */
+  void _rehash_local(size_type nbuckets)
+  {
+    DASH_LOG_TRACE("UnorderedMap._rehash_local()", "buckets:", nbuckets);
+    _lbucket_policy.commit(_lbucket_policy.next_size_over(nbuckets));
+    _lbucket_heads.assign(nbuckets, -1);
+    for (index_type lidx = 0; lidx < _lnode_next.size(); ++lidx) {
+      if (_lnode_lptr[lidx] == nullptr) {
+        continue;
+      }
+      auto bidx            = _lbucket_index(_lnode_lptr[lidx]->first);
+      _lnode_next[lidx]    = _lbucket_heads[bidx];
+      _lbucket_heads[bidx] = lidx;
+    }
+    DASH_LOG_TRACE("UnorderedMap._rehash_local >",
+                   "buckets:", _lbucket_heads.size());
+  }
+
+  /**
+   * Apply changes in local memory spaces to global memory space and update
+   * the local sizes and hash indices of remote units.
+   *
+   * Collective operation.
+   */
+  void _commit()
+  {
+    DASH_LOG_TRACE("UnorderedMap._commit()");
+    // Apply changes in local memory spaces to global memory space:
+    if (_globmem != nullptr) {
+      _globmem->commit();
+    }
+    // Publish local hash index to remote units:
+    _commit_index();
+    // Accumulate local sizes of remote units:
+    _local_sizes.barrier();
+    _remote_size = 0;
+    for (int u = 0; u < _team->size(); ++u) {
+      size_type local_size_u;
+      if (u != _myid) {
+        local_size_u = _local_sizes[u];
+        _remote_size += local_size_u;
+      } else {
+        local_size_u = _local_sizes.local[0];
+      }
+      _local_cumul_sizes[u] = local_size_u;
+      if (u > 0) {
+        _local_cumul_sizes[u] += _local_cumul_sizes[u-1];
+      }
+      DASH_LOG_TRACE("UnorderedMap._commit",
+                     "local size at unit", u, ":", local_size_u,
+                     "cumulative size:", _local_cumul_sizes[u]);
+    }
+    // Iteration space includes erased elements:
+    auto new_size = _remote_size + _local_sizes.local[0];
+    DASH_LOG_TRACE("UnorderedMap._commit", "new size:", new_size,
+                   "remote erased:", _remote_erased);
+    _begin = iterator(this, 0);
+    _end   = iterator(this, new_size);
+    DASH_LOG_TRACE("UnorderedMap._commit >");
+  }
+
+  /**
+   * Erase elements at the local unit that have been marked for erase by
+   * remote units.
+   *
+   * Collective operation.
+   */
+  void _commit_erase()
+  {
+    auto nunits = _team->size();
+    // Local offsets of elements to erase, ordered by target unit and
+    // counted in bytes:
+    std::vector<index_type> send_buf;
+    std::vector<size_t>     send_counts(nunits, 0);
+    std::vector<size_t>     send_displs(nunits, 0);
+    for (int u = 0; u < nunits; ++u) {
+      auto & requests = _erase_requests[u];
+      send_displs[u]  = send_buf.size() * sizeof(index_type);
+      send_counts[u]  = requests.size() * sizeof(index_type);
+      send_buf.insert(send_buf.end(), requests.begin(), requests.end());
+      requests.clear();
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_erase()",
+                   "remote erase requests:", send_buf.size());
+    std::vector<size_t> recv_counts(nunits, 0);
+    std::vector<size_t> recv_displs(nunits, 0);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_counts.data(),
+        recv_counts.data(),
+        1,
+        dash::dart_datatype<size_t>::value,
+        _team->dart_id()),
+      DART_OK);
+    for (int u = 1; u < nunits; ++u) {
+      recv_displs[u] = recv_displs[u-1] + recv_counts[u-1];
+    }
+    size_t nrecv = (recv_displs[nunits-1] + recv_counts[nunits-1]) /
+                   sizeof(index_type);
+    std::vector<index_type> recv_buf(nrecv);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        send_buf.data(),
+        send_counts.data(),
+        send_displs.data(),
+        DART_TYPE_BYTE,
+        recv_buf.data(),
+        recv_counts.data(),
+        recv_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    // Elements might have been erased by several units:
+    for (auto lidx : recv_buf) {
+      _erase_local(lidx);
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_erase >",
+                   "local erased:", _local_erased);
+  }
+
+  /**
+   * Move elements inserted for remote units to the unit mapped to their
+   * key and erase them from local memory space.
+   * Elements with a key that has been inserted at the target unit in the
+   * meantime are discarded.
+   *
+   * Collective operation.
+   */
+  void _commit_move()
+  {
+    auto nunits = _team->size();
+    std::vector<std::vector<bulk_value>> unit_values(nunits);
+    for (auto lidx : _move_elements) {
+      value_type * lptr = _lnode_lptr[lidx];
+      if (lptr == nullptr) {
+        // Erased before commit:
+        continue;
+      }
+      unit_values[_key_hash(lptr->first)].push_back(
+        bulk_value(lptr->first, lptr->second));
+      _erase_local(lidx);
+    }
+    _move_elements.clear();
+    std::vector<bulk_value> send_buf;
+    std::vector<size_t>     send_counts(nunits, 0);
+    std::vector<size_t>     send_displs(nunits, 0);
+    for (int u = 0; u < nunits; ++u) {
+      send_displs[u] = send_buf.size() * sizeof(bulk_value);
+      send_counts[u] = unit_values[u].size() * sizeof(bulk_value);
+      send_buf.insert(send_buf.end(),
+                      unit_values[u].begin(), unit_values[u].end());
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_move()",
+                   "moved elements:", send_buf.size());
+    auto ninserted = _insert_exchange(send_buf, send_counts, send_displs);
+    DASH_LOG_TRACE("UnorderedMap._commit_move >", "inserted:", ninserted);
+  }
+
+  /**
+   * Send elements ordered by target unit to their target unit in a single
+   * all-to-all exchange and insert the elements received from all units
+   * in local memory space, skipping keys contained in local memory space.
+   * Counts and displacements are specified in bytes.
+   *
+   * Collective operation.
+   *
+   * \return  The number of elements inserted at the local unit.
+   */
+  size_type _insert_exchange(
+    const std::vector<bulk_value> & send_buf,
+    const std::vector<size_t>     & send_counts,
+    const std::vector<size_t>     & send_displs)
+  {
+    auto nunits = _team->size();
+    // Exchange element counts and elements:
+    std::vector<size_t> recv_counts(nunits, 0);
+    std::vector<size_t> recv_displs(nunits, 0);
+    DASH_ASSERT_RETURNS(
+      dart_alltoall(
+        send_counts.data(),
+        recv_counts.data(),
+        1,
+        dash::dart_datatype<size_t>::value,
+        _team->dart_id()),
+      DART_OK);
+    for (int u = 1; u < nunits; ++u) {
+      recv_displs[u] = recv_displs[u-1] + recv_counts[u-1];
+    }
+    size_t nrecv = (recv_displs[nunits-1] + recv_counts[nunits-1]) /
+                   sizeof(bulk_value);
+    std::vector<bulk_value> recv_buf(nrecv);
+    DASH_ASSERT_RETURNS(
+      dart_alltoallv(
+        send_buf.data(),
+        send_counts.data(),
+        send_displs.data(),
+        DART_TYPE_BYTE,
+        recv_buf.data(),
+        recv_counts.data(),
+        recv_displs.data(),
+        _team->dart_id()),
+      DART_OK);
+    DASH_LOG_TRACE("UnorderedMap._insert_exchange",
+                   "received elements:", nrecv);
+
+    // Insert received elements in local memory space:
+    _reserve_local(nrecv);
+    size_type  old_local_size = _local_sizes.local[0];
+    size_type  ninserted      = 0;
+    auto       lptr_it        = _globmem->lbegin() + old_local_size;
+    for (const auto & value : recv_buf) {
+      if (_find_local_index(value.first) >= 0) {
+        continue;
+      }
+      auto * lptr_insert = static_cast<value_type *>(lptr_it);
+      new (lptr_insert) value_type(value.first, value.second);
+      _index_local_node(old_local_size + ninserted, lptr_insert);
+      ++lptr_it;
+      ++ninserted;
+    }
+    // Publish new local size in a single update:
+    GlobRef<Atomic<size_type>>(_local_size_gptr).fetch_add(ninserted);
+    _lend = local_iterator(this, old_local_size + ninserted);
+    return ninserted;
+  }
+
+  /**
+   * Publish the local hash index in global memory and update the bucket
+   * counts of the hash indices of remote units.
+   *
+   * Collective operation.
+   */
+  void _commit_index()
+  {
+    DASH_LOG_TRACE("UnorderedMap._commit_index()");
+    size_type lnbuckets = _lbucket_heads.size();
+    size_type lidx_size = lnbuckets + _lnode_next.size();
+    size_type lidx_cap  = _globidx->local_size();
+    if (lidx_size > lidx_cap) {
+      // Grow by at least the current capacity to amortize reallocation:
+      _globidx->grow(std::max(lidx_size - lidx_cap, lidx_cap));
+    }
+    auto lidx_it = _globidx->lbegin();
+    for (auto head : _lbucket_heads) {
+      *lidx_it = head;
+      ++lidx_it;
+    }
+    for (auto next : _lnode_next) {
+      *lidx_it = next;
+      ++lidx_it;
+    }
+    _globidx->commit();
+    // Exchange number of buckets, nodes and erased nodes of all units:
+    auto nunits = _team->size();
+    size_type lindex_info[3] = { lnbuckets,
+                                 static_cast<size_type>(_lnode_next.size()),
+                                 _local_erased };
+    std::vector<size_type> index_info(3 * nunits);
+    DASH_ASSERT_RETURNS(
+      dart_allgather(
+        lindex_info,
+        index_info.data(),
+        3,
+        dash::dart_datatype<size_type>::value,
+        _team->dart_id()),
+      DART_OK);
+    _remote_erased = 0;
+    for (int u = 0; u < nunits; ++u) {
+      size_type nbuckets_u   = index_info[3 * u];
+      _unit_bucket_counts[u] = nbuckets_u;
+      _unit_node_counts[u]   = index_info[3 * u + 1];
+      _unit_erased_counts[u] = index_info[3 * u + 2];
+      if (u != _myid) {
+        _remote_erased += _unit_erased_counts[u];
+      }
+      if (nbuckets_u > 0) {
+        _unit_bucket_policies[u].commit(
+          _unit_bucket_policies[u].next_size_over(nbuckets_u));
+      }
+    }
+    DASH_LOG_TRACE("UnorderedMap._commit_index >",
+                   "local buckets:", lnbuckets, "index size:", lidx_size);
+  }
+
 }; // class UnorderedMap
 
 #endif // ifndef DOXYGEN
@@ -289,7 +289,7 @@ public:
       // Iterator position does not point to local element
       return local_iterator(nullptr);
     }
-    return (_map->lbegin() + _idx_local_idx);
+    return local_iterator(_map, _idx_local_idx);
   }
 
   /**
@@ -301,7 +301,7 @@ public:
       // Iterator position does not point to local element
       return local_iterator(nullptr);
     }
-    return (_map->lbegin() + _idx_local_idx);
+    return local_iterator(_map, _idx_local_idx);
   }
 
   /**
@@ -488,23 +488,37 @@ private:
       //   --> UnorderedMapGlobIter(map, 0) -> (gidx:0, unit:2, lidx:0)
       //
       _idx           += offset;
-      _idx_local_idx = _idx;
-      auto & l_cumul_sizes = _map->_local_cumul_sizes;
-      // Find unit at global offset:
-      while (_idx >= l_cumul_sizes[_idx_unit_id] &&
-             _idx_unit_id < l_cumul_sizes.size() - 1) {
-        DASH_LOG_TRACE("UnorderedMapGlobIter.increment",
-                       "local cumulative size of unit", _idx_unit_id, ":",
-                       l_cumul_sizes[_idx_unit_id]);
-        _idx_unit_id++;
-      }
-      if (_idx_unit_id > 0) {
-        _idx_local_idx = _idx - l_cumul_sizes[_idx_unit_id-1];
+      update_local_position();
+      // Skip erased elements:
+      while (_map->_is_erased(_idx_unit_id, _idx_local_idx)) {
+        ++_idx;
+        update_local_position();
       }
     }
     DASH_LOG_TRACE("UnorderedMapGlobIter.increment >", *this);
   }
 
+  /**
+   * Resolve unit and local offset at the iterator's global position,
+   * starting at the current unit.
+   */
+  void update_local_position()
+  {
+    _idx_local_idx = _idx;
+    auto & l_cumul_sizes = _map->_local_cumul_sizes;
+    // Find unit at global offset:
+    while (_idx >= l_cumul_sizes[_idx_unit_id] &&
+           _idx_unit_id < l_cumul_sizes.size() - 1) {
+      DASH_LOG_TRACE("UnorderedMapGlobIter.increment",
+                     "local cumulative size of unit", _idx_unit_id, ":",
+                     l_cumul_sizes[_idx_unit_id]);
+      _idx_unit_id++;
+    }
+    if (_idx_unit_id > 0) {
+      _idx_local_idx = _idx - l_cumul_sizes[_idx_unit_id-1];
+    }
+  }
+
   /**
    * Decrement pointer by specified position offset.
    */
@@ -360,6 +360,10 @@ private:
                    "lidx:",   _idx,
                    "offset:", offset);
     _idx += offset;
+    // Skip erased elements:
+    while (_map->_is_erased_local(_idx)) {
+      ++_idx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalIter.increment >");
   }
 
@@ -373,6 +377,10 @@ private:
                    "lidx:",   _idx,
                    "offset:", -offset);
     _idx -= offset;
+    // Skip erased elements:
+    while (_map->_is_erased_local(_idx)) {
+      --_idx;
+    }
     DASH_LOG_TRACE("UnorderedMapLocalIter.decrement >");
   }
 
@@ -0,0 +1,31 @@
+#ifndef DASH__INTERNAL__PATTERN_COMPARE_H__
+#define DASH__INTERNAL__PATTERN_COMPARE_H__
+
+
+namespace dash {
+namespace internal {
+
+/**
+ * Whether two patterns distribute elements identically. Patterns of
+ * different types are never considered identical.
+ */
+template <class PatternA, class PatternB>
+constexpr bool same_distribution(
+    const PatternA & /*pattern_a*/,
+    const PatternB & /*pattern_b*/)
+{
+  return false;
+}
+
+template <class PatternT>
+bool same_distribution(
+    const PatternT & pattern_a,
+    const PatternT & pattern_b)
+{
+  return &pattern_a == &pattern_b || pattern_a == pattern_b;
+}
+
+} // namespace internal
+} // namespace dash
+
+#endif // DASH__INTERNAL__PATTERN_COMPARE_H__
@@ -1,6 +1,8 @@
 #include <dash/Mutex.h>
 #include <dash/Exception.h>
 
+#include <algorithm>
+
 namespace dash {
 
 Mutex::Mutex(Team& team)
@@ -47,6 +49,18 @@ bool Mutex::try_lock(){
   return static_cast<bool>(result);
 }
 
+bool Mutex::try_lock_for_us(std::chrono::microseconds timeout){
+  int32_t result;
+
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  auto timeout_us  = std::max<int64_t>(0, timeout.count());
+  dart_ret_t ret   = dart_lock_try_acquire_for(
+                       _mutex.get(), static_cast<uint64_t>(timeout_us),
+                       &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_for failed");
+  return static_cast<bool>(result);
+}
+
 void Mutex::unlock(){
   DASH_ASSERT(dart_lock_initialized(_mutex.get()));
   dart_ret_t ret = dart_lock_release(_mutex.get());
@@ -0,0 +1,95 @@
+#include <dash/SharedMutex.h>
+#include <dash/Exception.h>
+
+#include <algorithm>
+
+namespace dash {
+
+SharedMutex::SharedMutex(Team& team)
+  : _team(&team)
+{
+  init();
+}
+
+bool SharedMutex::init() {
+  if (dart_lock_initialized(_mutex.get())) {
+    DASH_LOG_ERROR("DART lock is already initialized");
+    return false;
+  }
+  if (*_team != dash::Team::Null() && dash::is_initialized()) {
+    dart_lock_t m;
+    dart_ret_t ret = dart_team_lock_init(_team->dart_id(), &m);
+
+    if (ret != DART_OK) {
+        DASH_LOG_ERROR(
+            "Failed to initialize DART lock! "
+            "(dart_team_lock_init failed)");
+        return false;
+    }
+
+    _mutex.reset(m);
+    return true;
+  }
+
+  return false;
+}
+
+void SharedMutex::lock(){
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_acquire(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire failed");
+}
+
+bool SharedMutex::try_lock(){
+  int32_t result;
+
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_try_acquire(_mutex.get(), &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock(){
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_release(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release failed");
+}
+
+void SharedMutex::lock_shared(){
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_acquire_shared(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_acquire_shared failed");
+}
+
+bool SharedMutex::try_lock_shared(){
+  int32_t result;
+
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_try_acquire_shared(_mutex.get(), &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_shared failed");
+  return static_cast<bool>(result);
+}
+
+void SharedMutex::unlock_shared(){
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  dart_ret_t ret = dart_lock_release(_mutex.get());
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_release failed");
+}
+
+bool SharedMutex::try_lock_for_us(std::chrono::microseconds timeout,
+                                  bool shared){
+  int32_t result;
+
+  DASH_ASSERT(dart_lock_initialized(_mutex.get()));
+  auto timeout_us  = static_cast<uint64_t>(
+                       std::max<int64_t>(0, timeout.count()));
+  dart_ret_t ret   = shared
+                     ? dart_lock_try_acquire_shared_for(
+                         _mutex.get(), timeout_us, &result)
+                     : dart_lock_try_acquire_for(
+                         _mutex.get(), timeout_us, &result);
+  DASH_ASSERT_EQ(DART_OK, ret, "dart_lock_try_acquire_for failed");
+  return static_cast<bool>(result);
+}
+
+} // namespace dash
@@ -0,0 +1,129 @@
+
+#include "EvalTest.h"
+
+#include <dash/Array.h>
+#include <dash/Matrix.h>
+#include <dash/algorithm/Eval.h>
+#include <dash/algorithm/Reduce.h>
+
+
+
+TEST_F(EvalTest, ArrayAxpy)
+{
+  const size_t num_elem_local = 101;
+  const size_t num_elem_total = num_elem_local * dash::size();
+
+  dash::Array<double> x(num_elem_total);
+  dash::Array<double> y(num_elem_total);
+
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    x.local[l] = static_cast<double>(x.pattern().global(l));
+    y.local[l] = 1.0;
+  }
+
+  const double a = 2.0;
+  // Evaluated at the end of the statement:
+  y = a * x + y;
+
+  for (size_t l = 0; l < y.lsize(); ++l) {
+    auto gidx = y.pattern().global(l);
+    EXPECT_EQ_U(2.0 * gidx + 1.0, y.local[l]);
+  }
+
+  y = -(y - x) / 2.0;
+
+  for (size_t l = 0; l < y.lsize(); ++l) {
+    auto gidx = y.pattern().global(l);
+    EXPECT_EQ_U(-(gidx + 1.0) / 2.0, y.local[l]);
+  }
+}
+
+TEST_F(EvalTest, ArrayAxpyNorm)
+{
+  const size_t num_elem_local = 101;
+  const size_t num_elem_total = num_elem_local * dash::size();
+
+  dash::Array<double> x(num_elem_total);
+  dash::Array<double> y(num_elem_total);
+
+  for (size_t l = 0; l < x.lsize(); ++l) {
+    x.local[l] = static_cast<double>(x.pattern().global(l));
+    y.local[l] = 1.0;
+  }
+
+  const double a  = 2.0;
+  double norm     = 0.0;
+  double sum      = 0.0;
+  double exp_norm = 0.0;
+  double exp_sum  = 0.0;
+  for (size_t g = 0; g < num_elem_total; ++g) {
+    exp_norm += (2.0 * g + 1.0) * (2.0 * g + 1.0);
+    exp_sum  += (3.0 * g + 1.0);
+  }
+
+  dash::eval(y = a * x + y, dash::reduce_into(norm, y * y));
+
+  EXPECT_EQ_U(exp_norm, norm);
+  for (size_t l = 0; l < y.lsize(); ++l) {
+    auto gidx = y.pattern().global(l);
+    EXPECT_EQ_U(2.0 * gidx + 1.0, y.local[l]);
+  }
+
+  // Reduce values assigned to y:
+  dash::eval(y = a * x + (y - x), dash::reduce_into(sum));
+
+  EXPECT_EQ_U(exp_sum, sum);
+}
+
+TEST_F(EvalTest, ReduceEmptyUnits)
+{
+  // Only the first unit has local elements:
+  dash::Array<int> x(1);
+  if (dash::myid() == 0) {
+    x.local[0] = 42;
+  }
+
+  int max_val = 0;
+  dash::eval(dash::reduce_into(max_val, x, dash::max<int>()));
+
+  EXPECT_EQ_U(42, max_val);
+}
+
+TEST_F(EvalTest, MatrixFusedUpdates)
+{
+  const size_t ext_x = 5 * dash::size();
+  const size_t ext_y = 7;
+
+  dash::Matrix<int, 2> x(ext_x, ext_y);
+  dash::Matrix<int, 2> r(ext_x, ext_y);
+  dash::Matrix<int, 2> p(ext_x, ext_y);
+
+  for (size_t l = 0; l < x.local_size(); ++l) {
+    x.lbegin()[l] = 1;
+    r.lbegin()[l] = 10;
+    p.lbegin()[l] = static_cast<int>(l);
+  }
+
+  const int alpha = 3;
+  int rr      = 0;
+  int r_max   = 0;
+  int exp_rr  = 0;
+  int exp_max = 10;
+  for (size_t l = 0; l < x.local_size(); ++l) {
+    int r_l  = 10 - alpha * static_cast<int>(l);
+    exp_rr  += r_l * r_l;
+  }
+  exp_rr = dash::reduce(&exp_rr, &exp_rr + 1, 0);
+
+  dash::eval(x = x + alpha * p,
+             r = r - alpha * p,
+             dash::reduce_into(rr, r * r),
+             dash::reduce_into(r_max, r, dash::max<int>()));
+
+  EXPECT_EQ_U(exp_rr,  rr);
+  EXPECT_EQ_U(exp_max, r_max);
+  for (size_t l = 0; l < x.local_size(); ++l) {
+    EXPECT_EQ_U(1  + alpha * static_cast<int>(l), x.lbegin()[l]);
+    EXPECT_EQ_U(10 - alpha * static_cast<int>(l), r.lbegin()[l]);
+  }
+}
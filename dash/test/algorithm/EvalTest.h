@@ -0,0 +1,11 @@
+#ifndef DASH__TEST__EVAL_TEST_H_
+#define DASH__TEST__EVAL_TEST_H_
+
+#include "../TestBase.h"
+
+/**
+ * Test fixture for dash::eval and element-wise expressions
+ */
+class EvalTest : public dash::test::TestBase {
+};
+#endif  // DASH__TEST__EVAL_TEST_H_
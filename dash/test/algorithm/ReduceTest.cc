@@ -154,3 +154,25 @@ TEST_F(ReduceTest, LocalStdIterator) {
 
   ASSERT_EQ_U(((dash::size()-1)*(dash::size())/2) * (1 + 2 + 3)  + 1, result);
 }
+
+TEST_F(ReduceTest, Async) {
+  const size_t num_elem_local = 100;
+  size_t num_elem_total       = _dash_size * num_elem_local;
+  int value = 2, start = 10;
+
+  dash::Array<int> target(num_elem_total, dash::BLOCKED);
+  dash::fill(target.begin(), target.end(), value);
+  dash::barrier();
+
+  // predefined reduction operation
+  auto fut_local = dash::reduce_async(
+                     target.lbegin(), target.lend(), start,
+                     dash::plus<int>(), true);
+  // custom reduction operation on possibly empty local ranges
+  auto fut_global = dash::reduce_async(
+                      target.begin(), target.end(), 0,
+                      dash::max<int>());
+
+  ASSERT_EQ_U(num_elem_total * value + start, fut_local.get());
+  ASSERT_EQ_U(value, fut_global.get());
+}
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <random>
 
 #ifndef DEBUG
@@ -430,5 +431,336 @@ TEST_F(SortTest, ExtremValues)
   perform_test(arr.begin(), arr.end());
 }
 
+TEST_F(SortTest, ThreadParallelLocalPhases)
+{
+  using value_t = int64_t;
+
+  // Enough elements to exceed the threshold for thread-parallel sorting and
+  // merging with an odd number of threads:
+  int const  nthreads = 3;
+  auto const nlocal   =
+      2 * nthreads * dash::detail::psort__min_elements_per_thread + 17;
+
+  std::mt19937                           generator(42 + dash::myid().id);
+  std::uniform_int_distribution<value_t> distribution(-1E6, 1E6);
+
+  std::vector<value_t> values(nlocal);
+  std::generate(values.begin(), values.end(), [&]() {
+    return distribution(generator);
+  });
+  std::vector<value_t> expected(values);
+  std::sort(expected.begin(), expected.end());
+
+  auto const comp = std::less<value_t>();
+
+  dash::detail::psort__local_sort(
+      values.begin(), values.end(), comp, nthreads);
+  EXPECT_TRUE_U(values == expected);
+
+  // Merge five sorted sequences of different sizes:
+  std::vector<size_t> offsets{
+      0, 10, nlocal / 3, nlocal / 2, nlocal / 2, nlocal};
+  std::generate(values.begin(), values.end(), [&]() {
+    return distribution(generator);
+  });
+  expected = values;
+  std::sort(expected.begin(), expected.end());
+  for (size_t s = 0; s + 1 < offsets.size(); ++s) {
+    std::sort(values.begin() + offsets[s], values.begin() + offsets[s + 1]);
+  }
+  dash::detail::psort__merge_tree(values.begin(), offsets, comp, nthreads);
+  EXPECT_TRUE_U(values == expected);
+}
+
+TEST_F(SortTest, ArrayOfRecordsByComparator)
+{
+  struct Record {
+    char    key[8];
+    int32_t id;
+  };
+
+  auto const comp = [](Record const& a, Record const& b) {
+    auto const cmp = std::strncmp(a.key, b.key, sizeof(a.key));
+    return cmp < 0 || (cmp == 0 && a.id < b.id);
+  };
+
+  dash::Array<Record> array(num_local_elem * dash::size());
+
+  // Short keys from a small alphabet produce many equal keys:
+  std::mt19937                       generator(42 + dash::myid().id);
+  std::uniform_int_distribution<int> distribution(0, 3);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    Record record{};
+    for (size_t c = 0; c < 3; ++c) {
+      record.key[c] = 'a' + distribution(generator);
+    }
+    record.id       = array.pattern().global(li);
+    array.local[li] = record;
+  }
+  array.barrier();
+
+  dash::sort(array.begin(), array.end(), comp);
+
+  if (dash::myid() == 0) {
+    int64_t id_sum = static_cast<Record>(array[0]).id;
+    for (auto it = array.begin() + 1; it < array.end(); ++it) {
+      auto const a = static_cast<Record>(*(it - 1));
+      auto const b = static_cast<Record>(*it);
+
+      EXPECT_TRUE_U(comp(a, b));
+      id_sum += b.id;
+    }
+    int64_t const n = array.size();
+    EXPECT_EQ_U(n * (n - 1) / 2, id_sum);
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, ArrayPartialRangeByComparator)
+{
+  dash::Array<int> array(num_local_elem * dash::size());
+
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = array.pattern().global(li);
+  }
+  array.barrier();
+
+  auto const first = array.begin() + 3;
+  auto const last  = array.end() - 5;
+
+  dash::sort(first, last, std::greater<int>());
+
+  if (dash::myid() == 0) {
+    for (auto it = array.begin(); it < first; ++it) {
+      EXPECT_EQ_U(it.pos(), static_cast<int>(*it));
+    }
+    for (auto it = first; it < last; ++it) {
+      EXPECT_EQ_U(
+          (last.pos() - 1) - (it.pos() - first.pos()),
+          static_cast<int>(*it));
+    }
+    for (auto it = last; it < array.end(); ++it) {
+      EXPECT_EQ_U(it.pos(), static_cast<int>(*it));
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, StableSortPreservesOrderOfEqualKeys)
+{
+  struct Element {
+    int32_t key;
+    int32_t pos;
+  };
+
+  dash::Array<Element> array(num_local_elem * dash::size());
+
+  std::mt19937                       generator(42 + dash::myid().id);
+  std::uniform_int_distribution<int> distribution(0, 9);
+  for (size_t li = 0; li < array.lsize(); ++li) {
+    array.local[li] = Element{distribution(generator),
+                              static_cast<int32_t>(array.pattern().global(li))};
+  }
+  array.barrier();
+
+  dash::stable_sort(
+      array.begin(), array.end(), [](Element const& e) { return e.key; });
+
+  if (dash::myid() == 0) {
+    for (auto it = array.begin() + 1; it < array.end(); ++it) {
+      auto const a = static_cast<Element>(*(it - 1));
+      auto const b = static_cast<Element>(*it);
+
+      EXPECT_LE_U(a.key, b.key);
+      if (a.key == b.key) {
+        EXPECT_LT_U(a.pos, b.pos);
+      }
+    }
+  }
+  array.barrier();
+}
+
+TEST_F(SortTest, SortByKey)
+{
+  dash::Array<int32_t> keys(num_local_elem * dash::size());
+  dash::Array<double>  values(num_local_elem * dash::size());
+
+  rand_range(keys.begin(), keys.end());
+  keys.barrier();
+
+  for (size_t li = 0; li < values.lsize(); ++li) {
+    values.local[li] = 0.5 * keys.local[li];
+  }
+  values.barrier();
+
+  auto const key_sum =
+      std::accumulate(keys.lbegin(), keys.lend(), static_cast<int64_t>(0));
+
+  dash::sort_by_key(keys.begin(), keys.end(), values.begin());
+
+  EXPECT_EQ_U(keys.lsize(), values.lsize());
+  for (size_t li = 0; li < keys.lsize(); ++li) {
+    EXPECT_EQ_U(0.5 * keys.local[li], values.local[li]);
+  }
+
+  int64_t g_key_sum = 0;
+  dart_allreduce(
+      &key_sum,
+      &g_key_sum,
+      1,
+      dash::dart_datatype<int64_t>::value,
+      DART_OP_SUM,
+      dash::Team::All().dart_id());
+
+  if (dash::myid() == 0) {
+    int64_t sorted_key_sum = static_cast<int32_t>(keys[0]);
+    for (auto it = keys.begin() + 1; it < keys.end(); ++it) {
+      EXPECT_LE_U(
+          static_cast<int32_t>(*(it - 1)), static_cast<int32_t>(*it));
+      sorted_key_sum += static_cast<int32_t>(*it);
+    }
+    EXPECT_EQ_U(g_key_sum, sorted_key_sum);
+  }
+  keys.barrier();
+}
+
+TEST_F(SortTest, SortByKeyDistributionMismatch)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  dash::Array<int32_t> keys(num_local_elem * dash::size());
+  dash::Array<double>  values(num_local_elem * dash::size());
+
+  // local sizes of keys and values only differ at the first and the last
+  // unit, all units throw and none remains in the collective operation
+  EXPECT_THROW(
+      dash::sort_by_key(keys.begin(), keys.end() - 1, values.begin() + 1),
+      dash::exception::InvalidArgument);
+  keys.barrier();
+}
+
+TEST_F(SortTest, OutOfPlaceWithWorkspace)
+{
+  dash::Array<int32_t> input(num_local_elem * dash::size());
+  dash::Array<int32_t> output(num_local_elem * dash::size());
+
+  dash::SortWorkspace<int32_t> workspace(input.team());
+
+  for (int iter = 0; iter < 3; ++iter) {
+    rand_range(input.begin(), input.end());
+    input.barrier();
+
+    std::vector<int32_t> const l_input(input.lbegin(), input.lend());
+
+    auto const key_sum =
+        std::accumulate(input.lbegin(), input.lend(), static_cast<int64_t>(0));
+
+    dash::sort(input.begin(), input.end(), output.begin(), workspace);
+
+    // input range is not modified
+    EXPECT_TRUE_U(std::equal(l_input.begin(), l_input.end(), input.lbegin()));
+
+    int64_t g_key_sum = 0;
+    dart_allreduce(
+        &key_sum,
+        &g_key_sum,
+        1,
+        dash::dart_datatype<int64_t>::value,
+        DART_OP_SUM,
+        dash::Team::All().dart_id());
+
+    if (dash::myid() == 0) {
+      int64_t sorted_key_sum = static_cast<int32_t>(output[0]);
+      for (auto it = output.begin() + 1; it < output.end(); ++it) {
+        EXPECT_LE_U(
+            static_cast<int32_t>(*(it - 1)), static_cast<int32_t>(*it));
+        sorted_key_sum += static_cast<int32_t>(*it);
+      }
+      EXPECT_EQ_U(g_key_sum, sorted_key_sum);
+    }
+    output.barrier();
+  }
+}
+
+TEST_F(SortTest, OutOfPlaceDistributionMismatch)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("requires at least 2 units");
+  }
+
+  dash::Array<int32_t> input(num_local_elem * dash::size());
+  dash::Array<int32_t> output(num_local_elem * dash::size());
+
+  dash::SortWorkspace<int32_t> workspace(input.team());
+
+  // local sizes of input and output only differ at the first and the last
+  // unit, all units throw and none remains in the collective operation
+  EXPECT_THROW(
+      dash::sort(input.begin(), input.end() - 1, output.begin() + 1,
+                 workspace),
+      dash::exception::InvalidArgument);
+  EXPECT_THROW(
+      dash::sort(
+          input.begin(),
+          input.end() - 1,
+          output.begin() + 1,
+          [](int32_t v) { return v; },
+          workspace),
+      dash::exception::InvalidArgument);
+
+  // the workspace belongs to a team of a subset of the units
+  auto& split_team = dash::Team::All().split(2);
+  dash::SortWorkspace<int32_t> split_workspace(split_team);
+  EXPECT_THROW(
+      dash::sort(
+          input.begin(),
+          input.end(),
+          output.begin(),
+          [](int32_t v) { return v; },
+          split_workspace),
+      dash::exception::InvalidArgument);
+  output.barrier();
+}
+
+TEST_F(SortTest, RadixSortSkewedKeys)
+{
+  // Large enough local ranges to use radix passes instead of comparisons
+  size_t const nlocal = 5000;
+
+  dash::Array<int64_t> keys(nlocal * dash::size());
+  dash::Array<float>   reals(nlocal * dash::size());
+
+  std::mt19937                            generator(42 + dash::myid().id);
+  std::uniform_int_distribution<int64_t>  key_dist(-1E12, 1E12);
+  std::uniform_real_distribution<float>   real_dist(-1E3, 1E3);
+  std::uniform_int_distribution<int>      skew_dist(0, 9);
+  for (size_t li = 0; li < nlocal; ++li) {
+    // Most keys are equal
+    keys.local[li]  = (skew_dist(generator) < 8) ? 7 : key_dist(generator);
+    reals.local[li] = real_dist(generator);
+  }
+  keys.barrier();
+
+  std::vector<int64_t> keys_expected(keys.size());
+  std::vector<float>   reals_expected(reals.size());
+  dash::copy(keys.begin(), keys.end(), keys_expected.data());
+  dash::copy(reals.begin(), reals.end(), reals_expected.data());
+  std::sort(keys_expected.begin(), keys_expected.end());
+  std::sort(reals_expected.begin(), reals_expected.end());
+  keys.barrier();
+
+  dash::sort(keys.begin(), keys.end());
+  dash::sort(reals.begin(), reals.end());
+
+  auto const l_offset = keys.pattern().global(0);
+  for (size_t li = 0; li < nlocal; ++li) {
+    EXPECT_EQ_U(keys_expected[l_offset + li], keys.local[li]);
+    EXPECT_EQ_U(reals_expected[l_offset + li], reals.local[li]);
+  }
+  keys.barrier();
+}
+
 // TODO: add additional unit tests with various pattern types and containers
 //
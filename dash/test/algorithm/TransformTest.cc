@@ -154,6 +154,79 @@ TEST_F(TransformTest, ArrayGlobalPlusGlobalBlocking)
   }
 }
 
+TEST_F(TransformTest, ArrayGlobalPlusGlobalOutOfPlace)
+{
+  // C = A + B with identical distribution, computed in local memory
+  const size_t num_elem_local = 100;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKED);
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return gidx; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t gidx) { return 1000 * gidx; });
+  dash::barrier();
+
+  auto out_last = dash::transform(array_a.begin(), array_a.end(), // A
+                                  array_b.begin(),                // B
+                                  array_c.begin(),                // C
+                                  dash::plus<int>());
+  EXPECT_EQ_U(array_c.end(), out_last);
+
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < num_elem_local; ++l_idx) {
+    int gidx = array_c.pattern().global(l_idx);
+    EXPECT_EQ_U(1001 * gidx, array_c.local[l_idx]);
+  }
+}
+
+TEST_F(TransformTest, ArrayGlobalPlusGlobalDifferentDistribution)
+{
+  // C = A * B and B = A - B with different distributions, output values
+  // are computed by their owners from fetched input values
+  const size_t num_elem_local = 50;
+  size_t num_elem_total = dash::size() * num_elem_local;
+  dash::Array<int> array_a(num_elem_total, dash::BLOCKED);
+  dash::Array<int> array_b(num_elem_total, dash::CYCLIC);
+  dash::Array<int> array_c(num_elem_total, dash::BLOCKCYCLIC(3));
+
+  dash::generate_with_index(array_a.begin(), array_a.end(),
+                            [](size_t gidx) { return gidx; });
+  dash::generate_with_index(array_b.begin(), array_b.end(),
+                            [](size_t gidx) { return 2 * gidx + 1; });
+  dash::barrier();
+
+  auto out_last = dash::transform(array_a.begin(), array_a.end(),
+                                  array_b.begin(),
+                                  array_c.begin(),
+                                  dash::multiply<int>());
+  EXPECT_EQ_U(array_c.end(), out_last);
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_c.lsize(); ++l_idx) {
+    int gidx = array_c.pattern().global(l_idx);
+    EXPECT_EQ_U(gidx * (2 * gidx + 1), array_c.local[l_idx]);
+  }
+
+  // Output range is input range, shifted by one element:
+  dash::transform(array_a.begin() + 1, array_a.end(),
+                  array_b.begin(),
+                  array_b.begin(),
+                  [](int a, int b) { return a - b; });
+  dash::barrier();
+
+  for (size_t l_idx = 0; l_idx < array_b.lsize(); ++l_idx) {
+    int gidx     = array_b.pattern().global(l_idx);
+    int expected = (gidx + 1 < static_cast<int>(num_elem_total))
+                   ? (gidx + 1) - (2 * gidx + 1)
+                   : 2 * gidx + 1;
+    EXPECT_EQ_U(expected, array_b.local[l_idx]);
+  }
+}
+
 TEST_F(TransformTest, MatrixGlobalPlusGlobalBlocking)
 {
   // Block-wise addition (a += b) of two matrices
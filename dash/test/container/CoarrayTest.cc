@@ -12,6 +12,7 @@
 #include <mutex>
 #include <thread>
 #include <random>
+#include <array>
 
 using namespace dash::coarray;
 
@@ -528,6 +529,35 @@ TEST_F(CoarrayTest, CoEvent)
   }
 }
 
+TEST_F(CoarrayTest, CoEventPostData)
+{
+  if(num_images() < 2){
+    SKIP_TEST_MSG("This test requires at least 2 units");
+  }
+
+  constexpr int num_elem = 10;
+  dash::Coevent     events;
+  dash::Array<int>  arr(num_elem * num_images(), dash::BLOCKED);
+  dash::fill(arr.begin(), arr.end(), -1);
+  dash::barrier();
+
+  std::array<int, num_elem> values;
+  for(int i = 0; i < num_elem; ++i){
+    values[i] = this_image() * num_elem + i;
+  }
+  auto next = (this_image() + 1) % num_images();
+  auto prev = (this_image() + num_images() - 1) % num_images();
+
+  // values are visible at the neighbor once it received the event
+  events(next).post(arr.begin() + next * num_elem, values.data(), num_elem);
+  events.wait();
+
+  for(int i = 0; i < num_elem; ++i){
+    ASSERT_EQ_U(prev * num_elem + i, arr.local[i]);
+  }
+  dash::barrier();
+}
+
 TEST_F(CoarrayTest, CoEventIter)
 {
   if(num_images() < 3){
@@ -548,3 +548,273 @@ TEST_F(UnorderedMapTest, MappedAtomics)
   }
 }
 
+
+TEST_F(UnorderedMapTest, HashIndexLookup)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  // Small initial capacity and local buffer size to enforce rehashing of
+  // the local hash index:
+  size_type local_elements = 500;
+  map_t     map(0, 7);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t     key    = (nunits * li) + dash::myid().id;
+    mapped_t  mapped = 0.5 * key;
+    map_value value({ key, mapped });
+
+    auto insertion = map.local.insert(value);
+    EXPECT_TRUE_U(insertion.second);
+    EXPECT_NE_U(map.local.end(), map.local.find(key));
+  }
+  map.barrier();
+
+  EXPECT_EQ_U(nunits * local_elements, map.size());
+  EXPECT_EQ_U(local_elements,          map.lsize());
+
+  // Look up elements of all units:
+  for (int li = 0; li < local_elements; li += 7) {
+    for (int unit = 0; unit < nunits; ++unit) {
+      key_t     key    = (nunits * li) + unit;
+      mapped_t  mapped = 0.5 * key;
+      map_value value({ key, mapped });
+
+      auto found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(value, found_value);
+      EXPECT_EQ_U(unit, found.lpos().unit);
+    }
+  }
+  // Look up keys not contained in the map:
+  for (int unit = 0; unit < nunits; ++unit) {
+    key_t key = (nunits * (local_elements + 1)) + unit;
+    EXPECT_EQ_U(map.end(), map.find(key));
+    EXPECT_EQ_U(0, map.count(key));
+  }
+}
+
+TEST_F(UnorderedMapTest, BulkInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  // Every unit inserts keys mapped to all units, keys in the first half
+  // of the range are inserted by all units:
+  size_type local_elements = 200;
+  size_type nshared        = local_elements / 2;
+  map_t     map(0, 5);
+
+  std::vector<std::pair<key_t, mapped_t>> values;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (li < nshared)
+                ? li
+                : (nshared + (nunits * (li - nshared)) + dash::myid().id);
+    values.push_back(std::make_pair(key, 0.5 * key));
+  }
+  auto ninserted = map.insert_bulk(values.begin(), values.end());
+
+  size_type total_elements = nshared + (nunits * (local_elements - nshared));
+  EXPECT_EQ_U(total_elements, map.size());
+  EXPECT_EQ_U(map.lsize(),    ninserted);
+
+  // Elements are stored at the unit their key is mapped to:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(dash::myid().id, value.first % nunits);
+  }
+  for (int li = 0; li < local_elements; li += 3) {
+    key_t key = values[li].first;
+    auto found = map.find(key);
+    EXPECT_NE_U(map.end(), found);
+    map_value found_value = *found;
+    EXPECT_EQ_U(map_value(key, 0.5 * key), found_value);
+    EXPECT_EQ_U(key % nunits, found.lpos().unit);
+  }
+}
+
+TEST_F(UnorderedMapTest, EraseAndCompact)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type next_unit      = (myid + 1) % nunits;
+  size_type local_elements = 300;
+  map_t     map(0, 7);
+
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + myid;
+    map.local.insert(map_value({ key, 0.5 * key }));
+  }
+  map.barrier();
+
+  // Elements with li % 3 == 0 are erased by their unit, elements with
+  // li % 3 == 1 and li < 30 are erased by the previous unit:
+  auto is_erased = [](int li) {
+                     return (li % 3 == 0) || (li % 3 == 1 && li < 30);
+                   };
+  size_type nerased = 0;
+  for (int li = 0; li < local_elements; ++li) {
+    if (is_erased(li)) {
+      ++nerased;
+    }
+  }
+  for (int li = 0; li < local_elements; li += 3) {
+    key_t key = (nunits * li) + myid;
+    EXPECT_EQ_U(1, map.local.erase(key));
+    EXPECT_EQ_U(0, map.local.erase(key));
+    EXPECT_EQ_U(map.local.end(), map.local.find(key));
+  }
+  for (int li = 1; li < 30; li += 3) {
+    key_t key = (nunits * li) + next_unit;
+    EXPECT_EQ_U(1, map.erase(key));
+  }
+  map.barrier();
+
+  size_type lsize = local_elements - nerased;
+  EXPECT_EQ_U(lsize,          map.lsize());
+  EXPECT_EQ_U(nunits * lsize, map.size());
+
+  // Iteration skips erased elements:
+  size_type nlocal = 0;
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    int       li    = (value.first - myid) / nunits;
+    EXPECT_FALSE_U(is_erased(li));
+    ++nlocal;
+  }
+  EXPECT_EQ_U(lsize, nlocal);
+  size_type nglobal = 0;
+  for (auto git = map.begin(); git != map.end(); ++git) {
+    ++nglobal;
+  }
+  EXPECT_EQ_U(map.size(), nglobal);
+  for (int li = 0; li < 40; ++li) {
+    key_t key = (nunits * li) + next_unit;
+    EXPECT_EQ_U(is_erased(li) ? 0 : 1, map.count(key));
+  }
+
+  // Compaction releases memory of erased elements:
+  auto lcap = map.lcapacity();
+  map.compact();
+  EXPECT_EQ_U(lsize,          map.lsize());
+  EXPECT_EQ_U(nunits * lsize, map.size());
+  EXPECT_GT_U(lcap,           map.lcapacity());
+
+  nlocal = 0;
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    ++nlocal;
+  }
+  EXPECT_EQ_U(lsize, nlocal);
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key   = (nunits * li) + next_unit;
+    auto  found = map.find(key);
+    if (is_erased(li)) {
+      EXPECT_EQ_U(map.end(), found);
+    } else {
+      EXPECT_NE_U(map.end(), found);
+      map_value found_value = *found;
+      EXPECT_EQ_U(map_value(key, 0.5 * key), found_value);
+    }
+  }
+}
+
+TEST_F(UnorderedMapTest, RemoteInsert)
+{
+  typedef int                                           key_t;
+  typedef double                                        mapped_t;
+  typedef HashCyclic<key_t>                             hash_t;
+  typedef dash::UnorderedMap<key_t, mapped_t, hash_t>   map_t;
+  typedef typename map_t::value_type                    map_value;
+  typedef typename map_t::size_type                     size_type;
+
+  size_type nunits         = dash::size();
+  size_type myid           = dash::myid().id;
+  size_type next_unit      = (myid + 1) % nunits;
+  size_type local_elements = 20;
+  map_t     map(0, 3);
+
+  // Every unit inserts keys mapped to the next unit and a key mapped to
+  // every unit that is inserted by all units:
+  key_t shared_key = (nunits * local_elements) + myid;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + next_unit;
+    EXPECT_TRUE_U(map.insert(map_value({ key, 0.5 * key })).second);
+    EXPECT_FALSE_U(map.insert(map_value({ key, 0.5 * key })).second);
+  }
+  for (int unit = 0; unit < nunits; ++unit) {
+    key_t key = (nunits * local_elements) + unit;
+    map.insert(map_value({ key, 0.5 * key }));
+  }
+  // Elements are visible to the inserting unit before commit:
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + next_unit;
+    EXPECT_EQ_U(1, map.count(key));
+  }
+  map.barrier();
+
+  size_type total_elements = nunits * (local_elements + 1);
+  EXPECT_EQ_U(total_elements,     map.size());
+  EXPECT_EQ_U(local_elements + 1, map.lsize());
+
+  // Elements have been moved to the unit their key is mapped to:
+  for (auto lit = map.lbegin(); lit != map.lend(); ++lit) {
+    map_value value = *lit;
+    EXPECT_EQ_U(myid, value.first % nunits);
+  }
+  for (int li = 0; li <= local_elements; ++li) {
+    for (int unit = 0; unit < nunits; ++unit) {
+      key_t key   = (nunits * li) + unit;
+      auto  found = map.find(key);
+      EXPECT_NE_U(map.end(), found);
+      EXPECT_EQ_U(1, map.count(key));
+      map_value found_value = *found;
+      EXPECT_EQ_U(map_value(key, 0.5 * key), found_value);
+      EXPECT_EQ_U(unit, found.lpos().unit);
+      // Repeated insertion by any unit does not add duplicates:
+      EXPECT_FALSE_U(map.insert(map_value({ key, 0.5 * key })).second);
+    }
+  }
+  EXPECT_EQ_U(0, map.count(shared_key + nunits));
+  map.barrier();
+  EXPECT_EQ_U(total_elements, map.size());
+
+  // Elements inserted with the default hash function are stored at the
+  // inserting unit and found by all units:
+  dash::UnorderedMap<key_t, mapped_t> lmap;
+  for (int li = 0; li < local_elements; ++li) {
+    key_t key = (nunits * li) + myid;
+    EXPECT_TRUE_U(lmap.insert(map_value({ key, 0.5 * key })).second);
+  }
+  lmap.barrier();
+  EXPECT_EQ_U(nunits * local_elements, lmap.size());
+  for (int li = 0; li < local_elements; ++li) {
+    for (int unit = 0; unit < nunits; ++unit) {
+      key_t key   = (nunits * li) + unit;
+      auto  found = lmap.find(key);
+      EXPECT_NE_U(lmap.end(), found);
+      EXPECT_EQ_U(1, lmap.count(key));
+      EXPECT_EQ_U(unit, found.lpos().unit);
+      EXPECT_FALSE_U(lmap.insert(map_value({ key, 0.5 * key })).second);
+    }
+  }
+  lmap.barrier();
+  EXPECT_EQ_U(nunits * local_elements, lmap.size());
+}
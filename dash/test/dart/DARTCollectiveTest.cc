@@ -52,6 +52,81 @@ TEST_F(DARTCollectiveTest, Sendrecv) {
 }
 
 
+TEST_F(DARTCollectiveTest, Alltoallv) {
+  // unit u sends u+1 values to every unit, value is the sender's id
+  const size_t units = _dash_size;
+  const size_t nsend = _dash_id + 1;
+
+  std::vector<int>    send_buf(units * nsend, _dash_id);
+  std::vector<size_t> send_counts(units, nsend);
+  std::vector<size_t> send_displs(units);
+  std::vector<size_t> recv_counts(units);
+  std::vector<size_t> recv_displs(units);
+  size_t nrecv = 0;
+  for (size_t u = 0; u < units; ++u) {
+    send_displs[u] = u * nsend;
+    recv_counts[u] = u + 1;
+    recv_displs[u] = nrecv;
+    nrecv         += recv_counts[u];
+  }
+  std::vector<int> recv_buf(nrecv, -1);
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_alltoallv(
+      send_buf.data(), send_counts.data(), send_displs.data(),
+      DART_TYPE_INT,
+      recv_buf.data(), recv_counts.data(), recv_displs.data(),
+      DART_TEAM_ALL));
+
+  for (size_t u = 0; u < units; ++u) {
+    for (size_t i = 0; i < recv_counts[u]; ++i) {
+      ASSERT_EQ_U(u, recv_buf[recv_displs[u] + i]);
+    }
+  }
+}
+
+TEST_F(DARTCollectiveTest, NonBlocking) {
+  const size_t units = _dash_size;
+
+  int bcast_val = (_dash_id == 0) ? 42 : -1;
+  int sum_in    = _dash_id;
+  int sum_out   = -1;
+  std::vector<int> send_buf(units, _dash_id);
+  std::vector<int> recv_buf(units, -1);
+
+  dart_handle_t handles[4];
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_ibcast(&bcast_val, 1, DART_TYPE_INT, dart_team_unit_t{0},
+                DART_TEAM_ALL, &handles[0]));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_iallreduce(&sum_in, &sum_out, 1, DART_TYPE_INT, DART_OP_SUM,
+                    DART_TEAM_ALL, &handles[1]));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_ialltoall(send_buf.data(), recv_buf.data(), 1, DART_TYPE_INT,
+                   DART_TEAM_ALL, &handles[2]));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_ibarrier(DART_TEAM_ALL, &handles[3]));
+
+  // test until the barrier completed, then wait for the rest
+  int32_t flag = 0;
+  while (!flag) {
+    ASSERT_EQ_U(DART_OK, dart_test(&handles[3], &flag));
+  }
+  ASSERT_EQ_U(DART_HANDLE_NULL, handles[3]);
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 4));
+
+  ASSERT_EQ_U(42, bcast_val);
+  ASSERT_EQ_U((units * (units - 1)) / 2, sum_out);
+  for (size_t u = 0; u < units; ++u) {
+    ASSERT_EQ_U(u, recv_buf[u]);
+  }
+}
+
 TEST_F(DARTCollectiveTest, MinMax) {
 
   using elem_t = int;
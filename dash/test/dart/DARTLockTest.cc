@@ -3,6 +3,8 @@
 #include <dash/Shared.h>
 #include <dash/dart/if/dart.h>
 
+#include <cstdlib>
+
 
 TEST_F(DARTLockTest, LockUnlockDoNothing) {
   using value_t = int;
@@ -234,3 +236,181 @@ TEST_F(DARTLockTest, TeamLockUnlock) {
     dart_team_lock_destroy(&lock));
 
 }
+
+TEST_F(DARTLockTest, LockUnlockCohortBatch) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+
+  // 0: every unit acquires the lock among all units,
+  // 1: the lock leaves the node after every handover,
+  // units disagreeing on the batch size use the smallest one
+  const char * batches[][2] = { { "0", "0" }, { "1", "1" }, { "0", "64" } };
+  for (auto & unit_batches : batches) {
+    const char * batch = unit_batches[dash::myid() == 0 ? 0 : 1];
+    dash::Shared<value_t> shared;
+    dart_lock_t lock;
+
+    if (dash::myid() == 0) {
+      shared.set(0);
+    }
+
+    // the batch size is read when the lock is initialized
+    setenv("DART_LOCK_COHORT_BATCH", batch, 1);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_init(DART_TEAM_ALL, &lock));
+    unsetenv("DART_LOCK_COHORT_BATCH");
+
+    dash::barrier();
+    for (int i = 0; i < num_iterations; ++i) {
+      if (i % 2) {
+        int32_t acquired;
+        do {
+          ASSERT_EQ_U(
+            DART_OK,
+            dart_lock_try_acquire(lock, &acquired));
+        } while (!acquired);
+      } else {
+        ASSERT_EQ_U(
+          DART_OK,
+          dart_lock_acquire(lock));
+      }
+      shared.set(shared.get() + 1);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_release(lock));
+    }
+    dash::barrier();
+
+    ASSERT_EQ_U(num_iterations * dash::size(),
+                static_cast<value_t>(shared.get()));
+
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_lock_destroy(&lock));
+  }
+}
+
+TEST_F(DARTLockTest, SharedLockUnlock) {
+  using value_t = int;
+  constexpr int num_iterations = 20;
+  dash::Shared<value_t> shared;
+  dash::Shared<value_t> writing;
+  dart_lock_t lock;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+    writing.set(0);
+  }
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  // all units hold the lock shared at the same time
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_acquire_shared(lock));
+  dash::barrier();
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_release(lock));
+
+  dash::barrier();
+  for (int i = 0; i < num_iterations; ++i) {
+    if (i % 2) {
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_lock_acquire(lock));
+      writing.set(1);
+      shared.set(shared.get() + 1);
+      writing.set(0);
+    } else {
+      int32_t acquired = 0;
+      if (i % 4) {
+        do {
+          ASSERT_EQ_U(
+            DART_OK,
+            dart_lock_try_acquire_shared(lock, &acquired));
+        } while (!acquired);
+      } else {
+        ASSERT_EQ_U(
+          DART_OK,
+          dart_lock_acquire_shared(lock));
+      }
+      ASSERT_EQ_U(0, static_cast<value_t>(writing.get()));
+    }
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U((num_iterations / 2) * dash::size(),
+              static_cast<value_t>(shared.get()));
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
+
+TEST_F(DARTLockTest, TryLockFor) {
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("Test requires at least 2 units");
+  }
+
+  dart_lock_t lock;
+  int32_t     acquired;
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_init(DART_TEAM_ALL, &lock));
+
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_acquire(lock));
+  }
+  dash::barrier();
+
+  if (dash::myid() != 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_for(lock, 1000, &acquired));
+    ASSERT_EQ_U(0, acquired);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_shared_for(lock, 1000, &acquired));
+    ASSERT_EQ_U(0, acquired);
+  }
+  dash::barrier();
+
+  if (dash::myid() == 0) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  } else {
+    // readers are admitted once the writer released the lock
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_try_acquire_shared_for(lock, 60 * 1000 * 1000, &acquired));
+    ASSERT_EQ_U(1, acquired);
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_lock_release(lock));
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_try_acquire_for(lock, 60 * 1000 * 1000, &acquired));
+  ASSERT_EQ_U(1, acquired);
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_lock_release(lock));
+  dash::barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_team_lock_destroy(&lock));
+}
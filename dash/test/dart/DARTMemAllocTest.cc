@@ -4,6 +4,9 @@
 #include <dash/dart/if/dart_globmem.h>
 #include <dash/Array.h>
 
+#include <algorithm>
+#include <vector>
+
 TEST_F(DARTMemAllocTest, SmallLocalAlloc)
 {
   typedef int value_t;
@@ -46,6 +49,83 @@ TEST_F(DARTMemAllocTest, SmallLocalAlloc)
     dart_memfree(gptr1));
 }
 
+TEST_F(DARTMemAllocTest, SizeClassAllocReuse)
+{
+  typedef char value_t;
+  // spans all size classes and exceeds the per-thread caches
+  const size_t num_allocs = 1000;
+  std::vector<dart_gptr_t> gptrs(num_allocs);
+  std::vector<size_t>      sizes(num_allocs);
+
+  for (int round = 0; round < 2; ++round) {
+    for (size_t i = 0; i < num_allocs; ++i) {
+      sizes[i] = 1 + (i * 37) % 4096;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_memalloc(sizes[i], DART_TYPE_BYTE, &gptrs[i]));
+      value_t *addr;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_gptr_getaddr(gptrs[i], (void**)&addr));
+      std::fill(addr, addr + sizes[i], static_cast<value_t>(i % 127));
+    }
+    // allocations must not overlap
+    for (size_t i = 0; i < num_allocs; ++i) {
+      value_t *addr;
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_gptr_getaddr(gptrs[i], (void**)&addr));
+      for (size_t b = 0; b < sizes[i]; ++b) {
+        ASSERT_EQ_U(static_cast<value_t>(i % 127), addr[b]);
+      }
+    }
+    // free in different order than allocated
+    for (size_t i = 0; i < num_allocs; i += 2) {
+      ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+    }
+    for (size_t i = 1; i < num_allocs; i += 2) {
+      ASSERT_EQ_U(DART_OK, dart_memfree(gptrs[i]));
+    }
+  }
+}
+
+TEST_F(DARTMemAllocTest, SizeClassSlabReclaim)
+{
+  // fill the local allocation pool with objects of the largest size class
+  const size_t obj_size = 4096;
+  std::vector<dart_gptr_t> small;
+  for (;;) {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(obj_size, DART_TYPE_BYTE, &gptr));
+    small.push_back(gptr);
+    if (gptr.segid != DART_SEGMENT_LOCAL) {
+      break;
+    }
+  }
+  for (auto gptr : small) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+  }
+
+  // the slabs of the freed objects are available to larger allocations
+  std::vector<dart_gptr_t> large;
+  for (;;) {
+    dart_gptr_t gptr;
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_memalloc(2 * obj_size, DART_TYPE_BYTE, &gptr));
+    large.push_back(gptr);
+    if (gptr.segid != DART_SEGMENT_LOCAL) {
+      break;
+    }
+  }
+  ASSERT_GT_U(2 * large.size(), small.size() / 2);
+  for (auto gptr : large) {
+    ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+  }
+}
+
 TEST_F(DARTMemAllocTest, LocalAlloc)
 {
   typedef int value_t;
@@ -107,6 +187,71 @@ TEST_F(DARTMemAllocTest, LocalAlloc)
 }
 
 
+TEST_F(DARTMemAllocTest, LocalAllocBeyondPool)
+{
+  typedef int value_t;
+  // larger than the default local allocation pool of 16 MiB
+  const size_t block_size = (1UL << 25) / sizeof(value_t);
+
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(block_size, DART_TYPE_INT, &gptr));
+  ASSERT_NE_U(
+    DART_GPTR_NULL,
+    gptr);
+
+  // small allocations are still served from the pool
+  dart_gptr_t gptr_small;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memalloc(1, DART_TYPE_INT, &gptr_small));
+  ASSERT_NE(gptr, gptr_small);
+
+  value_t *baseptr;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_gptr_getaddr(gptr, (void**)&baseptr));
+  ASSERT_NE_U(nullptr, baseptr);
+  baseptr[0]              = dash::myid().id;
+  baseptr[block_size - 1] = dash::myid().id;
+
+  dash::Array<dart_gptr_t> arr(dash::size());
+  arr.local[0] = gptr;
+  arr.barrier();
+
+  size_t neighbor_id = (dash::myid().id + 1) % dash::size();
+  dart_gptr_t neighbor_gptr = arr[neighbor_id];
+  neighbor_gptr.addr_or_offs.offset += (block_size - 1) * sizeof(value_t);
+
+  value_t neighbor_val;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_get_blocking(
+        &neighbor_val, neighbor_gptr, 1, DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(neighbor_id, neighbor_val);
+
+  value_t fetched;
+  value_t value = 1;
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_fetch_and_op(
+        neighbor_gptr, &value, &fetched, DART_TYPE_INT, DART_OP_SUM));
+  ASSERT_EQ_U(DART_OK, dart_flush(neighbor_gptr));
+  ASSERT_EQ_U(neighbor_id, fetched);
+
+  arr.barrier();
+  ASSERT_EQ_U(dash::myid().id + 1, baseptr[block_size - 1]);
+  arr.barrier();
+
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(gptr_small));
+  ASSERT_EQ_U(
+    DART_OK,
+    dart_memfree(gptr));
+}
+
 TEST_F(DARTMemAllocTest, SegmentReuseTest)
 {
   const size_t block_size = 10;
@@ -171,6 +316,54 @@ TEST_F(DARTMemAllocTest, SegmentReuseTest)
 }
 
 
+TEST_F(DARTMemAllocTest, ManySegmentsTest)
+{
+  // exceeds the initial capacity of the segment tables
+  const int num_segs = 300;
+  std::vector<dart_gptr_t> gptrs(num_segs);
+  dart_team_unit_t right = {
+    static_cast<dart_unit_t>((dash::myid() + 1) % dash::size()) };
+
+  for (int s = 0; s < num_segs; ++s) {
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[s]));
+    ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptrs[s], right));
+  }
+  // release every other segment, their IDs are reused below
+  for (int s = 0; s < num_segs; s += 2) {
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptrs[s]));
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_team_memalloc_aligned(DART_TEAM_ALL, 1, DART_TYPE_INT, &gptrs[s]));
+    ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptrs[s], right));
+  }
+
+  for (int s = 0; s < num_segs; ++s) {
+    int value = s * dash::size() + dash::myid();
+    ASSERT_EQ_U(
+      DART_OK,
+      dart_put_blocking(gptrs[s], &value, 1, DART_TYPE_INT, DART_TYPE_INT));
+  }
+  ASSERT_EQ_U(DART_OK, dart_barrier(DART_TEAM_ALL));
+
+  dart_team_unit_t left = {
+    static_cast<dart_unit_t>((dash::myid() + dash::size() - 1)
+                             % dash::size()) };
+  for (int s = 0; s < num_segs; ++s) {
+    int *addr;
+    dart_gptr_t gptr = gptrs[s];
+    ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr, dash::Team::All().myid()));
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&addr));
+    ASSERT_EQ_U(s * static_cast<int>(dash::size()) + left.id, *addr);
+  }
+  ASSERT_EQ_U(DART_OK, dart_barrier(DART_TEAM_ALL));
+
+  for (int s = 0; s < num_segs; ++s) {
+    ASSERT_EQ_U(DART_OK, dart_team_memfree(gptrs[s]));
+  }
+}
+
 TEST_F(DARTMemAllocTest, AllocatorSimpleTest)
 {
   dart_allocator_t allocator;
@@ -4,6 +4,30 @@
 #include <dash/Array.h>
 #include <dash/Onesided.h>
 
+#include <mpi.h>
+
+#include <atomic>
+
+
+/**
+ * Number of calls of MPI_Win_flush and MPI_Win_flush_local, intercepted
+ * through the MPI profiling interface to observe whether DART skips
+ * flushes without outstanding operations.
+ */
+static std::atomic<int> num_win_flush(0);
+static std::atomic<int> num_win_flush_local(0);
+
+extern "C" int MPI_Win_flush(int rank, MPI_Win win)
+{
+  ++num_win_flush;
+  return PMPI_Win_flush(rank, win);
+}
+
+extern "C" int MPI_Win_flush_local(int rank, MPI_Win win)
+{
+  ++num_win_flush_local;
+  return PMPI_Win_flush_local(rank, win);
+}
 
 TEST_F(DARTOnesidedTest, GetBlockingSingleBlock)
 {
@@ -499,6 +523,92 @@ TEST_F(DARTOnesidedTest, IndexedPutSimple) {
 }
 
 
+TEST_F(DARTOnesidedTest, StridedToIndexedNeighbor) {
+
+  constexpr size_t num_elem_per_unit = 32;
+  constexpr size_t num_reps          = 2;
+
+  // every instance of the indexed type spans elements [1, 6)
+  std::vector<size_t> blocklens = { 2, 1 };
+  std::vector<size_t> offsets   = { 1, 5 };
+  const size_t extent           = 5;
+  const size_t num_elems        = num_reps * 3;
+
+  dart_gptr_t gptr;
+  int *local_ptr;
+  dart_team_memalloc_aligned(
+    DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT, &gptr);
+  gptr.unitid = dash::myid();
+  dart_gptr_getaddr(gptr, (void**)&local_ptr);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    local_ptr[i] = dash::myid() * 1000 + i;
+  }
+
+  dart_datatype_t strided_type;
+  dart_type_create_strided(DART_TYPE_INT, 3, 2, &strided_type);
+  dart_datatype_t indexed_type;
+  dart_type_create_indexed(DART_TYPE_INT, blocklens.size(), blocklens.data(),
+                           offsets.data(), &indexed_type);
+
+  dash::barrier();
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid  = neighbor;
+
+  std::vector<int> buf(num_elem_per_unit, -1);
+  // strided-to-indexed
+  dart_get_blocking(buf.data(), gptr, num_elems, strided_type, indexed_type);
+
+  std::vector<int> expected(num_elem_per_unit, -1);
+  size_t src_idx = 0;
+  for (size_t r = 0; r < num_reps; ++r) {
+    for (size_t b = 0; b < blocklens.size(); ++b) {
+      for (size_t j = 0; j < blocklens[b]; ++j) {
+        size_t src_elem = (src_idx / 2) * 3 + (src_idx % 2);
+        expected[r * extent + offsets[b] + j] = neighbor * 1000 + src_elem;
+        ++src_idx;
+      }
+    }
+  }
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    ASSERT_EQ_U(expected[i], buf[i]);
+  }
+
+  dash::barrier();
+
+  // indexed-to-strided
+  std::vector<int> values(num_elem_per_unit);
+  for (size_t i = 0; i < num_elem_per_unit; ++i) {
+    values[i] = dash::myid() * 1000 + 100 + i;
+  }
+  dart_put_blocking(gptr, values.data(), num_elems,
+                    indexed_type, strided_type);
+
+  dash::barrier();
+
+  int prev = (dash::myid() + dash::size() - 1) % dash::size();
+  src_idx  = 0;
+  for (size_t r = 0; r < num_reps; ++r) {
+    for (size_t b = 0; b < blocklens.size(); ++b) {
+      for (size_t j = 0; j < blocklens[b]; ++j) {
+        size_t dst_elem = (src_idx / 2) * 3 + (src_idx % 2);
+        ASSERT_EQ_U(prev * 1000 + 100 + r * extent + offsets[b] + j,
+                    local_ptr[dst_elem]);
+        ++src_idx;
+      }
+    }
+  }
+
+  dart_type_destroy(&strided_type);
+  dart_type_destroy(&indexed_type);
+
+  dash::barrier();
+
+  // clean-up
+  gptr.unitid = 0;
+  dart_team_memfree(gptr);
+}
+
 TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
 
   constexpr size_t num_elem_per_unit = 120;
@@ -596,3 +706,356 @@ TEST_F(DARTOnesidedTest, IndexedToIndexedGet) {
   dart_team_memfree(gptr);
 }
 
+
+TEST_F(DARTOnesidedTest, WriteCombining) {
+
+  constexpr size_t num_elem_per_unit = 128;
+  constexpr size_t num_put_elem      = num_elem_per_unit / 2;
+
+  // registered memory is not reachable through shared memory windows,
+  // so transfers to remote units are staged
+  std::vector<int> local(num_elem_per_unit, 0);
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(DART_OK, dart_team_memregister_aligned(
+                         DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT,
+                         local.data(), &gptr));
+  ASSERT_EQ_U(DART_OK, dart_write_combining(4096));
+
+  dash::barrier();
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  gptr.unitid  = neighbor;
+
+  // puts in the lower half: odd elements first, then even elements to
+  // stage non-adjacent ranges, then overwrite the first elements
+  for (size_t parity = 1; parity <= 2; ++parity) {
+    for (size_t i = parity % 2; i < num_put_elem; i += 2) {
+      int value = -1;
+      dart_gptr_t dst = gptr;
+      dart_gptr_incaddr(&dst, i * sizeof(int));
+      ASSERT_EQ_U(DART_OK, dart_put(dst, &value, 1,
+                                    DART_TYPE_INT, DART_TYPE_INT));
+    }
+  }
+  // MPI does not order puts to overlapping target ranges
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  for (size_t i = 0; i < num_put_elem; ++i) {
+    int value = dash::myid() * 1000 + i;
+    dart_gptr_t dst = gptr;
+    dart_gptr_incaddr(&dst, i * sizeof(int));
+    ASSERT_EQ_U(DART_OK, dart_put(dst, &value, 1,
+                                  DART_TYPE_INT, DART_TYPE_INT));
+  }
+
+  // accumulates in the upper half, every element is updated repeatedly
+  for (size_t rep = 0; rep < 3; ++rep) {
+    for (size_t i = num_put_elem; i < num_elem_per_unit; ++i) {
+      int value = i;
+      dart_gptr_t dst = gptr;
+      dart_gptr_incaddr(&dst, i * sizeof(int));
+      ASSERT_EQ_U(DART_OK, dart_accumulate(dst, &value, 1,
+                                           DART_TYPE_INT, DART_OP_SUM));
+    }
+  }
+  // a single accumulate of a contiguous block
+  std::vector<int> ones(num_elem_per_unit - num_put_elem, 1);
+  dart_gptr_t dst = gptr;
+  dart_gptr_incaddr(&dst, num_put_elem * sizeof(int));
+  ASSERT_EQ_U(DART_OK, dart_accumulate(dst, ones.data(), ones.size(),
+                                       DART_TYPE_INT, DART_OP_SUM));
+
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  dash::barrier();
+
+  int prev = (dash::myid() + dash::size() - 1) % dash::size();
+  for (size_t i = 0; i < num_put_elem; ++i) {
+    ASSERT_EQ_U(prev * 1000 + i, local[i]);
+  }
+  for (size_t i = num_put_elem; i < num_elem_per_unit; ++i) {
+    ASSERT_EQ_U(3 * i + 1, local[i]);
+  }
+
+  dash::barrier();
+
+  ASSERT_EQ_U(DART_OK, dart_write_combining(0));
+  gptr.unitid = dash::myid();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr));
+}
+
+TEST_F(DARTOnesidedTest, FlushOutstandingOnly) {
+
+  constexpr size_t num_elem_per_unit = 8;
+
+  // registered memory is accessed through MPI RMA operations
+  std::vector<int> local(num_elem_per_unit, 0);
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(DART_OK, dart_team_memregister_aligned(
+                         DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT,
+                         local.data(), &gptr));
+
+  dash::barrier();
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  int prev     = (dash::myid() + dash::size() - 1) % dash::size();
+  gptr.unitid  = neighbor;
+
+  // flushes without outstanding operations are skipped
+  int nflush       = num_win_flush;
+  int nflush_local = num_win_flush_local;
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_local(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_local_all(gptr));
+  EXPECT_EQ_U(nflush,       num_win_flush);
+  EXPECT_EQ_U(nflush_local, num_win_flush_local);
+
+  // local completion does not complete the put at the target, puts to
+  // the calling unit are completed immediately
+  int  value     = dash::myid() + 1;
+  int  num_flush = (neighbor != dash::myid()) ? 1 : 0;
+  ASSERT_EQ_U(DART_OK, dart_put(gptr, &value, 1,
+                                DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(DART_OK, dart_flush_local(gptr));
+  EXPECT_EQ_U(nflush_local + num_flush, num_win_flush_local);
+  ASSERT_EQ_U(DART_OK, dart_flush_local(gptr));
+  EXPECT_EQ_U(nflush_local + num_flush, num_win_flush_local);
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  EXPECT_EQ_U(nflush + num_flush, num_win_flush);
+  // remote completion implies local completion
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_local_all(gptr));
+  EXPECT_EQ_U(nflush + num_flush,       num_win_flush);
+  EXPECT_EQ_U(nflush_local + num_flush, num_win_flush_local);
+  dash::barrier();
+  ASSERT_EQ_U(prev + 1, local[0]);
+
+  dash::barrier();
+
+  // a flush of all targets completes operations flushed individually
+  // before and pending ones
+  dart_gptr_t gptr_acc = gptr;
+  dart_gptr_incaddr(&gptr_acc, sizeof(int));
+  ASSERT_EQ_U(DART_OK, dart_accumulate(gptr_acc, &value, 1,
+                                       DART_TYPE_INT, DART_OP_SUM));
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  ASSERT_EQ_U(DART_OK, dart_accumulate(gptr_acc, &value, 1,
+                                       DART_TYPE_INT, DART_OP_SUM));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  dash::barrier();
+  ASSERT_EQ_U(2 * (prev + 1), local[1]);
+
+  // gets complete with a local flush of all targets
+  int result = -1;
+  ASSERT_EQ_U(DART_OK, dart_get(&result, gptr_acc, 1,
+                                DART_TYPE_INT, DART_TYPE_INT));
+  ASSERT_EQ_U(DART_OK, dart_flush_local_all(gptr));
+  ASSERT_EQ_U(2 * (dash::myid() + 1), result);
+
+  dash::barrier();
+
+  gptr.unitid = dash::myid();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr));
+}
+
+TEST_F(DARTOnesidedTest, FlushAfterHandleWait) {
+
+  constexpr size_t num_elem_per_unit = 8;
+
+  // registered memory is accessed through MPI RMA operations
+  std::vector<int> local(num_elem_per_unit, 0);
+  dart_gptr_t gptr;
+  ASSERT_EQ_U(DART_OK, dart_team_memregister_aligned(
+                         DART_TEAM_ALL, num_elem_per_unit, DART_TYPE_INT,
+                         local.data(), &gptr));
+
+  dash::barrier();
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  int prev     = (dash::myid() + dash::size() - 1) % dash::size();
+  gptr.unitid  = neighbor;
+  int value    = dash::myid() + 1;
+
+  // waiting on a put handle completes the put at the target, a
+  // subsequent flush has nothing left to complete
+  dart_handle_t handle;
+  ASSERT_EQ_U(DART_OK, dart_put_handle(gptr, &value, 1,
+                                       DART_TYPE_INT, DART_TYPE_INT,
+                                       &handle));
+  ASSERT_EQ_U(DART_OK, dart_wait(&handle));
+  int nflush       = num_win_flush;
+  int nflush_local = num_win_flush_local;
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_local(gptr));
+  EXPECT_EQ_U(nflush,       num_win_flush);
+  EXPECT_EQ_U(nflush_local, num_win_flush_local);
+
+  // same for handles completed together and by testing
+  dart_gptr_t gptr_next = gptr;
+  dart_gptr_incaddr(&gptr_next, sizeof(int));
+  dart_handle_t handles[2];
+  ASSERT_EQ_U(DART_OK, dart_put_handle(gptr_next, &value, 1,
+                                       DART_TYPE_INT, DART_TYPE_INT,
+                                       &handles[0]));
+  dart_gptr_incaddr(&gptr_next, sizeof(int));
+  ASSERT_EQ_U(DART_OK, dart_put_handle(gptr_next, &value, 1,
+                                       DART_TYPE_INT, DART_TYPE_INT,
+                                       &handles[1]));
+  ASSERT_EQ_U(DART_OK, dart_waitall(handles, 2));
+  dart_gptr_incaddr(&gptr_next, sizeof(int));
+  ASSERT_EQ_U(DART_OK, dart_put_handle(gptr_next, &value, 1,
+                                       DART_TYPE_INT, DART_TYPE_INT,
+                                       &handle));
+  int32_t finished = 0;
+  while (!finished) {
+    ASSERT_EQ_U(DART_OK, dart_test(&handle, &finished));
+  }
+  nflush = num_win_flush;
+  ASSERT_EQ_U(DART_OK, dart_flush(gptr));
+  ASSERT_EQ_U(DART_OK, dart_flush_all(gptr));
+  EXPECT_EQ_U(nflush, num_win_flush);
+
+  dash::barrier();
+  for (size_t i = 0; i < 4; ++i) {
+    ASSERT_EQ_U(prev + 1, local[i]);
+  }
+
+  dash::barrier();
+
+  gptr.unitid = dash::myid();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr));
+}
+
+TEST_F(DARTOnesidedTest, PutNotify) {
+
+  constexpr size_t num_elem = 100;
+
+  // allocated memory is accessed through shared memory on the same node,
+  // registered memory through MPI RMA operations
+  std::vector<int> local(num_elem + 1, 0);
+  dart_gptr_t gptr_alloc;
+  dart_gptr_t gptr_reg;
+  ASSERT_EQ_U(DART_OK, dart_team_memalloc_aligned(
+                         DART_TEAM_ALL, num_elem + 1, DART_TYPE_INT,
+                         &gptr_alloc));
+  ASSERT_EQ_U(DART_OK, dart_team_memregister_aligned(
+                         DART_TEAM_ALL, num_elem + 1, DART_TYPE_INT,
+                         local.data(), &gptr_reg));
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  int prev     = (dash::myid() + dash::size() - 1) % dash::size();
+
+  std::vector<int> values(num_elem);
+  for (size_t i = 0; i < num_elem; ++i) {
+    values[i] = dash::myid() * num_elem + i;
+  }
+
+  for (dart_gptr_t gptr : { gptr_alloc, gptr_reg }) {
+    gptr.unitid = dash::myid();
+    int *data;
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&data));
+    std::fill(data, data + num_elem + 1, 0);
+    dash::barrier();
+
+    // the flag follows the data
+    dart_gptr_t gptr_flag = gptr;
+    ASSERT_EQ_U(DART_OK, dart_gptr_incaddr(&gptr_flag,
+                                           num_elem * sizeof(int)));
+    gptr.unitid      = neighbor;
+    gptr_flag.unitid = neighbor;
+    ASSERT_EQ_U(DART_OK, dart_put_notify(gptr, values.data(), num_elem,
+                                         DART_TYPE_INT, gptr_flag, 1));
+    ASSERT_EQ_U(DART_OK, dart_flush(gptr_flag));
+
+    // wait for the notification from the previous unit
+    gptr_flag.unitid = dash::myid();
+    int flag = 0;
+    while (flag == 0) {
+      ASSERT_EQ_U(DART_OK, dart_fetch_and_op(gptr_flag, NULL, &flag,
+                                             DART_TYPE_INT, DART_OP_NO_OP));
+      ASSERT_EQ_U(DART_OK, dart_flush(gptr_flag));
+    }
+    ASSERT_EQ_U(1, flag);
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(static_cast<int>(prev * num_elem + i), data[i]);
+    }
+    dash::barrier();
+  }
+
+  gptr_reg.unitid = dash::myid();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr_reg));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_alloc));
+}
+
+TEST_F(DARTOnesidedTest, PutNotifyHandle) {
+
+  constexpr size_t num_elem  = 100;
+  constexpr size_t num_parts = 4;
+  constexpr size_t part_size = num_elem / num_parts;
+
+  // allocated memory is accessed through shared memory on the same node,
+  // registered memory through MPI RMA operations
+  std::vector<int> local(num_elem + 1, 0);
+  dart_gptr_t gptr_alloc;
+  dart_gptr_t gptr_reg;
+  ASSERT_EQ_U(DART_OK, dart_team_memalloc_aligned(
+                         DART_TEAM_ALL, num_elem + 1, DART_TYPE_INT,
+                         &gptr_alloc));
+  ASSERT_EQ_U(DART_OK, dart_team_memregister_aligned(
+                         DART_TEAM_ALL, num_elem + 1, DART_TYPE_INT,
+                         local.data(), &gptr_reg));
+
+  int neighbor = (dash::myid() + 1) % dash::size();
+  int prev     = (dash::myid() + dash::size() - 1) % dash::size();
+
+  std::vector<int> values(num_elem);
+  for (size_t i = 0; i < num_elem; ++i) {
+    values[i] = dash::myid() * num_elem + i;
+  }
+
+  for (dart_gptr_t gptr : { gptr_alloc, gptr_reg }) {
+    gptr.unitid = dash::myid();
+    int *data;
+    ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&data));
+    std::fill(data, data + num_elem + 1, 0);
+    dash::barrier();
+
+    // the flag follows the data and counts the notified parts
+    dart_gptr_t gptr_flag = gptr;
+    ASSERT_EQ_U(DART_OK, dart_gptr_incaddr(&gptr_flag,
+                                           num_elem * sizeof(int)));
+    gptr.unitid      = neighbor;
+    gptr_flag.unitid = neighbor;
+    dart_handle_t handles[num_parts];
+    for (size_t p = 0; p < num_parts; ++p) {
+      dart_gptr_t gptr_part = gptr;
+      ASSERT_EQ_U(DART_OK, dart_gptr_incaddr(&gptr_part,
+                                             p * part_size * sizeof(int)));
+      ASSERT_EQ_U(DART_OK, dart_put_notify_handle(
+                             gptr_part, values.data() + p * part_size,
+                             part_size, DART_TYPE_INT, gptr_flag, 1,
+                             &handles[p]));
+    }
+    ASSERT_EQ_U(DART_OK, dart_waitall(handles, num_parts));
+
+    // wait for the notifications from the previous unit
+    gptr_flag.unitid = dash::myid();
+    int flag = 0;
+    while (flag < static_cast<int>(num_parts)) {
+      ASSERT_EQ_U(DART_OK, dart_fetch_and_op(gptr_flag, NULL, &flag,
+                                             DART_TYPE_INT, DART_OP_NO_OP));
+      ASSERT_EQ_U(DART_OK, dart_flush(gptr_flag));
+    }
+    ASSERT_EQ_U(num_parts, flag);
+    for (size_t i = 0; i < num_elem; ++i) {
+      ASSERT_EQ_U(static_cast<int>(prev * num_elem + i), data[i]);
+    }
+    dash::barrier();
+  }
+
+  gptr_reg.unitid = dash::myid();
+  ASSERT_EQ_U(DART_OK, dart_team_memderegister(gptr_reg));
+  ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr_alloc));
+}
@@ -15,6 +15,9 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <vector>
+
 #if defined(DASH_ENABLE_OPENMP)
 #include <omp.h>
 #endif
@@ -374,4 +377,51 @@ TEST_F(ThreadsafetyTest, ConcurrentAlgorithm) {
 #endif // !defined(DASH_ENABLE_OPENMP)
 }
 
+
+TEST_F(ThreadsafetyTest, ConcurrentSmallMemAlloc) {
+  using elem_t = int;
+
+  if (!dash::is_multithreaded()) {
+    SKIP_TEST_MSG("requires support for multi-threading");
+  }
+
+#if !defined(DASH_ENABLE_OPENMP)
+  SKIP_TEST_MSG("requires support for OpenMP");
+#else
+  // exceeds the per-thread caches of the small size classes
+  static constexpr size_t allocs_per_thread = 500;
+
+  std::vector<std::vector<dart_gptr_t>> gptrs(_num_threads);
+
+#pragma omp parallel
+  {
+    int thread_id = omp_get_thread_num();
+    auto & tgptrs = gptrs[thread_id];
+    tgptrs.resize(allocs_per_thread);
+    for (size_t i = 0; i < allocs_per_thread; ++i) {
+      size_t nelem = 1 + (i % 64);
+      ASSERT_EQ_U(
+        DART_OK,
+        dart_memalloc(nelem, DART_TYPE_INT, &tgptrs[i]));
+      elem_t * addr;
+      ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(tgptrs[i], (void**)&addr));
+      std::fill(addr, addr + nelem, thread_id);
+    }
+#pragma omp barrier
+    for (size_t i = 0; i < allocs_per_thread; ++i) {
+      elem_t * addr;
+      ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(tgptrs[i], (void**)&addr));
+      for (size_t e = 0; e < 1 + (i % 64); ++e) {
+        ASSERT_EQ_U(thread_id, addr[e]);
+      }
+    }
+#pragma omp barrier
+    // free the allocations of another thread
+    for (auto & gptr : gptrs[(thread_id + 1) % _num_threads]) {
+      ASSERT_EQ_U(DART_OK, dart_memfree(gptr));
+    }
+  }
+#endif //!defined(DASH_ENABLE_OPENMP)
+}
+
 #endif // DASH_ENABLE_THREADSUPPORT
@@ -187,6 +187,39 @@ TEST_F(HaloTest, HaloSpecStencils)
   }
 }
 
+TEST_F(HaloTest, HaloSpecDepth)
+{
+  using HaloSpec_t    = HaloSpec<2>;
+  using RCoords_t     = RegionCoords<2>;
+  using StencilP_t    = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+
+  StencilSpec_t stencil_spec(
+                      StencilP_t(-1, 0),
+    StencilP_t(0,-1),                   StencilP_t(0, 2),
+                      StencilP_t( 1, 0));
+  HaloSpec_t halo_spec(HaloDepth(2), stencil_spec);
+
+  // sides
+  EXPECT_EQ((uint32_t)halo_spec.extent(1), 2);
+  EXPECT_EQ((uint32_t)halo_spec.extent(3), 2);
+  EXPECT_EQ((uint32_t)halo_spec.extent(5), 4);
+  EXPECT_EQ((uint32_t)halo_spec.extent(7), 2);
+  // corners reached in the second step
+  EXPECT_EQ((uint32_t)halo_spec.extent(0), 1);
+  EXPECT_EQ((uint32_t)halo_spec.extent(2), 2);
+  EXPECT_EQ((uint32_t)halo_spec.extent(6), 1);
+  EXPECT_EQ((uint32_t)halo_spec.extent(8), 2);
+  EXPECT_EQ((uint32_t)halo_spec.extent(4), 0);
+  EXPECT_EQ(halo_spec.spec(8).coords(), RCoords_t({2,2}));
+
+  HaloSpec_t halo_spec_single(HaloDepth(1), stencil_spec);
+  HaloSpec_t halo_spec_stencil(stencil_spec);
+  for(auto i = 0; i < RCoords_t::MaxIndex; ++i) {
+    EXPECT_EQ(halo_spec_single.extent(i), halo_spec_stencil.extent(i));
+  }
+}
+
 TEST_F(HaloTest, HaloMatrixWrapperNonCyclic2D)
 {
   using Pattern_t  = dash::Pattern<2>;
@@ -1294,3 +1327,281 @@ TEST_F(HaloTest, HaloMatrixWrapperBigMultiStencil)
 
   dash::Team::All().barrier();
 }
+
+TEST_F(HaloTest, HaloMatrixWrapperPushUpdate3D)
+{
+  using Pattern_t = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using Matrix_t = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+  using GlobBoundSpec_t = GlobalBoundarySpec<3>;
+  using StencilP_t = StencilPoint<3>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 26>;
+
+  constexpr long ext = 12;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext, ext), dist_spec, team_spec, dash::Team::All());
+  Matrix_t matrix_halo(pattern);
+
+  auto value_at = [](const std::array<index_type, 3>& coords, long round) {
+    return ((coords[0] * ext + coords[1]) * ext + coords[2]) + round * 10000;
+  };
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1,-1), StencilP_t(-1,-1, 0), StencilP_t(-1,-1, 1),
+      StencilP_t(-1, 0,-1), StencilP_t(-1, 0, 0), StencilP_t(-1, 0, 1),
+      StencilP_t(-1, 1,-1), StencilP_t(-1, 1, 0), StencilP_t(-1, 1, 1),
+      StencilP_t( 0,-1,-1), StencilP_t( 0,-1, 0), StencilP_t( 0,-1, 1),
+      StencilP_t( 0, 0,-1),                     StencilP_t( 0, 0, 1),
+      StencilP_t( 0, 1,-1), StencilP_t( 0, 1, 0), StencilP_t( 0, 1, 1),
+      StencilP_t( 1,-1,-1), StencilP_t( 1,-1, 0), StencilP_t( 1,-1, 1),
+      StencilP_t( 1, 0,-1), StencilP_t( 1, 0, 0), StencilP_t( 1, 0, 1),
+      StencilP_t( 1, 1,-1), StencilP_t( 1, 1, 0), StencilP_t( 1, 1, 1)
+  );
+  GlobBoundSpec_t bound_spec(BoundaryProp::CYCLIC, BoundaryProp::CYCLIC,
+                             BoundaryProp::CYCLIC);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix_halo, bound_spec, stencil_spec);
+
+  for(long round = 0; round < 3; ++round) {
+    for(index_type i = 0; i < ext; ++i) {
+      for(index_type j = 0; j < ext; ++j) {
+        for(index_type k = 0; k < ext; ++k) {
+          auto ref = matrix_halo[i][j][k];
+          if(ref.is_local())
+            ref = value_at({ i, j, k }, round);
+        }
+      }
+    }
+    matrix_halo.barrier();
+
+    if(round == 1) {
+      halo_wrapper.update_async();
+      halo_wrapper.wait();
+    } else {
+      halo_wrapper.update();
+    }
+
+    for(const auto& region : halo_wrapper.halo_block().halo_regions()) {
+      auto range_mem = halo_wrapper.halo_memory().range_at(region.index());
+      auto it_mem    = range_mem.first;
+      auto it_end    = region.end();
+      EXPECT_EQ_U(region.size(), std::distance(it_mem, range_mem.second));
+      for(auto it = region.begin(); it != it_end; ++it, ++it_mem) {
+        EXPECT_EQ_U(value_at(it.gcoords(), round), *it_mem);
+      }
+    }
+    matrix_halo.barrier();
+  }
+}
+
+template <typename StencilSpecT>
+static void check_stencil_steps(BoundaryProp boundary,
+                                const StencilSpecT& stencil_spec)
+{
+  using Pattern_t  = dash::Pattern<2>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 2, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<2>;
+  using TeamSpec_t = dash::TeamSpec<2>;
+  using SizeSpec_t = dash::SizeSpec<2>;
+
+  using GlobBoundSpec_t = GlobalBoundarySpec<2>;
+
+  constexpr long ext        = 24;
+  constexpr long modulo     = 1009;
+  constexpr long num_steps  = 3;
+  constexpr long num_rounds = 2;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix(pattern);
+
+  for(auto i = 0; i < ext; ++i) {
+    for(auto j = 0; j < ext; ++j) {
+      auto ref = matrix[i][j];
+      if(ref.is_local())
+        ref = (i * ext + j * 7) % modulo;
+    }
+  }
+  matrix.barrier();
+
+
+  GlobBoundSpec_t bound_spec(boundary, boundary);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix, bound_spec,
+                                           HaloDepth(num_steps), stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+
+  auto step_op = [&](auto* center, auto* center_dst, auto offset,
+                     const auto& offsets) {
+    auto value = *center;
+    for(auto i = 0; i < stencil_spec.num_stencil_points(); ++i)
+      value += center[offsets[i]];
+    *center_dst = value % modulo;
+  };
+
+  for(auto round = 0; round < num_rounds; ++round) {
+    matrix.barrier();
+    halo_wrapper.update();
+    matrix.barrier();
+    stencil_op.update_steps(num_steps, step_op);
+  }
+  matrix.barrier();
+
+  std::vector<long> check(ext * ext);
+  for(auto i = 0; i < ext; ++i) {
+    for(auto j = 0; j < ext; ++j)
+      check[i * ext + j] = (i * ext + j * 7) % modulo;
+  }
+  std::vector<long> check_tmp(check);
+  for(auto step = 0; step < num_rounds * num_steps; ++step) {
+    for(long i = 0; i < ext; ++i) {
+      for(long j = 0; j < ext; ++j) {
+        bool fixed = false;
+        auto value = check[i * ext + j];
+        for(auto p = 0; p < stencil_spec.num_stencil_points(); ++p) {
+          long pi = i + stencil_spec[p][0];
+          long pj = j + stencil_spec[p][1];
+          if(pi < 0 || pi >= ext || pj < 0 || pj >= ext) {
+            fixed = true;
+            pi = (pi + ext) % ext;
+            pj = (pj + ext) % ext;
+          }
+          value += check[pi * ext + pj];
+        }
+        check_tmp[i * ext + j] = (fixed && boundary == BoundaryProp::NONE)
+                                   ? check[i * ext + j]
+                                   : value % modulo;
+      }
+    }
+    std::swap(check, check_tmp);
+  }
+
+  for(auto i = 0; i < ext; ++i) {
+    for(auto j = 0; j < ext; ++j) {
+      auto ref = matrix[i][j];
+      if(ref.is_local()) {
+        EXPECT_EQ_U(check[i * ext + j], static_cast<long>(ref));
+      }
+    }
+  }
+
+  dash::Team::All().barrier();
+}
+
+TEST_F(HaloTest, StencilOperatorStepsCyclic2D)
+{
+  using StencilP_t    = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 4>;
+
+  StencilSpec_t stencil_spec(
+                      StencilP_t(-1, 0),
+    StencilP_t(0,-1),                   StencilP_t(0, 1),
+                      StencilP_t( 1, 0));
+
+  check_stencil_steps(BoundaryProp::CYCLIC, stencil_spec);
+}
+
+TEST_F(HaloTest, StencilOperatorStepsNonCyclic2D)
+{
+  using StencilP_t    = StencilPoint<2>;
+  using StencilSpec_t = StencilSpec<StencilP_t, 8>;
+
+  StencilSpec_t stencil_spec(
+      StencilP_t(-1,-1), StencilP_t(-1, 0), StencilP_t(-1, 1),
+      StencilP_t( 0,-1),                    StencilP_t( 0, 1),
+      StencilP_t( 1,-1), StencilP_t( 1, 0), StencilP_t( 1, 1));
+
+  check_stencil_steps(BoundaryProp::NONE, stencil_spec);
+}
+
+TEST_F(HaloTest, StencilOperatorUpdateTiled3D)
+{
+  using Pattern_t  = dash::Pattern<3>;
+  using index_type = typename Pattern_t::index_type;
+  using Matrix_t   = dash::Matrix<long, 3, index_type, Pattern_t>;
+  using DistSpec_t = dash::DistributionSpec<3>;
+  using TeamSpec_t = dash::TeamSpec<3>;
+  using SizeSpec_t = dash::SizeSpec<3>;
+
+  using StencilSpec_t = StaticStencilSpec<
+    StaticStencilPoint<-1, 0, 0>, StaticStencilPoint< 0,-1, 0>,
+    StaticStencilPoint< 0, 0,-1>, StaticStencilPoint< 0, 0, 1>,
+    StaticStencilPoint< 0, 1, 0>, StaticStencilPoint< 1, 0, 0>>;
+
+  static_assert(StencilSpec_t::point_value(0, 0) == -1,
+                "Stencil points are not available at compile time");
+  static_assert(StencilSpec_t::point_value(3, 2) == 1,
+                "Stencil points are not available at compile time");
+  static_assert(is_static_stencil_spec<StencilSpec_t>::value &&
+                !is_static_stencil_spec<StencilSpec<StencilPoint<3>, 6>>::value,
+                "Static stencil specs are not detected");
+
+  constexpr long ext = 20;
+
+  DistSpec_t dist_spec(dash::BLOCKED, dash::BLOCKED, dash::BLOCKED);
+  TeamSpec_t team_spec{};
+  team_spec.balance_extents();
+  Pattern_t pattern(SizeSpec_t(ext, ext, ext), dist_spec, team_spec,
+                    dash::Team::All());
+  Matrix_t matrix(pattern);
+
+  for(index_type i = 0; i < ext; ++i) {
+    for(index_type j = 0; j < ext; ++j) {
+      for(index_type k = 0; k < ext; ++k) {
+        auto ref = matrix[i][j][k];
+        if(ref.is_local())
+          ref = (i * 31 + j * 17 + k * 7) % 101;
+      }
+    }
+  }
+  matrix.barrier();
+
+  StencilSpec_t stencil_spec;
+  EXPECT_EQ_U(-1, stencil_spec[1][1]);
+  HaloMatrixWrapper<Matrix_t> halo_wrapper(matrix, stencil_spec);
+  auto stencil_op = halo_wrapper.stencil_operator(stencil_spec);
+
+  auto nlocal = matrix.local_size();
+  std::vector<long> dst_check(nlocal, 0);
+  std::vector<long> dst_tiled(nlocal, 0);
+  std::vector<long> dst_tiled_blocked(nlocal, 0);
+
+  stencil_op.inner.update(dst_check.data(),
+    [](auto* center, auto* center_dst, auto offset, const auto& offsets) {
+      long value = 2 * *center;
+      for(auto i = 0; i < StencilSpec_t::num_stencil_points(); ++i)
+        value += (i + 1) * center[offsets[i]];
+      *center_dst = value;
+    });
+
+  auto op = [](long c, long p0, long p1, long p2, long p3, long p4,
+               long p5) {
+    return 2 * c + p0 + 2 * p1 + 3 * p2 + 4 * p3 + 5 * p4 + 6 * p5;
+  };
+  stencil_op.inner.update_tiled(dst_tiled.data(), op);
+  stencil_op.inner.update_tiled(dst_tiled_blocked.data(), op, { 3, 2, 4 });
+
+  EXPECT_EQ_U(dst_check, dst_tiled);
+  EXPECT_EQ_U(dst_check, dst_tiled_blocked);
+
+  // the same stencil points specified at runtime
+  using StencilP_t = StencilPoint<3>;
+  StencilSpec<StencilP_t, 6> runtime_spec(
+    StencilP_t(-1, 0, 0), StencilP_t( 0,-1, 0), StencilP_t( 0, 0,-1),
+    StencilP_t( 0, 0, 1), StencilP_t( 0, 1, 0), StencilP_t( 1, 0, 0));
+  auto stencil_op_runtime = halo_wrapper.stencil_operator(runtime_spec);
+  std::vector<long> dst_runtime(nlocal, 0);
+  stencil_op_runtime.inner.update_tiled(dst_runtime.data(), op, { 3, 2, 4 });
+
+  EXPECT_EQ_U(dst_check, dst_runtime);
+
+  dash::Team::All().barrier();
+}
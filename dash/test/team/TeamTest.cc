@@ -34,6 +34,21 @@ TEST_F(TeamTest, Deallocate) {
   // Array will be deallocated when going out of scope
 }
 
+TEST_F(TeamTest, BarrierAsync) {
+  dash::Team & team = dash::Team::All();
+  dash::Array<int> arr(team.size(), team);
+  arr.local[0] = team.myid();
+
+  auto fut = team.barrier_async();
+  // all units entered the barrier after completion
+  fut.wait();
+  ASSERT_TRUE_U(fut.test());
+
+  int right = arr[(team.myid() + 1) % team.size()];
+  ASSERT_EQ_U((team.myid() + 1) % team.size(), right);
+  team.barrier();
+}
+
 TEST_F(TeamTest, SplitTeamSync)
 {
   auto & team_all = dash::Team::All();
@@ -106,3 +121,72 @@ TEST_F(TeamTest, SplitTeamSync)
   }
 }
 
+
+TEST_F(TeamTest, CreateManyTeams)
+{
+  // More teams than the former team table capacity of 256 entries
+  constexpr int num_teams = 300;
+
+  // Alternate between all units and all units but unit 0, teams reuse the
+  // cached communicators of both groups
+  dart_group_t groups[2];
+  ASSERT_EQ_U(DART_OK, dart_team_get_group(DART_TEAM_ALL, &groups[0]));
+  ASSERT_EQ_U(DART_OK, dart_team_get_group(DART_TEAM_ALL, &groups[1]));
+  if (dash::size() > 1) {
+    ASSERT_EQ_U(DART_OK, dart_group_delmember(groups[1],
+                                              DART_GLOBAL_UNIT_ID(0)));
+  }
+
+  for (int t = 0; t < num_teams; ++t) {
+    bool is_member  = (t % 2 == 0 || dash::size() == 1 || dash::myid() != 0);
+    size_t expected = (t % 2 == 0 || dash::size() == 1)
+                      ? dash::size() : dash::size() - 1;
+
+    dart_team_t team = DART_TEAM_NULL;
+    ASSERT_EQ_U(DART_OK, dart_team_create(DART_TEAM_ALL, groups[t % 2],
+                                          &team));
+    if (!is_member) {
+      ASSERT_EQ_U(DART_TEAM_NULL, team);
+      continue;
+    }
+    ASSERT_NE_U(DART_TEAM_NULL, team);
+
+    size_t size;
+    ASSERT_EQ_U(DART_OK, dart_team_size(team, &size));
+    ASSERT_EQ_U(expected, size);
+
+    dart_team_unit_t myid;
+    dart_team_unit_t g2l;
+    ASSERT_EQ_U(DART_OK, dart_team_myid(team, &myid));
+    ASSERT_EQ_U(DART_OK, dart_team_unit_g2l(team, dash::myid(), &g2l));
+    ASSERT_EQ_U(g2l.id, myid.id);
+
+    if (t % 10 < 2) {
+      // the team's window is created on the first allocation
+      dart_gptr_t gptr;
+      ASSERT_EQ_U(DART_OK, dart_team_memalloc_aligned(
+                             team, 1, DART_TYPE_INT, &gptr));
+      int value = myid.id;
+      dart_team_unit_t right = {
+        static_cast<dart_unit_t>((myid.id + 1) % size) };
+      dart_team_unit_t left  = {
+        static_cast<dart_unit_t>((myid.id + size - 1) % size) };
+      ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr, right));
+      ASSERT_EQ_U(DART_OK, dart_put_blocking(
+                             gptr, &value, 1, DART_TYPE_INT, DART_TYPE_INT));
+      ASSERT_EQ_U(DART_OK, dart_barrier(team));
+
+      ASSERT_EQ_U(DART_OK, dart_gptr_setunit(&gptr, myid));
+      int *local;
+      ASSERT_EQ_U(DART_OK, dart_gptr_getaddr(gptr, (void**)&local));
+      ASSERT_EQ_U(left.id, *local);
+      ASSERT_EQ_U(DART_OK, dart_barrier(team));
+      ASSERT_EQ_U(DART_OK, dart_team_memfree(gptr));
+    }
+
+    ASSERT_EQ_U(DART_OK, dart_team_destroy(&team));
+  }
+
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&groups[0]));
+  ASSERT_EQ_U(DART_OK, dart_group_destroy(&groups[1]));
+}
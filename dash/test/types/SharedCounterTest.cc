@@ -0,0 +1,49 @@
+
+#include "SharedCounterTest.h"
+
+#include <dash/SharedCounter.h>
+
+
+TEST_F(SharedCounterTest, IncrementAllModes)
+{
+  using value_t = int64_t;
+
+  const value_t num_units = dash::size();
+  const value_t expected  = (num_units * (num_units + 1)) / 2;
+
+  for (auto mode : { dash::SharedCounterMode::distributed,
+                     dash::SharedCounterMode::atomic,
+                     dash::SharedCounterMode::node_combining }) {
+    dash::SharedCounter<value_t> counter(dash::Team::All(), mode);
+    EXPECT_EQ_U(mode, counter.mode());
+    EXPECT_EQ_U(0, counter.get());
+    dash::barrier();
+
+    counter.inc(dash::myid() + 1);
+    counter.inc(2);
+    counter.dec(2);
+    dash::barrier();
+
+    EXPECT_EQ_U(expected, counter.get());
+    dash::barrier();
+  }
+}
+
+TEST_F(SharedCounterTest, AtomicReadsAreConsistent)
+{
+  dash::SharedCounter<int> counter(dash::SharedCounterMode::atomic);
+
+  const int num_inc = 100;
+  int       last    = 0;
+  for (int i = 0; i < num_inc; ++i) {
+    counter.inc(1);
+    // at least the own increments are visible, reads never go backwards
+    auto value = counter.get();
+    EXPECT_GE_U(value, i + 1);
+    EXPECT_GE_U(value, last);
+    last = value;
+  }
+  dash::barrier();
+
+  EXPECT_EQ_U(num_inc * static_cast<int>(dash::size()), counter.get());
+}
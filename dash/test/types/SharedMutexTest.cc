@@ -0,0 +1,80 @@
+#include "SharedMutexTest.h"
+
+#include <dash/SharedMutex.h>
+#include <dash/Shared.h>
+
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+
+TEST_F(SharedMutexTest, SharedAndUniqueLock)
+{
+  using value_t = int;
+  constexpr int num_iterations = 10;
+  dash::Shared<value_t> shared;
+  dash::SharedMutex     mx;
+
+  if (dash::myid() == 0) {
+    shared.set(0);
+  }
+  dash::barrier();
+
+  for (int i = 0; i < num_iterations; ++i) {
+    {
+      std::unique_lock<dash::SharedMutex> ul(mx);
+      shared.set(shared.get() + 1);
+    }
+    {
+      std::shared_lock<dash::SharedMutex> sl(mx);
+      ASSERT_GT_U(static_cast<value_t>(shared.get()), 0);
+    }
+  }
+  dash::barrier();
+
+  ASSERT_EQ_U(num_iterations * dash::size(),
+              static_cast<value_t>(shared.get()));
+}
+
+TEST_F(SharedMutexTest, TimedLock)
+{
+  if (dash::size() < 2) {
+    SKIP_TEST_MSG("At least 2 units required");
+  }
+
+  dash::SharedMutex mx;
+
+  {
+    std::shared_lock<dash::SharedMutex> sl(mx, std::defer_lock);
+    if (dash::myid() != 0) {
+      sl.lock();
+    }
+    dash::barrier();
+    // the lock is held shared by all other units
+    if (dash::myid() == 0) {
+      ASSERT_FALSE_U(mx.try_lock_for(std::chrono::milliseconds(1)));
+    }
+    dash::barrier();
+  }
+  dash::barrier();
+
+  {
+    std::unique_lock<dash::SharedMutex> ul(mx, std::defer_lock);
+    if (dash::myid() == 0) {
+      ul.lock();
+    }
+    dash::barrier();
+    if (dash::myid() != 0) {
+      std::shared_lock<dash::SharedMutex> sl(
+        mx, std::chrono::milliseconds(1));
+      ASSERT_FALSE_U(sl.owns_lock());
+    }
+    dash::barrier();
+  }
+
+  std::shared_lock<dash::SharedMutex> sl(
+    mx, std::chrono::steady_clock::now() + std::chrono::seconds(60));
+  ASSERT_TRUE_U(sl.owns_lock());
+  sl.unlock();
+  dash::barrier();
+}
@@ -0,0 +1,13 @@
+#ifndef DASH__TEST__SHARED_MUTEX_TEST_H__INCLUDED
+#define DASH__TEST__SHARED_MUTEX_TEST_H__INCLUDED
+
+#include "../TestBase.h"
+
+
+/**
+ * Test fixture for class dash::SharedMutex
+ */
+class SharedMutexTest : public dash::test::TestBase {
+};
+
+#endif // DASH__TEST__SHARED_MUTEX_TEST_H__INCLUDED